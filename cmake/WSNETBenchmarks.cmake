@@ -0,0 +1,84 @@
+#------------------------------------------------------------------------------
+# WSNETBenchmarks.cmake
+#
+# CMake file for WSNET benchmarks
+#
+# Author: agent
+#------------------------------------------------------------------------------
+
+# -----------------------------------------------------------------------------
+# WSNET configuration of Google Benchmark
+# An installed Google Benchmark is used first. Else it is downloaded and built
+# with wsnet if WSNET_FETCH_GOOGLEBENCHMARK is ON. WSNET_GOOGLEBENCHMARK_FOUND
+# tells whether the benchmarks can be built, with WSNET_GOOGLEBENCHMARK_LIBRARIES.
+# -----------------------------------------------------------------------------
+macro(wsnet_bench_config_googlebenchmark)
+	if (NOT WSNET_BENCH_CONFIG_GOOGLEBENCHMARK)
+		find_package(benchmark CONFIG QUIET)
+
+		if(benchmark_FOUND)
+		    message(STATUS "Using the installed google benchmark ${benchmark_VERSION}")
+		    set(WSNET_GOOGLEBENCHMARK_LIBRARIES benchmark::benchmark_main benchmark::benchmark)
+		    set(WSNET_GOOGLEBENCHMARK_FOUND TRUE)
+		elseif(WSNET_FETCH_GOOGLEBENCHMARK)
+		    wsnet_bench_fetch_googlebenchmark()
+		    set(WSNET_GOOGLEBENCHMARK_LIBRARIES benchmark_main benchmark)
+		    set(WSNET_GOOGLEBENCHMARK_FOUND TRUE)
+		else()
+		    set(WSNET_GOOGLEBENCHMARK_FOUND FALSE)
+		endif()
+
+		set(WSNET_BENCH_CONFIG_GOOGLEBENCHMARK TRUE)
+	endif()
+endmacro()
+
+macro(wsnet_bench_fetch_googlebenchmark)
+	set(WSNET_BUILD_PATH "${WSNET_SRC_PATH}/build" CACHE PATH "The path to the wsnet build directory")
+	set(WSNET_GOOGLEBENCHMARK_BUILD_PATH "${WSNET_BUILD_PATH}/googlebenchmark-build" CACHE PATH "The path to the google benchmark build directory")
+	set(WSNET_GOOGLEBENCHMARK_DOWNLOAD_PATH "${WSNET_BUILD_PATH}/googlebenchmark-download" CACHE PATH "The path to the google benchmark download directory")
+	set(WSNET_GOOGLEBENCHMARK_SRC_PATH "${WSNET_BUILD_PATH}/googlebenchmark-src" CACHE PATH "The path to the google benchmark source directory")
+
+	# Download and unpack google benchmark at configure time
+	configure_file(${WSNET_CMAKE_PATH}/WSNETGoogleBenchmark.CMakeLists.cmake.in googlebenchmark-download/CMakeLists.txt)
+	execute_process(COMMAND ${CMAKE_COMMAND} -G "${CMAKE_GENERATOR}" .
+	                RESULT_VARIABLE result
+	                WORKING_DIRECTORY ${WSNET_GOOGLEBENCHMARK_DOWNLOAD_PATH} )
+
+	if(result)
+	    message(FATAL_ERROR "CMake step for google benchmark failed: ${result}")
+	endif()
+
+	execute_process(COMMAND ${CMAKE_COMMAND} --build .
+	                RESULT_VARIABLE result
+	                WORKING_DIRECTORY ${WSNET_GOOGLEBENCHMARK_DOWNLOAD_PATH} )
+	if(result)
+	    message(FATAL_ERROR "Build step for google benchmark failed: ${result}")
+	endif()
+
+	# Google benchmark tests need googletest sources of their own
+	set(BENCHMARK_ENABLE_TESTING OFF CACHE BOOL "" FORCE)
+	set(BENCHMARK_ENABLE_GTEST_TESTS OFF CACHE BOOL "" FORCE)
+
+	add_subdirectory(${WSNET_GOOGLEBENCHMARK_SRC_PATH}
+	                 ${WSNET_GOOGLEBENCHMARK_BUILD_PATH}
+	                 EXCLUDE_FROM_ALL)
+endmacro()
+
+# -----------------------------------------------------------------------------
+# WSNET add the benchmarks executable
+# The internal libraries are linked as for the wsnet executable, the
+# benchmarks calling the kernel functions directly.
+# wsnet_bench_config_googlebenchmark() must have found google benchmark.
+# -----------------------------------------------------------------------------
+function(wsnet_add_benchmarks BENCH_NAME BENCH_SOURCES)
+    wsnet_include_all_internal_libs()
+
+    add_executable(${BENCH_NAME} ${BENCH_SOURCES})
+
+    wsnet_find_external_libs(${BENCH_NAME} "M;GMODULE2;LibXml2")
+
+    get_property(LINK_INTERNAL_LIBRARIES DIRECTORY ${WSNET_SRC_PATH} PROPERTY WSNET_INTERNAL_LIBRARIES)
+    target_link_libraries(${BENCH_NAME} ${WSNET_GOOGLEBENCHMARK_LIBRARIES}
+                                        -Wl,--start-group ${LINK_INTERNAL_LIBRARIES} -Wl,--end-group
+                                        )
+endfunction()
@@ -167,8 +167,11 @@ macro(wsnet_add_unit_tests_model_link_libs UNIT_TEST_NAME)
                         list
                         mem_fs
                         sliding_window
+                        spatial_grid
+                        interference_accumulator
                         definitions
                         tools_math_rng
+                        tools_profiler
                         model_handlers
                         scheduler
                         )
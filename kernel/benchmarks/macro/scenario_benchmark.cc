@@ -0,0 +1,207 @@
+/**
+ *  \file   scenario_benchmark.cc
+ *  \brief  Scenario macro benchmarks
+ *      The examples are scaled up to 1k, 10k and 50k nodes, the area
+ *      growing with the number of nodes to keep the density of the
+ *      original scenario, and run by the wsnet executable. The nodes of
+ *      the static mobility classes are placed uniformly at random on the
+ *      scaled area, whatever the positions given by the example, from the
+ *      position seed WSNET_BENCH_SEED (default 1) so that the runs can be
+ *      compared. The events
+ *      per second and the speedup are read from the simulation stats,
+ *      the peak RSS from the resource usage of the child process.
+ *
+ *      The simulated duration is overridden by the WSNET_BENCH_DURATION
+ *      environment variable (default 1s). The models are found by wsnet
+ *      as usual, from the environment of the benchmark.
+ *  \author agent
+ *  \date   2026
+ **/
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/resource.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+
+#include <fstream>
+#include <regex>
+#include <sstream>
+#include <string>
+
+#include <benchmark/benchmark.h>
+
+/* ************************************************** */
+/* ************************************************** */
+#define SCENARIO_DEFAULT_DURATION "1s"
+#define SCENARIO_DEFAULT_SEED "1"
+
+static const char *scenario_examples[] = {"cbr.xml", "hello.xml", "simple_example_spectrum.xml"};
+static const int scenario_nodes[] = {1000, 10000, 50000};
+
+/* ************************************************** */
+/* ************************************************** */
+// the static mobility classes with random default positions, the positions given to their nodes being dropped
+static std::string scenario_place(const std::string &xml){
+  std::regex mobility("<mobility\\s+class=\"([^\"]*)\"[\\s\\S]*?</mobility>");
+  std::regex position("[ \t]*<param\\s+key=\"[xyz]\"\\s+value=\"[^\"]*\"\\s*/>[ \t]*\n?");
+  std::regex defaults("[ \t]*<default_parameters>\\s*</default_parameters>[ \t]*\n?");
+  std::string placed, suffix = xml;
+  std::smatch match;
+
+  while (std::regex_search(suffix, match, mobility)){
+    std::string model = match.str();
+
+    if (model.find("\"mobility_static\"") != std::string::npos){
+      model = std::regex_replace(std::regex_replace(model, position, ""), defaults, "");
+      model.insert(model.rfind("</mobility>"), "\t<default_parameters>\n"
+                   "\t\t\t<param key=\"x\" value=\"random\" />\n"
+                   "\t\t\t<param key=\"y\" value=\"random\" />\n"
+                   "\t\t\t<param key=\"z\" value=\"random\" />\n"
+                   "\t\t</default_parameters>\n\t");
+
+      // the nodes using the class
+      std::string name = match[1].str();
+      std::regex node("<mobility\\s+name=\"" + name + "\"[\\s\\S]*?</mobility>");
+      std::string nodes = match.suffix().str(), kept;
+      std::smatch node_match;
+      while (std::regex_search(nodes, node_match, node)){
+        kept += node_match.prefix().str() + std::regex_replace(node_match.str(), position, "");
+        nodes = node_match.suffix().str();
+      }
+      placed += match.prefix().str() + model;
+      suffix = kept + nodes;
+      continue;
+    }
+    placed += match.prefix().str() + model;
+    suffix = match.suffix().str();
+  }
+
+  return placed + suffix;
+}
+
+// the example with nbr_nodes nodes on an area scaled to keep the same density, empty on error
+static std::string scenario_scale(const std::string &example, int nbr_nodes, const std::string &duration){
+  std::ifstream file(std::string(WSNET_BENCH_EXAMPLES_PATH) + "/" + example);
+  std::stringstream content;
+  std::smatch match;
+
+  if (!file){
+    return "";
+  }
+  content << file.rdbuf();
+  std::string xml = content.str();
+
+  std::regex simulation("<simulation\\s+nodes=\"([0-9]+)\"\\s+duration=\"[^\"]*\"");
+  if (!std::regex_search(xml, match, simulation)){
+    return "";
+  }
+  double scale = sqrt((double) nbr_nodes / std::stoi(match[1]));
+  xml = match.prefix().str() + "<simulation nodes=\"" + std::to_string(nbr_nodes)
+      + "\" duration=\"" + duration + "\"" + match.suffix().str();
+
+  // the area is given by the x and y class parameters of the global map
+  std::regex global_map("<global_map\\s+class=[\\s\\S]*?</global_map>");
+  if (std::regex_search(xml, match, global_map)){
+    std::string map = match.str();
+    std::string prefix = match.prefix().str(), suffix = match.suffix().str();
+    std::regex size("(key=\"[xy]\"\\s+value=\")([0-9.]+)\"");
+    std::string scaled;
+
+    for (std::sregex_iterator it(map.begin(), map.end(), size), end; it != end; ++it){
+      scaled += it->prefix().str() + (*it)[1].str() + std::to_string(std::stod((*it)[2]) * scale) + "\"";
+      if (std::next(it) == end){
+        scaled += it->suffix().str();
+      }
+    }
+    xml = prefix + (scaled.empty() ? map : scaled) + suffix;
+  }
+
+  return scenario_place(xml);
+}
+
+// the value following a label of the simulation stats, 0 if not found
+static double scenario_stat(const std::string &output, const std::string &label){
+  size_t position = output.rfind(label);
+  if (position == std::string::npos){
+    return 0;
+  }
+  return atof(output.c_str() + position + label.size());
+}
+
+/* ************************************************** */
+/* ************************************************** */
+static void BM_Scenario(benchmark::State &state, const std::string &example){
+  const char *duration = getenv("WSNET_BENCH_DURATION");
+  const char *seed = getenv("WSNET_BENCH_SEED");
+  std::string xml = scenario_scale(example, state.range(0), duration ? duration : SCENARIO_DEFAULT_DURATION);
+  char config[] = "/tmp/wsnet_bench_XXXXXX.xml";
+  int fd;
+
+  if (xml.empty()){
+    state.SkipWithError(("cannot scale " + example).c_str());
+    return;
+  }
+  if (((fd = mkstemps(config, 4)) < 0) || (write(fd, xml.c_str(), xml.size()) != (ssize_t) xml.size())){
+    state.SkipWithError("cannot write the scenario");
+    return;
+  }
+  close(fd);
+
+  for (auto _ : state){
+    int pipes[2];
+    std::string output;
+    char buffer[4096];
+    ssize_t length;
+    struct rusage usage;
+    int status;
+
+    if (pipe(pipes) < 0){
+      state.SkipWithError("cannot create the pipe");
+      break;
+    }
+
+    pid_t pid = fork();
+    if (pid == 0){
+      dup2(pipes[1], STDOUT_FILENO);
+      close(pipes[0]);
+      close(pipes[1]);
+      execl(WSNET_BENCH_EXECUTABLE, WSNET_BENCH_EXECUTABLE, "-c", config, "-S", seed ? seed : SCENARIO_DEFAULT_SEED, (char *) NULL);
+      _exit(127);
+    }
+
+    close(pipes[1]);
+    while ((length = read(pipes[0], buffer, sizeof(buffer))) > 0){
+      output.append(buffer, length);
+    }
+    close(pipes[0]);
+
+    if ((pid < 0) || (wait4(pid, &status, 0, &usage) < 0) || !WIFEXITED(status) || WEXITSTATUS(status)){
+      state.SkipWithError(("wsnet failed on " + example).c_str());
+      break;
+    }
+
+    state.counters["events"] = scenario_stat(output, "events executed: ");
+    state.counters["events_per_second"] = scenario_stat(output, "events per second: ");
+    state.counters["speedup"] = scenario_stat(output, "speedup: ");
+    state.counters["peak_rss_bytes"] = (double) usage.ru_maxrss * 1024;
+  }
+
+  unlink(config);
+}
+
+static int scenario_register(void){
+  for (auto example : scenario_examples){
+    std::string name = std::string("BM_Scenario/") + example;
+    auto benchmark = benchmark::RegisterBenchmark(name.c_str(), BM_Scenario, std::string(example));
+    for (auto nbr_nodes : scenario_nodes){
+      benchmark->Arg(nbr_nodes);
+    }
+    benchmark->Iterations(1)->Unit(benchmark::kSecond)->UseRealTime();
+  }
+  return 0;
+}
+static int scenario_registered = scenario_register();
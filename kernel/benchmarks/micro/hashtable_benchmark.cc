@@ -0,0 +1,110 @@
+/**
+ *  \file   hashtable_benchmark.cc
+ *  \brief  Hashtable and packet fields micro benchmarks
+ *  \author agent
+ *  \date   2026
+ **/
+
+#include <stdlib.h>
+#include <string>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <kernel/benchmarks/micro/micro_benchmark.h>
+#include <kernel/include/data_structures/hashtable/hashtable.h>
+#include <kernel/include/definitions/packet.h>
+
+/* ************************************************** */
+/* ************************************************** */
+static std::vector<std::string> field_names(int nbr_fields){
+  std::vector<std::string> names;
+  for (int i = 0; i < nbr_fields; i++){
+    names.push_back("benchmark_field_" + std::to_string(i));
+  }
+  return names;
+}
+
+static field_t *field_int(int value){
+  int *pointer = (int *) malloc(sizeof(int));
+  *pointer = value;
+  return field_create(INT, sizeof(int), pointer);
+}
+
+/* ************************************************** */
+/* ************************************************** */
+static void BM_HashtableInsertRetrieveDelete(benchmark::State &state){
+  micro_benchmark_init();
+  std::vector<std::string> names = field_names(state.range(0));
+  hashtable_t *hashtable = hashtable_create(hash_string, equal_string, NULL, NULL);
+  int64_t found = 0;
+
+  for (auto _ : state){
+    for (auto &name : names){
+      hashtable_insert(hashtable, (void *) name.c_str(), (void *) &name);
+    }
+    for (auto &name : names){
+      found += (hashtable_retrieve(hashtable, (void *) name.c_str()) != NULL);
+    }
+    for (auto &name : names){
+      hashtable_delete(hashtable, (void *) name.c_str());
+    }
+  }
+
+  benchmark::DoNotOptimize(found);
+  hashtable_destroy(hashtable);
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_HashtableInsertRetrieveDelete)->Arg(4)->Arg(16)->Arg(256);
+
+/* ************************************************** */
+/* ************************************************** */
+// the fields a packet carries through a typical stack: add each, then read each one
+static void BM_PacketFieldsByName(benchmark::State &state){
+  micro_benchmark_init();
+  std::vector<std::string> names = field_names(state.range(0));
+  call_t to = {-1, -1};
+  int64_t sum = 0;
+
+  for (auto _ : state){
+    packet_t *packet = packet_create(&to, 127, -1);
+    for (size_t i = 0; i < names.size(); i++){
+      packet_add_field(packet, (char *) names[i].c_str(), field_int(i));
+    }
+    for (auto &name : names){
+      sum += *(const int *) packet_get_field_value_ptr(packet, (char *) name.c_str());
+    }
+    packet_dealloc(packet);
+  }
+
+  benchmark::DoNotOptimize(sum);
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_PacketFieldsByName)->Arg(4)->Arg(16);
+
+static void BM_PacketFieldsByKey(benchmark::State &state){
+  micro_benchmark_init();
+  std::vector<std::string> names = field_names(state.range(0));
+  std::vector<field_key_t> keys;
+  call_t to = {-1, -1};
+  int64_t sum = 0;
+
+  for (auto &name : names){
+    keys.push_back(packet_field_key((char *) name.c_str()));
+  }
+
+  for (auto _ : state){
+    packet_t *packet = packet_create(&to, 127, -1);
+    for (size_t i = 0; i < keys.size(); i++){
+      packet_add_field_by_key(packet, keys[i], field_int(i));
+    }
+    for (auto key : keys){
+      sum += *(const int *) packet_get_field_by_key(packet, key)->value;
+    }
+    packet_dealloc(packet);
+  }
+
+  benchmark::DoNotOptimize(sum);
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_PacketFieldsByKey)->Arg(4)->Arg(16);
@@ -0,0 +1,52 @@
+/**
+ *  \file   interference_accumulator_benchmark.cc
+ *  \brief  Interference accumulator micro benchmarks
+ *  \author agent
+ *  \date   2026
+ **/
+
+#include <deque>
+#include <random>
+
+#include <benchmark/benchmark.h>
+
+#include <kernel/include/data_structures/interference_accumulator/interference_accumulator.h>
+
+/* ************************************************** */
+/* ************************************************** */
+#define INTERFERENCE_DURATION 1000000 // 1 ms
+
+// steady state of a receiver with state.range(0) concurrent packets: each packet
+// is added at carrier sense, and its maximum interference computed at reception
+static void BM_InterferenceAccumulatorReception(benchmark::State &state){
+  // slices are never released, a single one is declared for all the runs
+  static int initialized = interference_accumulator_init();
+  std::mt19937 generator(1234);
+  std::uniform_int_distribution<uint64_t> duration(INTERFERENCE_DURATION / 2, INTERFERENCE_DURATION);
+  double power[INTERFERENCE_CHANNELS] = {1e-9};
+  std::deque<std::pair<uint64_t, uint64_t>> packets;
+  uint64_t gap = INTERFERENCE_DURATION / state.range(0);
+  interference_accumulator_t accumulator;
+  uint64_t now = 0;
+
+  benchmark::DoNotOptimize(initialized);
+  interference_accumulator_setup(&accumulator);
+
+  for (auto _ : state){
+    // packets are received about in the order they were sensed
+    while (!packets.empty() && packets.front().second <= now){
+      benchmark::DoNotOptimize(interference_accumulator_max(&accumulator, 0, packets.front().first, packets.front().second));
+      interference_accumulator_release(&accumulator, packets.front().first, packets.front().second);
+      packets.pop_front();
+    }
+
+    packets.emplace_back(now, now + duration(generator));
+    interference_accumulator_add(&accumulator, packets.back().first, packets.back().second, power);
+    now += gap;
+  }
+
+  state.counters["segments"] = interference_accumulator_size(&accumulator);
+  interference_accumulator_clear(&accumulator);
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_InterferenceAccumulatorReception)->Arg(1)->Arg(16)->Arg(256)->Arg(4096);
@@ -0,0 +1,70 @@
+/**
+ *  \file   interference_model_benchmark.cc
+ *  \brief  RF signal interference model micro benchmarks
+ *  \author agent
+ *  \date   2026
+ **/
+
+#include <cmath>
+#include <memory>
+#include <random>
+
+#include <benchmark/benchmark.h>
+
+// the noise is not the one of a simulation, the model is benchmarked alone
+#include <tests/include/fakes/model_handlers/noise.h>
+
+#include "rf_signal_interference.cc"
+
+/* ************************************************** */
+/* ************************************************** */
+#define INTERFERENCE_MODEL_BAND_LOW      868000000.0 // 868 MHz
+#define INTERFERENCE_MODEL_BANDWIDTH     125000.0    // 125 kHz
+#define INTERFERENCE_MODEL_CHANNELS      8
+#define INTERFERENCE_MODEL_ADJACENT      2           // adjacent bands on each side
+#define INTERFERENCE_MODEL_DURATION      100000000   // 100 ms
+
+// a signal of a channel, with its adjacent bands, as sent by the adjacent band phy
+static std::shared_ptr<RFSignal> interference_model_signal(int channel, Time begin){
+  auto waveform = std::make_shared<Waveform>();
+  double center = INTERFERENCE_MODEL_BAND_LOW + channel * INTERFERENCE_MODEL_BANDWIDTH;
+  double psd = 1e-9;
+
+  for (int band = -INTERFERENCE_MODEL_ADJACENT; band <= INTERFERENCE_MODEL_ADJACENT; band++){
+    double low = center + (band - 0.5) * INTERFERENCE_MODEL_BANDWIDTH;
+    auto freq = std::make_shared<FrequencyIntervalWaveform>(low, low + INTERFERENCE_MODEL_BANDWIDTH, low + INTERFERENCE_MODEL_BANDWIDTH / 2,
+                                                            band ? psd / (4 * std::abs(band)) : psd);
+    waveform->AddFrequencyInterval(freq);
+    freq->AddToWaveform(waveform);
+  }
+
+  auto signal = std::make_shared<RFSignal>(channel, waveform);
+  waveform->SetSignal(signal);
+  signal->SetBegin(begin);
+  signal->SetEnd(begin + INTERFERENCE_MODEL_DURATION);
+  return signal;
+}
+
+// SINR of a signal received along with state.range(0) signals, on random channels and times
+static void BM_RFSignalInterferenceApply(benchmark::State &state){
+  std::mt19937 generator(1234);
+  std::uniform_int_distribution<int> channel(0, INTERFERENCE_MODEL_CHANNELS - 1);
+  std::uniform_int_distribution<Time> begin(0, 2 * INTERFERENCE_MODEL_DURATION);
+  RFSignalInterferenceModel model;
+  MapOfSignals received_signals;
+
+  auto desired_signal = interference_model_signal(INTERFERENCE_MODEL_CHANNELS / 2, INTERFERENCE_MODEL_DURATION);
+  received_signals.insert(std::make_pair(desired_signal->GetUID(), desired_signal));
+  for (int i = 0; i < state.range(0); i++){
+    auto signal = interference_model_signal(channel(generator), begin(generator));
+    received_signals.insert(std::make_pair(signal->GetUID(), signal));
+  }
+
+  for (auto _ : state){
+    model.ApplyInterference(desired_signal, received_signals);
+    benchmark::DoNotOptimize(desired_signal->GetSINR());
+  }
+
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_RFSignalInterferenceApply)->Arg(1)->Arg(10)->Arg(100)->Arg(1000);
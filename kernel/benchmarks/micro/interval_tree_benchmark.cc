@@ -0,0 +1,157 @@
+/**
+ *  \file   interval_tree_benchmark.cc
+ *  \brief  Interval tree micro benchmarks, for each implementation
+ *  \author agent
+ *  \date   2026
+ **/
+
+#include <iostream>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <kernel/include/definitions/types/interval/frequency_interval.h>
+#include <kernel/include/data_structures/interval_tree/redblack_interval_tree.h>
+#include <kernel/include/data_structures/interval_tree/flat_interval_tree.h>
+
+/* ************************************************** */
+/* ************************************************** */
+#define INTERVAL_BAND_LOW   2400000000.0 // 2.4 GHz
+#define INTERVAL_BAND_WIDTH 100000000.0  // 100 MHz
+#define INTERVAL_MAX_WIDTH  5000000.0    // 5 MHz
+
+// random intervals of the 2.4 GHz band, the same ones for every run
+static SetOfFrequencyIntervals interval_create(int nbr_intervals, unsigned seed){
+  std::mt19937 rng(seed);
+  std::uniform_real_distribution<double> low(INTERVAL_BAND_LOW, INTERVAL_BAND_LOW + INTERVAL_BAND_WIDTH);
+  std::uniform_real_distribution<double> width(1, INTERVAL_MAX_WIDTH);
+  SetOfFrequencyIntervals intervals;
+
+  intervals.reserve(nbr_intervals);
+  for (int i = 0; i < nbr_intervals; i++){
+    double point = low(rng);
+    intervals.push_back(std::make_shared<FrequencyInterval>(point, point + width(rng)));
+  }
+  return intervals;
+}
+
+/* ************************************************** */
+/* ************************************************** */
+template <class Tree>
+static void BM_IntervalTreeInsert(benchmark::State &state){
+  SetOfFrequencyIntervals intervals = interval_create(state.range(0), 1);
+
+  for (auto _ : state){
+    Tree tree;
+    for (auto &interval : intervals){
+      tree.Insert(interval);
+    }
+    benchmark::ClobberMemory();
+  }
+
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK_TEMPLATE(BM_IntervalTreeInsert, RedBlackIntervalTree)->RangeMultiplier(10)->Range(100, 10000);
+BENCHMARK_TEMPLATE(BM_IntervalTreeInsert, FlatIntervalTree)->RangeMultiplier(10)->Range(100, 10000);
+
+// one insertion and one deletion in a tree of constant size
+template <class Tree>
+static void BM_IntervalTreeInsertDelete(benchmark::State &state){
+  SetOfFrequencyIntervals intervals = interval_create(state.range(0), 1);
+  SetOfFrequencyIntervals others = interval_create(state.range(0), 2);
+  Tree tree;
+  size_t i = 0;
+
+  for (auto &interval : intervals){
+    tree.Insert(interval);
+  }
+
+  for (auto _ : state){
+    tree.Insert(others[i]);
+    tree.Delete(intervals[i]);
+    std::swap(intervals[i], others[i]);
+    i = (i + 1) % intervals.size();
+  }
+
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK_TEMPLATE(BM_IntervalTreeInsertDelete, RedBlackIntervalTree)->RangeMultiplier(10)->Range(100, 10000);
+BENCHMARK_TEMPLATE(BM_IntervalTreeInsertDelete, FlatIntervalTree)->RangeMultiplier(10)->Range(100, 10000);
+
+template <class Tree>
+static void BM_IntervalTreeFindAllIntersections(benchmark::State &state){
+  SetOfFrequencyIntervals intervals = interval_create(state.range(0), 1);
+  SetOfFrequencyIntervals queries = interval_create(1024, 3);
+  Tree tree;
+  size_t i = 0;
+  int64_t found = 0;
+
+  for (auto &interval : intervals){
+    tree.Insert(interval);
+  }
+
+  for (auto _ : state){
+    auto intersections = tree.FindAllIntersections(queries[i]);
+    found += intersections.size();
+    i = (i + 1) % queries.size();
+  }
+
+  state.SetItemsProcessed(state.iterations());
+  state.counters["intersections"] = benchmark::Counter(found, benchmark::Counter::kAvgIterations);
+}
+BENCHMARK_TEMPLATE(BM_IntervalTreeFindAllIntersections, RedBlackIntervalTree)->RangeMultiplier(10)->Range(100, 10000);
+BENCHMARK_TEMPLATE(BM_IntervalTreeFindAllIntersections, FlatIntervalTree)->RangeMultiplier(10)->Range(100, 10000);
+
+// same queries, visiting the intervals without building any container
+template <class Tree>
+static void BM_IntervalTreeForEachIntersection(benchmark::State &state){
+  SetOfFrequencyIntervals intervals = interval_create(state.range(0), 1);
+  SetOfFrequencyIntervals queries = interval_create(1024, 3);
+  Tree tree;
+  size_t i = 0;
+  int64_t found = 0;
+
+  for (auto &interval : intervals){
+    tree.Insert(interval);
+  }
+
+  for (auto _ : state){
+    tree.ForEachIntersection(queries[i]->GetLowPoint(), queries[i]->GetHighPoint(),
+                             [&found](const std::weak_ptr<Interval> &){ found++; });
+    i = (i + 1) % queries.size();
+  }
+
+  state.SetItemsProcessed(state.iterations());
+  state.counters["intersections"] = benchmark::Counter(found, benchmark::Counter::kAvgIterations);
+}
+BENCHMARK_TEMPLATE(BM_IntervalTreeForEachIntersection, RedBlackIntervalTree)->RangeMultiplier(10)->Range(100, 10000);
+BENCHMARK_TEMPLATE(BM_IntervalTreeForEachIntersection, FlatIntervalTree)->RangeMultiplier(10)->Range(100, 10000);
+
+// same queries, appending the intervals to a reused vector
+template <class Tree>
+static void BM_IntervalTreeFindAllIntersectionsVector(benchmark::State &state){
+  SetOfFrequencyIntervals intervals = interval_create(state.range(0), 1);
+  SetOfFrequencyIntervals queries = interval_create(1024, 3);
+  std::vector<std::weak_ptr<Interval>> intersections;
+  Tree tree;
+  size_t i = 0;
+  int64_t found = 0;
+
+  for (auto &interval : intervals){
+    tree.Insert(interval);
+  }
+
+  for (auto _ : state){
+    intersections.clear();
+    tree.FindAllIntersections(queries[i]->GetLowPoint(), queries[i]->GetHighPoint(), intersections);
+    found += intersections.size();
+    i = (i + 1) % queries.size();
+  }
+
+  state.SetItemsProcessed(state.iterations());
+  state.counters["intersections"] = benchmark::Counter(found, benchmark::Counter::kAvgIterations);
+}
+BENCHMARK_TEMPLATE(BM_IntervalTreeFindAllIntersectionsVector, RedBlackIntervalTree)->RangeMultiplier(10)->Range(100, 10000);
+BENCHMARK_TEMPLATE(BM_IntervalTreeFindAllIntersectionsVector, FlatIntervalTree)->RangeMultiplier(10)->Range(100, 10000);
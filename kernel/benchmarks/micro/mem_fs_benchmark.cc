@@ -0,0 +1,55 @@
+/**
+ *  \file   mem_fs_benchmark.cc
+ *  \brief  Memory slices micro benchmarks, against the system allocator
+ *  \author agent
+ *  \date   2026
+ **/
+
+#include <stdlib.h>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <kernel/include/data_structures/mem_fs/mem_fs.h>
+
+/* ************************************************** */
+/* ************************************************** */
+#define MEM_FS_BATCH 1024
+#define MEM_FS_SIZE  64 // about a packet header
+
+// a burst of allocations followed by the deallocations, as for the packets of a transmission
+static void BM_MemFsAllocFree(benchmark::State &state){
+  // slices are never released, a single one is declared for all the runs
+  static void *slice = mem_fs_slice_declare(MEM_FS_SIZE);
+  std::vector<void *> pointers(MEM_FS_BATCH);
+
+  for (auto _ : state){
+    for (auto &pointer : pointers){
+      pointer = mem_fs_alloc(slice);
+    }
+    benchmark::DoNotOptimize(pointers.data());
+    for (auto pointer : pointers){
+      mem_fs_dealloc(slice, pointer);
+    }
+  }
+
+  state.SetItemsProcessed(state.iterations() * MEM_FS_BATCH);
+}
+BENCHMARK(BM_MemFsAllocFree);
+
+static void BM_MallocFree(benchmark::State &state){
+  std::vector<void *> pointers(MEM_FS_BATCH);
+
+  for (auto _ : state){
+    for (auto &pointer : pointers){
+      pointer = malloc(MEM_FS_SIZE);
+    }
+    benchmark::DoNotOptimize(pointers.data());
+    for (auto pointer : pointers){
+      free(pointer);
+    }
+  }
+
+  state.SetItemsProcessed(state.iterations() * MEM_FS_BATCH);
+}
+BENCHMARK(BM_MallocFree);
@@ -0,0 +1,25 @@
+/**
+ *  \file   micro_benchmark.h
+ *  \brief  Common initialization of the micro benchmarks
+ *  \author agent
+ *  \date   2026
+ **/
+
+#ifndef WSNET_KERNEL_BENCHMARKS_MICRO_MICRO_BENCHMARK_H_
+#define WSNET_KERNEL_BENCHMARKS_MICRO_MICRO_BENCHMARK_H_
+
+#include <kernel/include/data_structures/hashtable/hashtable.h>
+#include <kernel/include/definitions/packet.h>
+
+/** \brief Initialize the kernel modules used by the micro benchmarks, once for all of them
+ *         (the mem_fs slices are never released)
+ **/
+inline void micro_benchmark_init(void){
+  static bool initialized = [](){
+    hashtable_init();
+    return packet_init() == 0;
+  }();
+  (void) initialized;
+}
+
+#endif //WSNET_KERNEL_BENCHMARKS_MICRO_MICRO_BENCHMARK_H_
@@ -0,0 +1,101 @@
+/**
+ *  \file   packet_benchmark.cc
+ *  \brief  Packet micro benchmarks
+ *  \author agent
+ *  \date   2026
+ **/
+
+#include <stdlib.h>
+#include <string>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <kernel/benchmarks/micro/micro_benchmark.h>
+#include <kernel/include/definitions/packet.h>
+
+/* ************************************************** */
+/* ************************************************** */
+#define PACKET_FIELDS 4 // app, routing, mac and phy headers
+
+static packet_t *packet_with_fields(void){
+  call_t to = {-1, -1};
+  packet_t *packet = packet_create(&to, 127, -1);
+
+  for (int i = 0; i < PACKET_FIELDS; i++){
+    std::string name = "benchmark_header_" + std::to_string(i);
+    int *value = (int *) malloc(sizeof(int));
+    *value = i;
+    packet_add_field(packet, (char *) name.c_str(), field_create(INT, sizeof(int), value));
+  }
+  return packet;
+}
+
+/* ************************************************** */
+/* ************************************************** */
+// one copy of the transmitted packet per receiver, as done by the medium
+static void BM_PacketRxclone(benchmark::State &state){
+  micro_benchmark_init();
+  packet_t *packet = packet_with_fields();
+  std::vector<packet_t *> receptions(state.range(0));
+
+  for (auto _ : state){
+    for (auto &reception : receptions){
+      reception = packet_rxclone(packet);
+    }
+    for (auto reception : receptions){
+      packet_dealloc(reception);
+    }
+  }
+
+  packet_dealloc(packet);
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_PacketRxclone)->Arg(10)->Arg(100);
+
+static void BM_PacketClone(benchmark::State &state){
+  micro_benchmark_init();
+  packet_t *packet = packet_with_fields();
+  std::vector<packet_t *> clones(state.range(0));
+
+  for (auto _ : state){
+    for (auto &clone : clones){
+      clone = packet_clone(packet);
+    }
+    for (auto clone : clones){
+      packet_dealloc(clone);
+    }
+  }
+
+  packet_dealloc(packet);
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_PacketClone)->Arg(10)->Arg(100);
+
+// read access to the last header, by name as most models do, and by key
+static void BM_PacketGetFieldByName(benchmark::State &state){
+  micro_benchmark_init();
+  packet_t *packet = packet_with_fields();
+  std::string name = "benchmark_header_" + std::to_string(PACKET_FIELDS - 1);
+
+  for (auto _ : state){
+    benchmark::DoNotOptimize(packet_get_field(packet, (char *) name.c_str()));
+  }
+
+  packet_dealloc(packet);
+}
+BENCHMARK(BM_PacketGetFieldByName);
+
+static void BM_PacketGetFieldByKey(benchmark::State &state){
+  micro_benchmark_init();
+  packet_t *packet = packet_with_fields();
+  std::string name = "benchmark_header_" + std::to_string(PACKET_FIELDS - 1);
+  field_key_t key = packet_field_key((char *) name.c_str());
+
+  for (auto _ : state){
+    benchmark::DoNotOptimize(packet_get_field_by_key(packet, key));
+  }
+
+  packet_dealloc(packet);
+}
+BENCHMARK(BM_PacketGetFieldByKey);
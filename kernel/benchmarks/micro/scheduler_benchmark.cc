@@ -0,0 +1,87 @@
+/**
+ *  \file   scheduler_benchmark.cc
+ *  \brief  Scheduler micro benchmarks
+ *      Classic hold model: a fixed population of callbacks, each one
+ *      rescheduling itself at a random date when executed, so that the
+ *      queue size stays constant while the events are executed.
+ *  \author agent
+ *  \date   2026
+ **/
+
+#include <iostream>
+#include <random>
+#include <sstream>
+#include <memory>
+
+#include <benchmark/benchmark.h>
+
+#include <kernel/include/scheduler/scheduler.h>
+#include <kernel/include/scheduler/scheduler_standard_containers.h>
+#include <kernel/include/scheduler/scheduler_calendar_queue.h>
+#include <kernel/include/scheduler/scheduler_partitioned.h>
+
+/* ************************************************** */
+/* ************************************************** */
+#define HOLD_MAX_DELAY  100000 // 100 us
+#define HOLD_EVENTS     1000000
+
+static Scheduler *hold_scheduler = nullptr;
+static std::mt19937_64 hold_rng;
+
+static int hold_callback(call_t *to, call_t *from, void *arg){
+  hold_scheduler->AddCallback(hold_scheduler->SimulationTimeGet() + 1 + hold_rng() % HOLD_MAX_DELAY,
+                              *to, *from, hold_callback, arg);
+  return 0;
+}
+
+static std::unique_ptr<Scheduler> hold_create(const std::string &type){
+  if (type == SCHEDULER_TYPE_CALENDAR){
+    return std::make_unique<SchedulerCalendarQueue>();
+  } else if (type == SCHEDULER_TYPE_PARTITIONED){
+    return std::make_unique<SchedulerPartitioned>(SCHEDULER_DEFAULT_PARTITIONS, false);
+  }
+  return std::make_unique<SchedulerStandardContainers>();
+}
+
+/* ************************************************** */
+/* ************************************************** */
+static void BM_SchedulerHold(benchmark::State &state, const std::string &type){
+  int population = state.range(0);
+  int64_t executed = 0;
+  call_t to = {-1, -1};
+  std::ostringstream stats;
+
+  for (auto _ : state){
+    state.PauseTiming();
+    std::unique_ptr<Scheduler> scheduler = hold_create(type);
+    hold_scheduler = scheduler.get();
+    hold_rng.seed(1);
+    for (int i = 0; i < population; i++){
+      scheduler->AddCallback(hold_rng() % HOLD_MAX_DELAY, to, to, hold_callback, nullptr);
+    }
+    // same number of events whatever the population
+    scheduler->AddQuit((Time) HOLD_MAX_DELAY / 2 * HOLD_EVENTS / population);
+    // the simulation stats are not part of the benchmark output
+    std::streambuf *cout_buffer = std::cout.rdbuf(stats.rdbuf());
+    state.ResumeTiming();
+
+    scheduler->SimulationRun();
+
+    state.PauseTiming();
+    std::cout.rdbuf(cout_buffer);
+    stats.str("");
+    executed += scheduler->CountEventsExecuted();
+    scheduler.reset();
+    hold_scheduler = nullptr;
+    state.ResumeTiming();
+  }
+
+  state.SetItemsProcessed(executed);
+}
+
+BENCHMARK_CAPTURE(BM_SchedulerHold, standard, std::string(SCHEDULER_TYPE_STANDARD))
+    ->RangeMultiplier(10)->Range(1000, 100000)->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(BM_SchedulerHold, calendar, std::string(SCHEDULER_TYPE_CALENDAR))
+    ->RangeMultiplier(10)->Range(1000, 100000)->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(BM_SchedulerHold, partitioned, std::string(SCHEDULER_TYPE_PARTITIONED))
+    ->RangeMultiplier(10)->Range(1000, 100000)->Unit(benchmark::kMillisecond);
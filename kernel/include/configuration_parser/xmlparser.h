@@ -176,6 +176,9 @@
 #define XML_A_ENVIRONMENT        "environment"
 #define XML_A_NBR_NODES          "nbr_nodes"
 #define XML_A_TYPE			     "type"
+#define XML_A_SCHEDULER          "scheduler"
+#define XML_A_PARTITIONS         "partitions"
+#define XML_A_TRACE              "trace"
 
 
 /*********************/
@@ -249,6 +252,8 @@ extern "C"{
 void config_set_configfile    (char *c);
 void config_set_schemafile    (char *c);
 void config_set_sys_modulesdir(char *c);
+void config_set_scheduler    (char *c);
+char *config_get_scheduler   (void);
 int  do_configuration         (void);
 
 dflt_param_t *get_class_params(nodeid_t node, classid_t class, nodearchid_t nodearch,
@@ -0,0 +1,127 @@
+/**
+ *  \file   interference_accumulator.h
+ *  \brief  Time-indexed interference accumulator
+ *
+ *          The interference seen by a receiver is a step function of time,
+ *          one value per channel. It is stored as contiguous segments
+ *          [begin, end) of constant power kept in a treap ordered by time.
+ *          Each subtree knows its maximum power and its energy (power times
+ *          duration), and additions over a time range are applied lazily,
+ *          so adding a signal and asking for the maximum or average power
+ *          over [t0, t1) cost O(log k) for k segments.
+ *
+ *          Each segment also counts the signals that have not been released
+ *          yet. When a signal is released and no signal is active any more
+ *          at its end, the segments before its end are freed.
+ *
+ *  \author agent
+ *  \date   2026
+ **/
+#ifndef WSNET_CORE_DATA_STRUCTURE_INTERFERENCE_ACCUMULATOR_H_
+#define WSNET_CORE_DATA_STRUCTURE_INTERFERENCE_ACCUMULATOR_H_
+
+#include <stdint.h>
+
+#include <kernel/include/options.h>
+
+
+/* ************************************************** */
+/* ************************************************** */
+/** \def INTERFERENCE_CHANNELS
+ * \brief The number of channels of an accumulator.
+ **/
+#define INTERFERENCE_CHANNELS CHANNELS_NUMBER
+
+typedef struct _interference_segment interference_segment_t;
+
+typedef struct _interference_accumulator {
+  interference_segment_t *root;
+  uint64_t                begin; /* begin of the first segment */
+  uint64_t                end;   /* end of the last segment */
+  int                     size;  /* number of segments */
+  uint32_t                seed;  /* state of the priorities generator */
+} interference_accumulator_t;
+
+
+#ifdef __cplusplus
+extern "C"{
+#endif //__cplusplus
+/* ************************************************** */
+/* ************************************************** */
+/**
+ * \brief Declare the memory used by the accumulators segments.
+ * \return 0 in case of success, -1 else.
+ **/
+int interference_accumulator_init(void);
+
+/**
+ * \brief Set up an empty accumulator.
+ * \param accumulator the accumulator.
+ **/
+void interference_accumulator_setup(interference_accumulator_t *accumulator);
+
+/**
+ * \brief Free all the segments of an accumulator, which is left empty.
+ * \param accumulator the accumulator.
+ **/
+void interference_accumulator_clear(interference_accumulator_t *accumulator);
+
+/**
+ * \brief Add a signal to the interference over [begin, end).
+ * \param accumulator the accumulator.
+ * \param begin, end the time range of the signal.
+ * \param power the power added on each of the INTERFERENCE_CHANNELS channels.
+ **/
+void interference_accumulator_add(interference_accumulator_t *accumulator, uint64_t begin, uint64_t end, const double *power);
+
+/**
+ * \brief Release a signal previously added over [begin, end).
+ *
+ *        The power of the signal is kept, as it still interferes with the signals
+ *        overlapping it. If no signal is active any more at end, the segments
+ *        before end are freed: end must not be after the current time.
+ *
+ * \param accumulator the accumulator.
+ * \param begin, end the time range of the signal.
+ **/
+void interference_accumulator_release(interference_accumulator_t *accumulator, uint64_t begin, uint64_t end);
+
+/**
+ * \brief Return the maximum interference over [t0, t1) on a channel.
+ * \param accumulator the accumulator.
+ * \param channel the channel.
+ * \param t0, t1 the time range.
+ * \return The maximum power, times without segment counting as 0.
+ **/
+double interference_accumulator_max(interference_accumulator_t *accumulator, int channel, uint64_t t0, uint64_t t1);
+
+/**
+ * \brief Return the average interference over [t0, t1) on a channel.
+ * \param accumulator the accumulator.
+ * \param channel the channel.
+ * \param t0, t1 the time range.
+ * \return The average power, times without segment counting as 0.
+ **/
+double interference_accumulator_average(interference_accumulator_t *accumulator, int channel, uint64_t t0, uint64_t t1);
+
+/**
+ * \brief Return the interference of the first segment ending after a time on a channel.
+ * \param accumulator the accumulator.
+ * \param channel the channel.
+ * \param time the time.
+ * \return The power, 0 if all the segments end before time.
+ **/
+double interference_accumulator_value(interference_accumulator_t *accumulator, int channel, uint64_t time);
+
+/**
+ * \brief Return the number of segments of an accumulator.
+ * \param accumulator the accumulator.
+ * \return The number of segments.
+ **/
+int interference_accumulator_size(interference_accumulator_t *accumulator);
+
+#ifdef __cplusplus
+}
+#endif //__cplusplus
+
+#endif // WSNET_CORE_DATA_STRUCTURE_INTERFERENCE_ACCUMULATOR_H_
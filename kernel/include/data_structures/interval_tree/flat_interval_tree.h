@@ -0,0 +1,75 @@
+/**
+ *  \file   flat_interval_tree.h
+ *  \brief  FlatIntervalTree Concrete Class definition
+ *  \author agent
+ *  \date   2026
+ *  \version 1.0
+ **/
+
+#ifndef WSNET_CORE_DATA_STRUCTURE_INTERVAL_TREE_FLAT_INTERVAL_TREE_H_
+#define WSNET_CORE_DATA_STRUCTURE_INTERVAL_TREE_FLAT_INTERVAL_TREE_H_
+
+#include <list>
+#include <vector>
+
+#include <kernel/include/definitions/types/interval/interval.h>
+#include <kernel/include/data_structures/interval_tree/interval_tree.h>
+
+// the implicit tree is perfectly balanced, its height is at most log2(n)+1
+#define FLAT_INTERVAL_TREE_MAX_HEIGHT 64
+#define FLAT_INTERVAL_TREE_DELETED UINT32_MAX
+
+/** \brief The Concrete Class : FlatIntervalTree Class
+ *
+ * It is the implementation of the IntervalTree for intervals inserted rarely
+ * and queried constantly, as the frequency intervals of the spectrum.
+ *
+ * The intervals are kept sorted by low point in a struct of arrays
+ * (low, high, max_high, payload index). The sorted arrays are an implicit
+ * balanced binary tree: the element in the middle of a range is the root of
+ * the range, max_high being the highest point of the range. A query walks it
+ * in order with a fixed size stack, the memory being read by increasing address.
+ *
+ * Insertions and deletions are buffered: the inserted intervals are sorted
+ * and merged, the deleted ones removed and the max_high fields rebuilt at the
+ * next query, in O(n + k log k) for k changes. This is fine as long as the
+ * intervals change much less often than they are queried.
+ **/
+class FlatIntervalTree : public IntervalTree{
+  public:
+    FlatIntervalTree();
+    ~FlatIntervalTree();
+  private:
+    typedef uint32_t PayloadIndex;
+
+    std::list<std::weak_ptr<Interval>> FindAllIntersectionsImpl(std::weak_ptr<Interval>);
+    void VisitAllIntersectionsImpl(IntervalBoundary, IntervalBoundary, IntervalVisitor &);
+    void DeleteImpl(std::weak_ptr<Interval>);
+    void InsertImpl(std::weak_ptr<Interval>);
+    struct Element {
+      IntervalBoundary low_;
+      IntervalBoundary high_;
+      PayloadIndex payload_;
+    };
+
+    template <typename Function>
+    void ForEachIndexIntersection(IntervalBoundary, IntervalBoundary, Function &&);
+    void Update();
+    IntervalBoundary UpdateMaxHigh(size_t begin, size_t end);
+
+    // the implicit tree, sorted by low point
+    std::vector<IntervalBoundary> lows_;
+    std::vector<IntervalBoundary> highs_;
+    std::vector<IntervalBoundary> max_highs_;
+    std::vector<PayloadIndex> payloads_;  // FLAT_INTERVAL_TREE_DELETED once deleted
+    std::vector<Element> inserted_;       // not merged yet in the tree
+    size_t nbr_deleted_;                  // not removed yet from the tree
+    bool outdated_;                       // the tree is to be updated before the next query
+
+    // the intervals, not moved when the tree changes
+    std::vector<std::weak_ptr<Interval>> intervals_;
+    std::vector<IntervalUid> uids_;
+    std::vector<PayloadIndex> free_payloads_;
+};
+
+#endif // WSNET_CORE_DATA_STRUCTURE_INTERVAL_TREE_FLAT_INTERVAL_TREE_H_
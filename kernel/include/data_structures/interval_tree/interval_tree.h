@@ -11,14 +11,51 @@
 
 #include <list>
 #include <memory>
+#include <vector>
 #include <kernel/include/definitions/types/interval/interval.h>
 
+#define INTERVAL_TREE_TYPE_REDBLACK "redblack" // augmented red-black tree, for intervals changing often
+#define INTERVAL_TREE_TYPE_FLAT "flat"         // sorted arrays, for intervals inserted rarely and queried constantly
+
+/** \brief The Abstract Base Class : IntervalVisitor Class
+ *
+ * Called on each interval found by a query, without copying the intervals
+ * or building any intermediate container.
+ *
+ * \fn Visit - called once for each interval found
+ **/
+class IntervalVisitor {
+  public:
+    virtual ~IntervalVisitor(){};
+    virtual void Visit(const std::weak_ptr<Interval> &interval) = 0;
+};
+
+/** \brief The Concrete Class : IntervalVisitorFunction Class
+ *
+ * Adapts any callable taking a const std::weak_ptr<Interval>& to a visitor,
+ * the callable being referred to, not copied.
+ **/
+template <typename Function>
+class IntervalVisitorFunction : public IntervalVisitor {
+  public:
+    IntervalVisitorFunction(Function &function) : function_(function){};
+    void Visit(const std::weak_ptr<Interval> &interval) {function_(interval);};
+  private:
+    Function &function_;
+};
+
 /** \brief The Abstract Base Class : IntervalTree Class
  *
  * \fn Delete - deletes an interval from the tree
  * \fn Insert - inserts an interval in the tree
  * \fn GetSize - return the current size of the interval tree
- * \fn FindAllIntersections - return the intervals that intersect the given interval
+ * \fn FindAllIntersections - return the intervals that intersect the given interval,
+ *     or append the ones that intersect [low,high] to a vector
+ * \fn VisitAllIntersections - call a visitor on each interval that intersects [low,high]
+ * \fn ForEachIntersection - call a function on each interval that intersects [low,high]
+ *
+ * VisitAllIntersections and ForEachIntersection do not allocate: they are to be
+ * preferred on the hot paths, FindAllIntersections being kept for convenience.
  **/
 class IntervalTree {
   public:
@@ -28,10 +65,21 @@ class IntervalTree {
     void Insert(std::weak_ptr<Interval> interval) {InsertImpl(interval);};
     uint GetSize() {return size_;};
     std::list<std::weak_ptr<Interval>> FindAllIntersections(std::weak_ptr<Interval> interval) {return FindAllIntersectionsImpl(interval);} ;
+    void FindAllIntersections(IntervalBoundary low, IntervalBoundary high, std::vector<std::weak_ptr<Interval>> &intersections) {
+      auto append = [&intersections](const std::weak_ptr<Interval> &interval){intersections.push_back(interval);};
+      ForEachIntersection(low, high, append);
+    };
+    void VisitAllIntersections(IntervalBoundary low, IntervalBoundary high, IntervalVisitor &visitor) {VisitAllIntersectionsImpl(low, high, visitor);};
+    template <typename Function>
+    void ForEachIntersection(IntervalBoundary low, IntervalBoundary high, Function &&function) {
+      IntervalVisitorFunction<Function> visitor(function);
+      VisitAllIntersectionsImpl(low, high, visitor);
+    };
   private:
     virtual void DeleteImpl(std::weak_ptr<Interval>) = 0;
     virtual void InsertImpl(std::weak_ptr<Interval>) = 0;
     virtual std::list<std::weak_ptr<Interval>> FindAllIntersectionsImpl(std::weak_ptr<Interval>) = 0;
+    virtual void VisitAllIntersectionsImpl(IntervalBoundary, IntervalBoundary, IntervalVisitor &) = 0;
   protected:
     uint size_;
 };
@@ -11,14 +11,17 @@
 
 #include <list>
 #include <vector>
-#include <map>
 
 #include <kernel/include/definitions/types/interval/interval.h>
 #include <kernel/include/data_structures/interval_tree/interval_tree.h>
 #include <kernel/include/data_structures/interval_tree/redblack_interval_tree_element.h>
+// the height of a red-black tree is at most 2*log2(n+1), bounding the stack of the iterative walks
+#define REDBLACK_INTERVAL_TREE_MAX_HEIGHT 128
+
 /** \brief The Concrete Class : RedBlackIntervalTree Class
  *
  * It is the implementation of the IntervalTree using an Augmented RedBlack Tree.
+ * Queries walk the tree iteratively with a fixed size stack, without any allocation.
  **/
 class RedBlackIntervalTree : public IntervalTree{
   public:
@@ -32,10 +35,11 @@ class RedBlackIntervalTree : public IntervalTree{
     RedBlackIntervalTreeElement * nil_;
     RedBlackIntervalTreeElement * GetPredecessorOf(RedBlackIntervalTreeElement *) const;
     RedBlackIntervalTreeElement * GetSuccessorOf(RedBlackIntervalTreeElement *) const;
-    std::list<std::weak_ptr<Interval>> FindAllIntersectionsRecursive(RedBlackIntervalTreeElement *, IntervalBoundary, IntervalBoundary);
-    std::map<IntervalUid, RedBlackIntervalTreeElement*> FindAllElementsIntersectionRecursive(RedBlackIntervalTreeElement *, IntervalBoundary, IntervalBoundary);
+    template <typename Function>
+    void ForEachElementIntersection(IntervalBoundary, IntervalBoundary, Function &&);
     RedBlackIntervalTreeElement * FindInterval(std::weak_ptr<Interval>);
     std::list<std::weak_ptr<Interval>> FindAllIntersectionsImpl(std::weak_ptr<Interval>);
+    void VisitAllIntersectionsImpl(IntervalBoundary, IntervalBoundary, IntervalVisitor &);
     void DeleteImpl(std::weak_ptr<Interval>);
     void InsertImpl(std::weak_ptr<Interval>);
     void DeleteElement(RedBlackIntervalTreeElement *);
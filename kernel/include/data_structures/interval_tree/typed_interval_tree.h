@@ -0,0 +1,45 @@
+/**
+ *  \file   typed_interval_tree.h
+ *  \brief  TypedIntervalTree Template Class definition
+ *  \author agent
+ *  \date   2026
+ **/
+
+#ifndef WSNET_CORE_DATA_STRUCTURES_INTERVAL_TREE_TYPED_INTERVAL_TREE_H_
+#define WSNET_CORE_DATA_STRUCTURES_INTERVAL_TREE_TYPED_INTERVAL_TREE_H_
+
+#include <memory>
+#include <utility>
+#include <kernel/include/data_structures/interval_tree/interval_tree.h>
+
+/** \brief The Template Class : TypedIntervalTree Class
+ *
+ * An interval tree holding only intervals of type TInterval. As nothing else
+ * can be inserted, the intervals found by a query are given to the callers as
+ * TInterval without checking their type at run time.
+ *
+ * \fn Delete - deletes an interval from the tree
+ * \fn Insert - inserts an interval in the tree
+ * \fn GetSize - return the current size of the interval tree
+ * \fn ForEachIntersection - call a function taking a const std::shared_ptr<TInterval>&
+ *     on each interval that intersects [low,high]
+ **/
+template <class TInterval>
+class TypedIntervalTree {
+  public:
+    TypedIntervalTree(std::unique_ptr<IntervalTree> tree) : tree_(std::move(tree)){};
+    void Delete(const std::shared_ptr<TInterval> &interval) {tree_->Delete(interval);};
+    void Insert(const std::shared_ptr<TInterval> &interval) {tree_->Insert(interval);};
+    uint GetSize() {return tree_->GetSize();};
+    template <typename Function>
+    void ForEachIntersection(IntervalBoundary low, IntervalBoundary high, Function &&function) {
+      auto visit = [&function](const std::weak_ptr<Interval> &interval){
+        function(std::static_pointer_cast<TInterval>(interval.lock()));
+      };
+      tree_->ForEachIntersection(low, high, visit);
+    };
+  private:
+    std::unique_ptr<IntervalTree> tree_;
+};
+
+#endif // WSNET_CORE_DATA_STRUCTURES_INTERVAL_TREE_TYPED_INTERVAL_TREE_H_
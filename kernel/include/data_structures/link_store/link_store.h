@@ -0,0 +1,145 @@
+/**
+ *  \file   link_store.h
+ *  \brief  Sparse store of a value per (src, dst) link
+ *
+ *          Links between the nodes [0, node_cnt) are kept in compressed rows
+ *          (CSR): the links of a src are contiguous and sorted by dst, so a
+ *          lookup is a binary search in a row. Links that are not stored have
+ *          a default value. The store is filled with link_store_set(), then
+ *          link_store_finalize() builds the rows.
+ *
+ *          A finalized store can be saved to a binary file whose layout is the
+ *          one of the rows, so that it is memory-mapped and used as is:
+ *            header   link_store_header_t
+ *            offsets  uint64_t[node_cnt + 1], row of src is [offsets[src], offsets[src + 1])
+ *            dsts     uint32_t[link_cnt], padded to 8 bytes
+ *            values   double[link_cnt]
+ *          The file is in the host byte order.
+ *
+ *  \author agent
+ *  \date   2026
+ **/
+#ifndef WSNET_CORE_DATA_STRUCTURE_LINK_STORE_H_
+#define WSNET_CORE_DATA_STRUCTURE_LINK_STORE_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+
+/* ************************************************** */
+/* ************************************************** */
+/** \def LINK_STORE_MAGIC
+ * \brief The first bytes of a link store file.
+ **/
+#define LINK_STORE_MAGIC "WSNETLNK"
+
+/** \def LINK_STORE_VERSION
+ * \brief The version of the link store file layout.
+ **/
+#define LINK_STORE_VERSION 1
+
+typedef struct _link_store_header {
+  char     magic[8];
+  uint32_t version;
+  uint32_t node_cnt;
+  uint64_t link_cnt;
+  double   value_default;
+} link_store_header_t;
+
+typedef struct _link_store_link link_store_link_t;
+
+typedef struct _link_store {
+  int                node_cnt;
+  double             value_default;
+  uint64_t           link_cnt;
+  const uint64_t    *offsets;  /* NULL until the store is finalized */
+  const uint32_t    *dsts;
+  const double      *values;
+  link_store_link_t *links;    /* links set before finalization */
+  uint64_t           capacity;
+  void              *block;    /* header and rows, laid out as in a file */
+  size_t             block_size;
+  int                mapped;   /* 1 if the block is a file mapping */
+} link_store_t;
+
+
+#ifdef __cplusplus
+extern "C"{
+#endif //__cplusplus
+/* ************************************************** */
+/* ************************************************** */
+/**
+ * \brief Create an empty store.
+ * \param node_cnt the links src and dst are in [0, node_cnt).
+ * \param value_default the value of the links that are not stored.
+ * \return The new store, NULL in case of error.
+ **/
+link_store_t *link_store_create(int node_cnt, double value_default);
+
+/**
+ * \brief Free a store, or unmap it if it was loaded from a file.
+ * \param store the store.
+ **/
+void link_store_destroy(link_store_t *store);
+
+/**
+ * \brief Set the value of a link, before the store is finalized.
+ *        When a link is set several times, the last value is kept.
+ * \param store the store.
+ * \param src, dst the link.
+ * \param value the value.
+ * \return 0 in case of success, -1 else (out of range link or finalized store).
+ **/
+int link_store_set(link_store_t *store, int src, int dst, double value);
+
+/**
+ * \brief Build the rows of the links set so far. No link can be set afterwards.
+ * \param store the store.
+ * \return 0 in case of success, -1 else.
+ **/
+int link_store_finalize(link_store_t *store);
+
+/**
+ * \brief Return the value of a link of a finalized store.
+ * \param store the store.
+ * \param src, dst the link.
+ * \return The link value, the default value if it is not stored.
+ **/
+double link_store_get(link_store_t *store, int src, int dst);
+
+/**
+ * \brief Return the number of links stored.
+ * \param store the store.
+ * \return The number of links.
+ **/
+uint64_t link_store_size(link_store_t *store);
+
+/**
+ * \brief Save a finalized store to a binary file.
+ * \param store the store.
+ * \param path the file path.
+ * \return 0 in case of success, -1 else.
+ **/
+int link_store_save(link_store_t *store, const char *path);
+
+/**
+ * \brief Check whether a file is a link store file, from its first bytes.
+ * \param path the file path.
+ * \return 1 if it is a link store file, 0 else.
+ **/
+int link_store_is_file(const char *path);
+
+/**
+ * \brief Memory-map a finalized store from a binary file. The header and the
+ *        rows are checked, but the node count is the one of the file: the caller
+ *        must compare it with the simulation.
+ * \param path the file path.
+ * \return The store, NULL in case of error or of an invalid file.
+ **/
+link_store_t *link_store_load(const char *path);
+
+#ifdef __cplusplus
+}
+#endif //__cplusplus
+
+#endif // WSNET_CORE_DATA_STRUCTURE_LINK_STORE_H_
@@ -7,6 +7,18 @@
 #ifndef __mem_fs__
 #define __mem_fs__
 
+#include <stdint.h>
+
+/* ************************************************** */
+/* ************************************************** */
+typedef struct _mem_fs_stats {
+    uint64_t slices;   /* declared slices */
+    uint64_t pages;    /* preallocated pages */
+    uint64_t bytes;    /* preallocated bytes */
+    uint64_t allocs;   /* blocks allocated */
+    uint64_t deallocs; /* blocks deallocated */
+} mem_fs_stats_t;
+
 #ifdef __cplusplus
 extern "C"{
 #endif
@@ -40,6 +52,22 @@ void *mem_fs_alloc(void *slice);
  **/
 void mem_fs_dealloc(void *slice, void *pointer);
 
+
+/**
+ * \brief Get the number of times the module was cleaned. The slices declared
+ *        before a clean are released by it: callers keeping slices compare
+ *        the generation to find out their slices are no longer valid.
+ * \return the number of calls to mem_fs_clean().
+ **/
+unsigned int mem_fs_get_generation(void);
+
+
+/**
+ * \brief Get the allocation counters of the module since its last clean.
+ * \param stats filled with the counters.
+ **/
+void mem_fs_get_stats(mem_fs_stats_t *stats);
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,52 @@
+/**
+ *  \file   kd_range_tree.h
+ *  \brief  KdRangeTree Class definition
+ *
+ *          3D k-d tree stored as an implicit tree in a vector: the root of
+ *          each range of points is its median along the axis of largest
+ *          spread. A range query costs O(n^(2/3) + k) in the worst case.
+ *
+ *          The tree is rebuilt in O(n log n) at the first query following
+ *          an insertion or a move. Deleted nodes are only deactivated, so
+ *          that a node registering again at the same position does not
+ *          trigger a rebuild, and removed at the next rebuild once they are
+ *          the majority.
+ *
+ *  \author agent
+ *  \date   2026
+ **/
+
+#ifndef WSNET_CORE_DATA_STRUCTURE_RANGE_TREE_KD_RANGE_TREE_H_
+#define WSNET_CORE_DATA_STRUCTURE_RANGE_TREE_KD_RANGE_TREE_H_
+
+#include <unordered_map>
+#include <kernel/include/data_structures/range_tree/range_tree.h>
+
+class KdRangeTree : public RangeTree {
+public:
+	KdRangeTree();
+	~KdRangeTree(){};
+private:
+	struct Point {
+		nodeid_t id_;
+		double coordinates_[3];
+		bool active_;
+	};
+
+	void DeleteImpl(nodeid_t id);
+	void InsertImpl(nodeid_t id, const position_t &position);
+	void UpdateImpl(nodeid_t id, const position_t &position);
+	void FindInRangeImpl(const position_t &center, double range, std::vector<nodeid_t> &ids);
+
+	void Build();
+	void Build(size_t begin, size_t end);
+
+	std::vector<Point> points_;                    // in tree order once built
+	std::vector<uint8_t> axes_;                    // split axis of each point, in tree order
+	std::unordered_map<nodeid_t, size_t> indexes_; // index of each node in points_
+	std::vector<std::pair<size_t, size_t>> stack_; // ranges of points to visit, kept between queries
+	bool outdated_;
+	size_t nbr_inactive_;
+};
+
+#endif // WSNET_CORE_DATA_STRUCTURE_RANGE_TREE_KD_RANGE_TREE_H_
@@ -10,28 +10,34 @@
 #define WSNET_CORE_DATA_STRUCTURE_RANGE_TREE_RANGE_TREE_H_
 
 #include <memory>
+#include <vector>
+#include <kernel/include/definitions/types.h>
 
-/** \brief The Abstract Base Class : RangeTreeTree Class
+/** \brief The Abstract Base Class : RangeTree Class
  *
- *  This class is just a stub for the moment. In the future
- *  we expect to have different range trees implemented to
- *  avoid copies of signals being sent to nodes very far from
- *  the source
+ *  Spatial index of the nodes positions, used to avoid copies
+ *  of signals being sent to nodes very far from the source.
  *
- * \fn Delete - deletes an interval from the tree
- * \fn Insert - inserts an interval in the tree
- * \fn GetSize - return the current size of the interval tree
+ * \fn Delete - deletes a node from the tree
+ * \fn Insert - inserts a node in the tree, or moves it if it is already there
+ * \fn Update - moves a node of the tree to a new position
+ * \fn FindInRange - fill ids with the nodes within range of a position, by increasing id
+ * \fn GetSize - return the current number of nodes in the tree
  **/
 class RangeTree {
 public:
 	RangeTree(){ size_ = 0;};
 	virtual ~RangeTree(){};
-	void Delete(){DeleteImpl();};
-	void Insert(){InsertImpl();};
+	void Delete(nodeid_t id){DeleteImpl(id);};
+	void Insert(nodeid_t id, const position_t &position){InsertImpl(id, position);};
+	void Update(nodeid_t id, const position_t &position){UpdateImpl(id, position);};
+	void FindInRange(const position_t &center, double range, std::vector<nodeid_t> &ids){FindInRangeImpl(center, range, ids);};
 	uint GetSize() {return size_;};
 private:
-	virtual void DeleteImpl(){};
-	virtual void InsertImpl(){};
+	virtual void DeleteImpl(nodeid_t id) = 0;
+	virtual void InsertImpl(nodeid_t id, const position_t &position) = 0;
+	virtual void UpdateImpl(nodeid_t id, const position_t &position) = 0;
+	virtual void FindInRangeImpl(const position_t &center, double range, std::vector<nodeid_t> &ids) = 0;
 protected:
 	uint size_;
 };
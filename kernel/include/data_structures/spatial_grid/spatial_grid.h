@@ -0,0 +1,103 @@
+/**
+ *  \file   spatial_grid.h
+ *  \brief  Uniform spatial grid used to index objects by position
+ *
+ *          Space is cut into cubic cells of side cell_size. Cells are
+ *          hashed into a fixed number of buckets, so the indexed area
+ *          does not need to be known in advance. Objects are identified
+ *          by an integer id in [0, capacity).
+ *
+ *  \author agent
+ *  \date   2026
+ **/
+#ifndef WSNET_CORE_DATA_STRUCTURE_SPATIAL_GRID_H_
+#define WSNET_CORE_DATA_STRUCTURE_SPATIAL_GRID_H_
+
+#include <stdint.h>
+
+
+/* ************************************************** */
+/* ************************************************** */
+typedef struct _spatial_grid_cell {
+  int64_t x;
+  int64_t y;
+  int64_t z;
+} spatial_grid_cell_t;
+
+typedef struct _spatial_grid_bucket {
+  int  size;
+  int  capacity;
+  int *ids;
+} spatial_grid_bucket_t;
+
+typedef struct _spatial_grid_entry {
+  int                 indexed; /* 1 if the id is present in the grid */
+  int                 slot;    /* position of the id inside its bucket */
+  spatial_grid_cell_t cell;
+} spatial_grid_entry_t;
+
+typedef struct _spatial_grid {
+  double                 cell_size;
+  int                    capacity;
+  int                    nbr_buckets;
+  spatial_grid_bucket_t *buckets;
+  spatial_grid_entry_t  *entries;
+  int                    nbr_results;
+  int                   *results;
+} spatial_grid_t;
+
+
+#ifdef __cplusplus
+extern "C"{
+#endif //__cplusplus
+/* ************************************************** */
+/* ************************************************** */
+/**
+ * \brief Create a grid able to index the ids [0, capacity).
+ * \param cell_size the side of a cell, should be close to the usual query range.
+ * \param capacity the number of ids that can be indexed.
+ * \return The new grid, NULL in case of error.
+ **/
+spatial_grid_t *spatial_grid_create(double cell_size, int capacity);
+
+/**
+ * \brief Free a grid.
+ * \param grid the grid to be freed.
+ **/
+void spatial_grid_destroy(spatial_grid_t *grid);
+
+/**
+ * \brief Insert an id in the grid or move it to its new position.
+ * \param grid the grid.
+ * \param id the id to be updated.
+ * \param x, y, z the current position of the id.
+ **/
+void spatial_grid_update(spatial_grid_t *grid, int id, double x, double y, double z);
+
+/**
+ * \brief Remove an id from the grid.
+ * \param grid the grid.
+ * \param id the id to be removed.
+ **/
+void spatial_grid_remove(spatial_grid_t *grid, int id);
+
+/**
+ * \brief Collect the ids whose cell intersects the cube of half side range around (x, y, z).
+ *
+ *        The result is a superset of the ids within range: callers still have to
+ *        check the exact distance. Ids are returned in increasing order and the
+ *        returned array belongs to the grid, it is only valid until the next query.
+ *
+ * \param grid the grid.
+ * \param x, y, z the center of the query.
+ * \param range the query range.
+ * \param size filled with the number of returned ids.
+ * \return The array of candidate ids.
+ **/
+int *spatial_grid_query(spatial_grid_t *grid, double x, double y, double z, double range, int *size);
+
+#ifdef __cplusplus
+}
+#endif //__cplusplus
+
+#endif // WSNET_CORE_DATA_STRUCTURE_SPATIAL_GRID_H_
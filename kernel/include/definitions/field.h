@@ -16,6 +16,9 @@
 #define DBLE    4
 #define STRING  5
 
+// interned field name, see packet_field_key()
+typedef int field_key_t;
+
 typedef struct _field_t{
     int type;
     int size;
@@ -114,6 +114,9 @@ typedef struct _mobility_methods {
   void (*update_position) (call_t *to, call_t *from);
   double (*get_speed) (call_t *to);
   angle_t (*get_angle) (call_t *to);
+  int (*is_static) (call_t *to); /* optional, 1 if the node never moves after its bootstrap */
+  void (*position_at) (call_t *to, uint64_t time, position_t *position); /* optional, the position at a date in closed form, used instead of update_position by the lazy mobility */
+  double (*get_max_speed) (call_t *to); /* optional, bound of the node speed in m/s, lets the lazy mobility evaluate only the nodes around a position */
 } mobility_methods_t;
 
 
@@ -256,6 +259,9 @@ typedef struct _shadowing_methods {
  **/
 typedef struct _pathloss_methods {
   double (*pathloss) (call_t *to_pathloss, call_t *to_interface, call_t *from_interface, packet_t *packet, double rxdBm);
+  /* optional: non zero if the pathloss only depends on rxdBm, the channel and the nodes positions,
+   * in which case the medium computes it once per link until one of the nodes moves. */
+  int (*cacheable) (call_t *to_pathloss);
 } pathloss_methods_t;
 
 
@@ -312,6 +318,9 @@ typedef struct _modulation_methods {
   int (* bit_per_symbol) (call_t *to, call_t *from);
   int  (*get_modulation_type) (call_t *to, call_t *from);
   void    (*set_modulation_type) (call_t *to, call_t *from, int modulation_type);
+  /* optional: the ber of n snr values at once, snr and ber may be the same array.
+   * If NULL, modulate is called for each value. */
+  void (* modulate_batch) (call_t *to, call_t *from, const double *snr, double *ber, int n);
 } modulation_methods_t;
 
 
@@ -27,11 +27,11 @@ class InterferenceModel {
 public:
 	InterferenceModel();
 	virtual ~InterferenceModel();
-	void ApplyInterference(std::shared_ptr<Signal> tracked_signal, MapOfSignals interferers);
+	void ApplyInterference(std::shared_ptr<Signal> tracked_signal, const MapOfSignals &interferers);
 	void Print() const;
 	InterferenceModelUid GetUID() const;
 private:
-	virtual void ApplyInterferenceImpl(std::shared_ptr<Signal> , MapOfSignals) =0 ;
+	virtual void ApplyInterferenceImpl(std::shared_ptr<Signal> , const MapOfSignals &) =0 ;
 	virtual void PrintImpl() const;
 	static InterferenceModelUid uid_counter_;
 	InterferenceModelUid uid_;
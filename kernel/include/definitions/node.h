@@ -64,6 +64,7 @@ typedef struct _node {
   uint64_t     			birth;
   int          			state;
   position_t   			position;
+  uint64_t     			position_stamp; /* positions stamp of the last change of position */
 
 #ifdef __cplusplus
   void       			**private_vars;
@@ -85,7 +86,29 @@ typedef struct _node_array {
   node_t *elts;
 } node_array_t;
 
+/** \def NODE_POSITION_FIXED
+ * \brief Evaluation date of the positions that are never evaluated: static, unborn or dead nodes.
+ **/
+#define NODE_POSITION_FIXED UINT64_MAX
+
+/* Contiguous copy of the node fields read by the scans over all the nodes
+ * (mobility updates, transmissions fan-out), indexed by node id.
+ * The positions are the reference ones, get_node_position() points into them,
+ * node_t.position is a copy refreshed at birth and each time the position is
+ * evaluated, which under lazy mobility happens only when it is read: the copy
+ * may thus be stale, read the positions through get_node_position().
+ * The states follow node_t.state, the nodearchs are copied at bootstrap.
+ * The clocks are the dates of the last evaluation of the positions. */
+typedef struct _node_table {
+  int           size;
+  position_t   *positions;
+  int          *states;
+  nodearchid_t *nodearchs;
+  uint64_t     *clocks;
+} node_table_t;
+
 extern node_array_t nodes;
+extern node_table_t nodes_table;
 
 #ifdef __cplusplus
 extern "C"{
@@ -102,21 +125,45 @@ node_t *get_node_by_id(nodeid_t id);
 
 /** 
  * \brief Return a node's position. For read-only, the position should not be modified.
+ *        With lazy mobility, an outdated position is evaluated first.
  * \param node the node id.
  * \return The node's position.
  **/
 position_t *get_node_position(nodeid_t node);
 
+/**
+ * \brief Return a node's state (NODE_UNDEF, NODE_DEAD or NODE_ACTIVE).
+ * \param id the node id.
+ * \return The node's state.
+ **/
+int get_node_state(nodeid_t id);
+
 /**
  * \brief Free nodes space.
  **/
 void nodes_clean(void);
 
 /**
- * \brief Update nodes positions.
+ * \brief Update nodes positions. The static nodes are skipped.
+ *        With lazy mobility, the positions are only marked as outdated and are
+ *        evaluated when read.
  **/
 void nodes_update_mobility(void);
 
+/**
+ * \brief Evaluate all the outdated positions, for the structures indexing all
+ *        the nodes positions. Does nothing without lazy mobility.
+ **/
+void nodes_refresh_mobility(void);
+
+/**
+ * \brief Evaluate the nodes positions when they are read rather than at each
+ *        mobility update. The models giving position_at() are evaluated in
+ *        closed form. When all the mobile nodes give their maximum speed, the
+ *        range queries only evaluate the nodes that may be within range.
+ **/
+void nodes_set_mobility_lazy(void);
+
 /**
  * \brief Return the number of simulated nodes.
  * \return The number of nodes.
@@ -187,6 +234,40 @@ void set_node_private_data(call_t *to, void *data);
  **/
 double distance(position_t *position0, position_t *position1);
 
+/**
+ * \brief Return the ids of the nodes that may be within range of a position.
+ *
+ *        The ids come from a spatial grid updated at birth, death and on mobility
+ *        updates. They are sorted in increasing order and form a superset of the
+ *        nodes within range: the exact distance must still be checked, from
+ *        get_node_position() as the positions of the grid may be outdated with
+ *        lazy mobility. The array is only valid until the next call.
+ *
+ * \param position the center of the query.
+ * \param range the query range.
+ * \param size filled with the number of returned ids.
+ * \return The candidate ids, or NULL if no spatial index is available (no medium
+ *         with a propagation range), in which case all nodes must be considered.
+ **/
+int *get_nodes_in_range(position_t *position, double range, int *size);
+
+/**
+ * \brief Return a counter incremented each time a node position changes.
+ *        Structures indexing the nodes positions compare it to the value they were
+ *        built with to know whether they are outdated.
+ * \return The positions stamp.
+ **/
+uint64_t get_nodes_positions_stamp(void);
+
+/**
+ * \brief Return the positions stamp of the last change of a node position.
+ *        Values computed from the node position while the positions stamp was
+ *        lower than this one are outdated.
+ * \param id the node id.
+ * \return The node position stamp.
+ **/
+uint64_t get_node_position_stamp(nodeid_t id);
+
 void print_node_groups(nodeid_t _nodeid);
 
 array_t get_node_groups(nodeid_t _nodeid);
@@ -73,13 +73,99 @@ void packet_clean(void);
 
 /* ************************************************** */
 /* ************************************************** */
+/**
+ * \brief Duplicate a packet for a reception. The fields are copied once for all
+ *        the rx clones of the packet, which share them until one of them retrieves
+ *        a field for writing and gets its own copy. The packet keeps its own fields:
+ *        the pointers retrieved from it before the clones do not modify them.
+ * \param packet the packet to clone.
+ * \return The cloned packet.
+ **/
 packet_t *packet_rxclone(packet_t *packet);
 
 
+/**
+ * \brief Return the key of a field name. Keys are interned once and for all:
+ *        models should get the keys of their fields at init and use the
+ *        *_by_key functions, the functions taking a name being kept for
+ *        backward compatibility. These remember the key of the last names
+ *        they were given, so that a literal name is not hashed again.
+ * \param name the field name.
+ * \return The field key.
+ **/
+field_key_t packet_field_key(char *name);
+
+/**
+ * \brief Return the name of a field key.
+ * \param key the field key.
+ * \return The field name, NULL if the key is unknown.
+ **/
+char *packet_field_key_name(field_key_t key);
+
+/**
+ * \brief Add a field to a packet. The packet becomes the owner of the field.
+ * \param packet the packet.
+ * \param key the field key.
+ * \param field the field.
+ **/
+void packet_add_field_by_key(packet_t *packet, field_key_t key, field_t *field);
+
+/**
+ * \brief Return a field of a packet, for reading or writing. The fields
+ *        shared with rx clones are copied first: use packet_get_field_by_key()
+ *        to only read them. The field must be retrieved again after the
+ *        packet is cloned by packet_rxclone() to be modified.
+ * \param packet the packet.
+ * \param key the field key.
+ * \return The field, NULL if not found.
+ **/
+field_t *packet_retrieve_field_by_key(packet_t *packet, field_key_t key);
+
+/**
+ * \brief Read-only access to a field, see packet_get_field().
+ * \param packet the packet.
+ * \param key the field key.
+ * \return The field, NULL if not found.
+ **/
+const field_t *packet_get_field_by_key(packet_t *packet, field_key_t key);
+
 void packet_add_field(packet_t *packet, char *name, field_t *field);
+
+/**
+ * \brief Return a field of a packet, for reading or writing, see
+ *        packet_retrieve_field_by_key().
+ * \param packet the packet.
+ * \param name the field name.
+ * \return The field, NULL if not found.
+ **/
 field_t *packet_retrieve_field(packet_t *packet, char *name);
+
+/**
+ * \brief Return the value of a field, for reading or writing, see
+ *        packet_retrieve_field_by_key().
+ * \param packet the packet.
+ * \param name the field name.
+ * \return The field value, NULL if not found.
+ **/
 void *packet_retrieve_field_value_ptr(packet_t *packet, char* name);
 
+/**
+ * \brief Read-only access to a field. Contrary to packet_retrieve_field(), the
+ *        fields shared with other rx clones are not copied.
+ * \param packet the packet.
+ * \param name the field name.
+ * \return The field, NULL if not found.
+ **/
+const field_t *packet_get_field(packet_t *packet, char *name);
+
+/**
+ * \brief Read-only access to the value of a field, see packet_get_field().
+ * \param packet the packet.
+ * \param name the field name.
+ * \return The field value, NULL if not found.
+ **/
+const void *packet_get_field_value_ptr(packet_t *packet, char* name);
+
 #ifdef __cplusplus
 }
 #endif
@@ -207,6 +207,37 @@ typedef struct _destination {
 } destination_t;
 
 
+/** \def PACKET_FIELDS_INLINE
+ * \brief Number of fields stored inside a packet before an array is allocated.
+ **/
+#define PACKET_FIELDS_INLINE 8
+
+/** \typedef packet_field_t
+ * \brief A packet field along with its interned key.
+ **/
+/** \struct _packet_field
+ * \brief A packet field along with its interned key. Should use type packet_field_t.
+ **/
+typedef struct _packet_field {
+  field_key_t key;       /**< the field key, see packet_field_key() **/
+  field_t *field;        /**< the field **/
+} packet_field_t;
+
+/** \typedef packet_fields_t
+ * \brief The fields of a packet, shared by the packets cloned for reception.
+ **/
+/** \struct _packet_fields
+ * \brief The fields of a packet, shared by the packets cloned for reception. Should use type packet_fields_t.
+ **/
+typedef struct _packet_fields {
+  int refs;              /**< number of packets sharing the fields **/
+  int size;              /**< number of fields **/
+  int capacity;          /**< number of fields that elts can hold **/
+  packet_field_t *elts;  /**< the fields, in insertion order: inline_elts unless there are too many fields **/
+  packet_field_t inline_elts[PACKET_FIELDS_INLINE];
+} packet_fields_t;
+
+
 /** \typedef packet_t
  * \brief A radio packet.
  **/
@@ -255,7 +286,8 @@ typedef struct _packet {
   double SINR;          /* Define the wideband SINR Value of the packet in linear */
   /*end of edition */
 
-  hashtable_t *fields;   /**< packet data **/
+  packet_fields_t *fields; /**< packet data, shared by the rx clones until modified **/
+  packet_fields_t *rx_fields; /**< copy of the fields shared by the rx clones, NULL until the first one **/
 
   // pointer to the signal that contain the packet.
   // we are using this as temporary measure to have backward compatibility
@@ -25,7 +25,7 @@ public:
 	nodeid_t GetNodeID() const;
 	void AddFrequencyInterval(std::shared_ptr<FrequencyIntervalRegisteredRxNode> freq);
 	PhyModel* GetPhyModel() const;
-	SetOfFrequencyIntervalRegisteredRxNode GetAllFrequencyInterval() const;
+	const SetOfFrequencyIntervalRegisteredRxNode &GetAllFrequencyInterval() const;
 private:
 	SetOfFrequencyIntervalRegisteredRxNode frequency_bands_;
 	nodeid_t node_id_;
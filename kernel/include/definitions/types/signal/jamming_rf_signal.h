@@ -19,11 +19,14 @@
  * \fn GetWaveformImpl() return the waveform of the jamming signal
  * \fn SetWaveformImpl() sets the waveform of the jamming signal
  * \fn CloneImpl() return a deep copy of the jamming signal
+ * \fn CreateReceptionImpl() return a reception of the jamming signal
+ * \fn IsKindOf() return whether a kind of signal is a JammingRFSignal, used by signal_cast
  **/
 class JammingRFSignal : public RFSignal{
   public:
-    JammingRFSignal(nodeid_t source) : RFSignal(source, nullptr){};
+    JammingRFSignal(nodeid_t source) : RFSignal(source, nullptr, SignalKind::JammingRF){};
     ~JammingRFSignal(){};
+    static bool IsKindOf(SignalKind kind) {return kind == SignalKind::JammingRF;};
   private:
     std::weak_ptr<Waveform> GetWaveformImpl(){ return waveform_;};
     void PrintSignalImpl() const {
@@ -36,6 +39,11 @@ class JammingRFSignal : public RFSignal{
       waveform_->SetSignal(new_signal);
       return new_signal;
     };
+    std::shared_ptr<Signal> CreateReceptionImpl(){
+      auto reception = std::make_shared<JammingRFSignal>(source_);
+      reception->SetWaveform(GetWaveform().lock());
+      return reception;
+    };
     packet_t *GetPacket_DeprecatedImpl() {return nullptr;};
     void SetWaveformImpl(std::shared_ptr<Waveform> waveform) {waveform_ = waveform;};
     std::shared_ptr<Waveform> waveform_;
@@ -22,22 +22,25 @@
  * \fn GetWaveformImpl() return the waveform of the lora signal
  * \fn SetWaveformImpl() sets the waveform of the lora signal
  * \fn CloneImpl() return a deep copy of the lora signal
+ * \fn CreateReceptionImpl() return a reception of the lora signal
  * \fn GetSpreadingFactor() return the spreading factor;
  * \fn SetSpreadingFactor() set the spreading factor;
+ * \fn IsKindOf() return whether a kind of signal is a LoRaSignal, used by signal_cast
  **/
 class LoRaSignal : public RFSignal, public std::enable_shared_from_this<LoRaSignal>{
  public:
-  LoRaSignal(nodeid_t source) : RFSignal(source, nullptr) {};
+  LoRaSignal(nodeid_t source) : RFSignal(source, nullptr, SignalKind::LoRa) {};
   ~LoRaSignal(){};
   LoRaSignal(call_t *to, call_t *from_interface, SpreadingFactor sf,Frequency freq_center,
-             Frequency bandwidth, packet_t *packet) : RFSignal(to,from_interface,packet) , sf_(sf), freq_center_(freq_center), bandwidth_(bandwidth){};
+             Frequency bandwidth, packet_t *packet) : RFSignal(to,from_interface,packet,SignalKind::LoRa) , sf_(sf), freq_center_(freq_center), bandwidth_(bandwidth){};
   LoRaSignal(nodeid_t source, SpreadingFactor sf, Frequency freq_center,
-             Frequency bandwidth, packet_t *packet) : RFSignal(source,packet) , sf_(sf), freq_center_(freq_center), bandwidth_(bandwidth){};
+             Frequency bandwidth, packet_t *packet) : RFSignal(source,packet,SignalKind::LoRa) , sf_(sf), freq_center_(freq_center), bandwidth_(bandwidth){};
   void SetSpreadingFactor(SpreadingFactor sf){
     sf_=sf;
   };
   SpreadingFactor GetSpreadingFactor() const {return sf_;};
   Frequency GetFrequencyCenter() const {return freq_center_;} ;
+  static bool IsKindOf(SignalKind kind) {return kind == SignalKind::LoRa;};
  private:
   std::weak_ptr<Waveform> GetWaveformImpl() const{ return waveform_;};
   std::shared_ptr<Signal> CloneImpl(){
@@ -46,6 +49,11 @@ class LoRaSignal : public RFSignal, public std::enable_shared_from_this<LoRaSign
     waveform_->SetSignal(new_signal);
     return new_signal;
   };
+  std::shared_ptr<Signal> CreateReceptionImpl(){
+    auto reception = std::make_shared<LoRaSignal>(source_,sf_, freq_center_, bandwidth_,packet_);
+    reception->SetWaveform(waveform_);
+    return reception;
+  };
   packet_t *GetPacket_DeprecatedImpl() {return packet_;};
   void SetWaveformImpl(std::shared_ptr<Waveform> waveform) {waveform_ = waveform;};
   void PrintSignalImpl() const {
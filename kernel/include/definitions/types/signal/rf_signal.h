@@ -21,28 +21,38 @@
  * \fn GetDestination() return the nodeid_t of the destination of the signal
  * \fn GetSource() return the nodeid_t of the source of the signal
  * \fn Clone() return a deep copy of the signal
+ * \fn CreateReception() return a reception of the signal, which shares the waveform
+ *     and the packet of the transmitted signal: they must not be modified by the receivers
+ * \fn GetPSDScale() return the ratio between the received and the transmitted PSD
+ * \fn SetPSDScale() set the ratio between the received and the transmitted PSD
+ * \fn IsKindOf() return whether a kind of signal is a RFSignal, used by signal_cast
  **/
 class RFSignal : public Signal{
   public:
-    RFSignal(nodeid_t source, packet_t* packet);
-    RFSignal (call_t *to,call_t *from_interface, packet_t* packet);
-    RFSignal(nodeid_t source, std::shared_ptr<Waveform> waveform);
-    RFSignal (call_t *to,call_t *from_interface, packet_t* packet, Time T_begin, Time T_end);
+    RFSignal(nodeid_t source, packet_t* packet, SignalKind kind = SignalKind::RF);
+    RFSignal (call_t *to,call_t *from_interface, packet_t* packet, SignalKind kind = SignalKind::RF);
+    RFSignal(nodeid_t source, std::shared_ptr<Waveform> waveform, SignalKind kind = SignalKind::RF);
+    RFSignal (call_t *to,call_t *from_interface, packet_t* packet, Time T_begin, Time T_end, SignalKind kind = SignalKind::RF);
     virtual ~RFSignal();
     std::weak_ptr<Waveform> GetWaveform() const;
     Frequency GetBandwidth() const;
     packet_t *GetPacket_Deprecated();
     void SetWaveform(std::shared_ptr<Waveform> waveform);
+    double GetPSDScale() const;
+    void SetPSDScale(double psd_scale);
+    static bool IsKindOf(SignalKind kind);
   private:
     Frequency GetBandwidthImpl() const;
     std::weak_ptr<Waveform> GetWaveformImpl() const;
     void SetWaveformImpl(std::shared_ptr<Waveform>);
     std::shared_ptr<Signal> CloneImpl();
+    std::shared_ptr<Signal> CreateReceptionImpl();
     packet_t *GetPacket_DeprecatedImpl();
     void PrintSignalImpl() const;
   protected:
     std::shared_ptr<Waveform> waveform_;
     packet_t *packet_;
+    double psd_scale_ = 1.0;
 };
 
 #endif // WSNET_CORE_DEFINITIONS_TYPES_SIGNAL_RF_SIGNAL_H_
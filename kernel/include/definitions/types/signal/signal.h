@@ -15,6 +15,15 @@
 #include <kernel/include/definitions/types.h>
 #include <kernel/include/definitions/types/interval/registered_rx_node.h>
 
+/** \brief The kinds of concrete signals, tagging each signal to dispatch on its
+ * type with a switch instead of the run time type information
+ **/
+enum class SignalKind {
+  RF,
+  LoRa,
+  JammingRF
+};
+
 /** \brief The Abstract Base Class : Signal Class
  *
  * \fn GetBegin() return the time on which the signal begin
@@ -23,16 +32,21 @@
  * \fn GetDestination() return the nodeid_t of the destination of the signal
  * \fn GetSource() return the nodeid_t of the source of the signal
  * \fn Clone() return a deep copy of the signal
+ * \fn GetKind() return the kind of the concrete signal, given to the constructors
+ * \fn CreateReception() return the signal as seen by one receiver, it shares with
+ *     the transmitted signal everything that does not depend on the receiver
  **/
 class Signal {
   public:
-    Signal (nodeid_t source);
-    Signal (call_t *to,call_t *from_interface);
-    Signal (call_t *to,call_t *from_interface, Time T_begin, Time T_end);
+    Signal (nodeid_t source, SignalKind kind);
+    Signal (call_t *to,call_t *from_interface, SignalKind kind);
+    Signal (call_t *to,call_t *from_interface, Time T_begin, Time T_end, SignalKind kind);
     virtual ~Signal();
     void Print() const;
     SignallUid GetUID() const;
+    SignalKind GetKind() const;
     std::shared_ptr<Signal> Clone();
+    std::shared_ptr<Signal> CreateReception();
     Time GetBegin() const;
     Time GetEnd() const ;
     double GetSINR() const;
@@ -51,10 +65,12 @@ class Signal {
     void PrintSignal() const;
   private:
     virtual std::shared_ptr<Signal> CloneImpl() = 0;
+    virtual std::shared_ptr<Signal> CreateReceptionImpl();
     virtual void PrintSignalImpl() const = 0;
     static SignallUid uid_counter_;
     SignallUid uid_;
   protected:
+    SignalKind kind_;
     call_t to_interface_;
     call_t from_interface_;
     Time begin_;
@@ -67,4 +83,17 @@ class Signal {
 
 using MapOfSignals = std::map<SignallUid,std::shared_ptr<Signal>>;
 
+/** \brief Cast a signal to one of the signal classes, using the kind of the signal
+ *
+ * TSignal::IsKindOf() tells whether a kind of signal is a TSignal.
+ * Return nullptr if the signal is not a TSignal, as std::dynamic_pointer_cast.
+ **/
+template <class TSignal>
+std::shared_ptr<TSignal> signal_cast(const std::shared_ptr<Signal> &signal){
+  if (signal && TSignal::IsKindOf(signal->GetKind())){
+    return std::static_pointer_cast<TSignal>(signal);
+  }
+  return nullptr;
+}
+
 #endif // WSNET_CORE_DEFINITIONS_TYPES_SIGNAL_SIGNAL_H_
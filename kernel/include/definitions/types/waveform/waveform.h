@@ -20,6 +20,7 @@
  *
  * \fn AddFrequencyInterval - inserts a frequency interval in the waveform
  * \fn GetAllFrequencyInterval - return all the frequencies intervals that describe the waveform
+ * \fn GetBandwidth - return the sum of the bandwidths of the frequency intervals
  * \fn GetUID - return the UID of the waveform
  * \fn Clone return a cloned waveform
  **/
@@ -29,7 +30,8 @@ class Waveform : public std::enable_shared_from_this<Waveform>{
     Waveform();
     ~Waveform();
     void AddFrequencyInterval(std::shared_ptr<FrequencyIntervalWaveform> freq);
-    SetOfFrequencyIntervalWaveform GetAllFrequencyInterval();
+    const SetOfFrequencyIntervalWaveform &GetAllFrequencyInterval() const;
+    Frequency GetBandwidth() const;
     std::shared_ptr<Waveform> Clone();
     WaveformUid GetUID() const;
     std::weak_ptr<Signal> GetSignal();
@@ -39,6 +41,7 @@ class Waveform : public std::enable_shared_from_this<Waveform>{
     WaveformUid uid_; // maybe we do not need uid counter, we can check the memory of each object and this will be the UID;
     static WaveformUid uid_counter_;
     SetOfFrequencyIntervalWaveform frequency_interval_; // the set of frequency intervals that describes the waveform
+    Frequency bandwidth_ = 0; // the sum of the bandwidths of the frequency intervals
     std::weak_ptr<Signal> signal_; // pointer to the signal of which it belongs
 };
 
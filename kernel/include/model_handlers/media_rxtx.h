@@ -89,6 +89,15 @@ void medium_cs(packet_t *packet, call_t *to_interface, call_t *from_interface);
 void medium_rx(packet_t *packet, call_t *to_interface, call_t *from_interface);
 void medium_compute_rxdBm(packet_t *packet, call_t *to_interface, call_t *from_interface);
 
+/**
+ * \brief Compute the power received by an interface, without writing it in the packet.
+ * \param packet the transmitted packet, which may be shared by all the receptions.
+ * \param to_interface the receiving interface.
+ * \param from_interface the transmitting interface.
+ * \return The received power in dBm.
+ **/
+double medium_get_rxdBm(packet_t *packet, call_t *to_interface, call_t *from_interface);
+
 #ifdef __cplusplus
 void medium_rx_signal_begin(SpectrumModel *spectrum, std::shared_ptr<Signal> signal);
 #else
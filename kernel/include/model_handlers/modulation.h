@@ -58,6 +58,17 @@ void modulation_clean(void);
 //double do_modulate(classid_t modulation, double rxmW, double noise);
 double do_modulate(call_t *from, classid_t modulation, double rxmW, double noise);
 double do_modulate_snr(call_t *from, classid_t modulation, double snr);
+
+/**
+ * \brief Compute the ber of a packet slices in a single call to the modulation.
+ * \param from the calling interface.
+ * \param modulation the modulation class.
+ * \param rxmW the received power.
+ * \param noise the noise of each slice.
+ * \param ber filled with the ber of each slice, may be the noise array.
+ * \param n the number of slices.
+ **/
+void do_modulate_batch(call_t *from, classid_t modulation, double rxmW, const double *noise, double *ber, int n);
 void modulation_errors(packet_t *packet);
 
 #ifdef __cplusplus
@@ -30,8 +30,11 @@
 #include <kernel/include/data_structures/circular_array/circ_array.h>
 #include <kernel/include/data_structures/hashtable/hashtable.h>
 #include <kernel/include/data_structures/sliding_window/sliding_window.h>
+#include <kernel/include/data_structures/link_store/link_store.h>
 
 #include <kernel/include/tools/math/rng/rng.h>
+#include <kernel/include/tools/math/ber_table/ber_table.h>
+#include <kernel/include/tools/math/ber_table/ber_vector.h>
 
 #include <kernel/include/definitions/types.h>
 #include <kernel/include/definitions/models.h>
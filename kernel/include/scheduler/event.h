@@ -7,8 +7,26 @@
 #ifndef WSNET_CORE_SCHEDULER_EVENT_H_
 #define WSNET_CORE_SCHEDULER_EVENT_H_
 
+#include <kernel/include/definitions/types.h>
+
+/** \typedef rx_begin_t
+ *
+ * \brief A packet reception, given to the scheduler along with the other receptions of a transmission.
+ **/
+/** \struct _rx_begin
+ * \brief A packet reception. Should use type rx_begin_t.
+ **/
+typedef struct _rx_begin {
+  uint64_t              clock;      // rx begin time
+  call_t                to;         // receiving interface
+  packet_t              *packet;    // packet received
+} rx_begin_t;
+
 #ifdef __cplusplus
+#include <algorithm>
+#include <cstddef>
 #include <memory>
+#include <vector>
 #include <kernel/include/definitions/models/spectrum/spectrum_model.h>
 #include <kernel/include/definitions/types/signal/signal.h>
 
@@ -29,20 +47,36 @@ typedef enum {
 
 
 struct Event{
-  Time                clock_;    // event time
-  event_priority_t    priority_; // event priority
-  EventUid            uid_;      // event id
+  Time                clock_;       // event time
+  event_priority_t    priority_;    // event priority
+  EventUid            uid_;         // event id
+  int                 handle_;      // handle given to the API for callbacks, -1 else
+  size_t              queue_index_; // position in the queue, managed by the scheduler implementation
 
   static EventUid     uid_counter_;
 
-  Event() : clock_(0), priority_(PRIORITY_NONE), uid_(uid_counter_){
+  Event() : clock_(0), priority_(PRIORITY_NONE), uid_(uid_counter_), handle_(-1), queue_index_(0){
     ++uid_counter_;
   }
 
-  Event(Time clock, event_priority_t priority) : clock_(clock), priority_(priority), uid_(uid_counter_){
+  Event(Time clock, event_priority_t priority) : clock_(clock), priority_(priority), uid_(uid_counter_),
+      handle_(-1), queue_index_(0){
     ++uid_counter_;
   }
 
+  // an event taking over the uid of another one, e.g. the part of a rx begin event given to another LP
+  Event(Time clock, event_priority_t priority, EventUid uid) : clock_(clock), priority_(priority), uid_(uid),
+      handle_(-1), queue_index_(0){
+  }
+
+  virtual ~Event(){
+  }
+
+  // events are allocated from mem_fs slices, one slice per event size,
+  // so that steady-state simulations do not call malloc/free per event
+  static void *operator new(std::size_t size);
+  static void operator delete(void *pointer, std::size_t size);
+
   bool operator >(const Event &rhs) const {
     if (clock_ > rhs.clock_){
       return true;
@@ -121,6 +155,51 @@ struct EventRxTx : public Event{
 
 };
 
+// the rx begin events of a transmission, as a single event: the receptions are
+// sorted by decreasing (clock, uid), the next one being at the back, and the
+// event takes the clock and the uid of the next reception, so that it is
+// ordered in the queue as the next one of the separate events would be
+struct EventRxFanout : public Event{
+  struct Reception{
+    Time      clock_;
+    EventUid  uid_;
+    call_t    to_;
+    packet_t  *packet_;
+  };
+
+  call_t                  from_;
+  std::vector<Reception>  receptions_;  // taken from the pool of released buffers
+
+  EventRxFanout(event_priority_t priority, call_t from,
+                const rx_begin_t *receptions, int size) : Event(0, priority), from_(from),
+                    receptions_(AcquireReceptions()){
+    receptions_.reserve(size);
+    for (int i = 0; i < size; i++){
+      // one uid per reception, the first one being the uid of the event
+      EventUid uid = (i == 0) ? uid_ : uid_counter_++;
+      receptions_.push_back({receptions[i].clock, uid, receptions[i].to, receptions[i].packet});
+    }
+    std::sort(receptions_.begin(), receptions_.end(), [](const Reception &lhs, const Reception &rhs){
+        return (lhs.clock_ > rhs.clock_) || ((lhs.clock_ == rhs.clock_) && (lhs.uid_ > rhs.uid_)); });
+    clock_ = receptions_.back().clock_;
+    uid_ = receptions_.back().uid_;
+  };
+
+  // some receptions of another rx begin event, under the date and uid of the next one
+  EventRxFanout(event_priority_t priority, call_t from,
+                std::vector<Reception> receptions) : Event(receptions.back().clock_, priority, receptions.back().uid_),
+                    from_(from), receptions_(std::move(receptions)){
+  };
+
+  ~EventRxFanout(){
+    ReleaseReceptions(std::move(receptions_));
+  };
+
+  // the buffers keep their capacity, so that a transmission does not allocate in steady state
+  static std::vector<Reception> AcquireReceptions();
+  static void ReleaseReceptions(std::vector<Reception> receptions);
+};
+
 struct EventRxTxSignal : public Event{
   std::shared_ptr<Signal> signal_;
   SpectrumModel           *spectrum_;
@@ -154,7 +233,8 @@ struct CompareEventLess : public std::binary_function<std::unique_ptr<Event> &,
  **/
 typedef struct _event {
   uid_t                 uid_;       // event id
-  uint64_t              clock_;    // event time
+  uint64_t              clock_;     // event time
+  int                   handle_;    // scheduler handle, -1 if the event was never scheduled
 } event_t;
 
 #endif //WSNET_CORE_SCHEDULER_EVENT_H_
@@ -0,0 +1,44 @@
+/**
+ *  \file   event_heap.h
+ *  \brief  Binary heap of events, stored in a std::vector
+ *      Each event knows its position in the heap (queue_index_), which is
+ *      kept up to date whenever the event moves, so that any event can be
+ *      removed in O(log n) without searching for it.
+ *  \author agent
+ *  \date   2026
+ **/
+
+#ifndef WSNET_CORE_SCHEDULER_EVENT_HEAP_H_
+#define WSNET_CORE_SCHEDULER_EVENT_HEAP_H_
+
+#include <vector>
+#include <kernel/include/scheduler/event.h>
+
+/** \brief EventHeap: a binary heap of events, the earliest event being at the top
+ *
+ * \fn Push() add an event
+ * \fn Pop() remove and return the earliest event
+ * \fn Remove() remove a given event
+ * \fn Top() return the earliest event, the heap must not be empty
+ * \fn Empty() return whether the heap is empty
+ * \fn Size() return the number of events
+ **/
+class EventHeap {
+ public:
+  void Push(std::unique_ptr<Event> e);
+  std::unique_ptr<Event> Pop();
+  std::unique_ptr<Event> Remove(Event *e);
+  const Event *Top() const { return events_.front().get(); }
+  bool Empty() const { return events_.empty(); }
+  size_t Size() const { return events_.size(); }
+  void Clear() { events_.clear(); }
+
+ private:
+  std::unique_ptr<Event> RemoveAt(size_t index);
+  void SiftUp(size_t index);
+  void SiftDown(size_t index);
+
+  std::vector<std::unique_ptr<Event>> events_;
+};
+
+#endif //WSNET_CORE_SCHEDULER_EVENT_HEAP_H_
@@ -12,6 +12,11 @@
 #include <kernel/include/definitions/node.h>
 #include <kernel/include/scheduler/event.h>
 
+#ifdef __cplusplus
+#include <stdio.h>
+#include <vector>
+#endif
+
 /* ************************************************** */
 /* ************************************************** */
 #ifdef __cplusplus
@@ -23,18 +28,28 @@
  * \fn AddMobility() add a mobility event
  * \fn AddMilestone() add a milestone event
  * \fn AddTxEnd() add a tx_end event
- * \fn AddRxBegin() add a rx_begin event
+ * \fn AddRxBegin() add a rx_begin event, or the rx_begin events of a transmission as a single event
  * \fn AddRxEnd() add a rx_end event
  * \fn AddCallback() add a rx_end event
  * \fn AddRxEnd() add a callback event
- * \fn DeleteCallback() delete a callback event
+ * \fn DeleteCallback() delete a callback event, if it has not been executed yet
+ * \fn RescheduleCallback() move a pending callback event to another date
  * \fn NextEvent() return the next event to be executed
  * \fn CountEvents() return the number of events to be executed
  * \fn CountEventsExecuted() return the number of events already executed
  * \fn AddEventImpl() add an event - to be implemented
- * \fn DeleteEventImpl() delete an event - to be implemented
+ * \fn RemoveEventImpl() remove a given event from the queue - to be implemented
  * \fn NextEventImpl() return the next event to be executed - to be implemented
  * \fn CountEventsImpl() return the number of events to be executed - to be implemented
+ * \fn PrintStatsImpl() print the statistics specific to the implementation, if any
+ * \fn TraceOpenImpl() open the trace of the executed events, see scheduler_set_trace()
+ * \fn TraceEventImpl() trace an executed event, the receptions of a rx begin event one by one
+ * \fn TraceCloseImpl() close the trace of the executed events
+ *
+ * Callbacks are given a handle, i.e. an index in handles_, so that they can be
+ * found back from their event_t. A handle is released as soon as the callback
+ * leaves the queue and may then be reused: the uid tells whether an event_t
+ * still refers to the event stored under its handle.
  **/
 class Scheduler{
  public:
@@ -57,6 +72,7 @@ class Scheduler{
 
   event_t AddTxEnd(Time clock, call_t to, call_t from, packet_t *packet);
   event_t AddRxBegin(Time clock, call_t to, call_t from, packet_t *packet);
+  event_t AddRxBegin(call_t from, const rx_begin_t *receptions, int size);
   event_t AddRxEnd(Time clock, call_t to, call_t from, packet_t *packet);
 
   event_t AddTxEnd(Time clock,  SpectrumModel *spectrum, std::shared_ptr<Signal> signal);
@@ -65,11 +81,18 @@ class Scheduler{
 
   event_t AddCallback(Time clock, call_t to, call_t from, callback_t callback, void *arg);
   void DeleteCallback(event_t event_info);
+  event_t RescheduleCallback(event_t event_info, Time clock);
 
   int CountEvents();
   int CountEventsExecuted();
 
  protected:
+  static nodeid_t GetEventNode(const Event *e);  // node the event is destined to, -1 if none
+  // the trace is written by default, implementations may use it otherwise
+  virtual int TraceOpenImpl(const char *path);
+  virtual void TraceEventImpl(nodeid_t node, Time clock, event_priority_t priority);
+  virtual void TraceCloseImpl(void);
+
   bool running_;
   Time clock_;
   Time end_;
@@ -78,18 +101,33 @@ class Scheduler{
  private:
   void ExecuteEvent(std::unique_ptr<Event> e);
   event_t AddEvent(std::unique_ptr<Event> e);
-  void DeleteEvent(uid_t uid);
+  void DeleteEvent(event_t event_info);
   std::unique_ptr<Event> NextEvent();
+  Event *GetEventByHandle(event_t event_info);
+  void ReleaseHandle(Event *e);
   virtual int CountEventsImpl() = 0;
   virtual void AddEventImpl(std::unique_ptr<Event> e) = 0;
-  virtual void DeleteEventImpl(uid_t uid) = 0;
+  virtual std::unique_ptr<Event> RemoveEventImpl(Event *e) = 0;
   virtual std::unique_ptr<Event> NextEventImpl(void) = 0;
+  virtual void PrintStatsImpl(void){};
+
+  std::vector<Event*> handles_;    // pending callbacks, indexed by handle
+  std::vector<int> free_handles_;  // handles available for reuse
+  bool rx_begin_preempted_;        // an event has been added before the next reception due now
+  bool tracing_;                   // the executed events are traced, see scheduler_set_trace()
+  FILE *trace_;                    // trace written by the default implementation
 
 };
 #endif
 
 /* ************************************************** */
 /* ************************************************** */
+#define SCHEDULER_TYPE_STANDARD "standard" // binary heap from the STD containers
+#define SCHEDULER_TYPE_CALENDAR "calendar" // calendar queue
+#define SCHEDULER_TYPE_PARTITIONED "partitioned" // one queue per logical process, run one after the other over each window
+#define SCHEDULER_TYPE_PARTITIONED_CHECK "partitioned-check" // same, checking the run against the trace of a sequential run
+
+#define SCHEDULER_DEFAULT_PARTITIONS 8 // logical processes of the partitioned scheduler
 
 #ifdef __cplusplus
 extern "C"{
@@ -111,6 +149,17 @@ void scheduler_add_birth(uint64_t clock, nodeid_t id);
  **/
 void scheduler_add_rx_begin(uint64_t clock, call_t *to, call_t *from, packet_t *packet);
 
+/**
+ * \brief Add the rx begin events of a transmission to the scheduler, as a single event.
+ *        The receptions are executed in the order of their dates, exactly as if
+ *        they had been added one by one with scheduler_add_rx_begin(), but the
+ *        queue holds one event per transmission instead of one per receiver.
+ * \param from a call parameter, the transmitting interface.
+ * \param receptions the receptions, copied by the scheduler.
+ * \param size the number of receptions.
+ **/
+void scheduler_add_rx_begin_fanout(call_t *from, rx_begin_t *receptions, int size);
+
 /**
  * \brief Add a rx begin event to the scheduler.
  * \param clock, the rx begin date.
@@ -195,10 +244,42 @@ event_t *scheduler_add_callback(uint64_t clock, call_t *to, call_t *from, callba
 
 /** 
  * \brief Delete an event from the Scheduler.
+ *        The event is removed from the queue if it has not been executed yet, and
+ *        the event_t returned by scheduler_add_callback() is released in any case.
  * \param event a paramater that describe the event we want to delete.
  **/
 void scheduler_delete_callback(event_t *event);
 
+/**
+ * \brief Schedule the callback of a function at a given time, the event being
+ *        described in a structure owned by the caller (no allocation is made).
+ * \param event filled with the description of the event.
+ * \param clock time of the callback.
+ * \param to a call parameter given to the callback function.
+ * \param from a call parameter given to the callback function.
+ * \param callback the function that is called back.
+ * \param arg a paramater that given to the callback function.
+ * \return Return 0 in case of success, -1 if the date is out of the simulation.
+ **/
+int scheduler_add_callback_event(event_t *event, uint64_t clock, call_t *to, call_t *from, callback_t callback, void *arg);
+
+/**
+ * \brief Remove a callback from the Scheduler, if it has not been executed yet.
+ *        Cancelling an executed or already cancelled callback has no effect.
+ * \param event the description of the event filled by scheduler_add_callback_event().
+ **/
+void scheduler_cancel_callback(event_t *event);
+
+/**
+ * \brief Move a callback that has not been executed yet to another date.
+ *        The callback is ordered as if it had been cancelled and added again.
+ * \param event the description of the event, updated with its new date.
+ * \param clock the new time of the callback.
+ * \return Return 0 in case of success, -1 if the callback is no longer pending
+ *         or if the date is out of the simulation.
+ **/
+int scheduler_reschedule_callback(event_t *event, uint64_t clock);
+
 /** 
  * \brief Return the date of the end of the simulation.
  * \return Return a long long unsigned int.
@@ -229,6 +310,37 @@ int do_observe(void);
 uint64_t get_time(void);
 
 
+/**
+ * \brief Select the scheduler implementation. Must be called before any event is scheduled.
+ * \param type the scheduler name, SCHEDULER_TYPE_STANDARD, SCHEDULER_TYPE_CALENDAR,
+ *        SCHEDULER_TYPE_PARTITIONED or SCHEDULER_TYPE_PARTITIONED_CHECK.
+ * \return Return 0 in case of success, -1 else.
+ **/
+int scheduler_set_type(const char *type);
+
+/**
+ * \brief Set the number of logical processes of the partitioned scheduler.
+ *        Must be called before scheduler_set_type().
+ * \param nbr_partitions the number of logical processes, at least 1.
+ * \return Return 0 in case of success, -1 else.
+ **/
+int scheduler_set_partitions(int nbr_partitions);
+
+/**
+ * \brief Set the trace of the executed events, one "node clock priority" line per event.
+ *        The partitioned-check scheduler compares its run to it, node by node,
+ *        the other schedulers write it.
+ * \param path the trace file.
+ * \return Return 0 in case of success, -1 else.
+ **/
+int scheduler_set_trace(const char *path);
+
+/**
+ * \brief Return the name of the scheduler implementation in use.
+ * \return The scheduler name.
+ **/
+const char *scheduler_get_type(void);
+
 /** 
  * \brief Set the end of the simulation.
  * \param end the date of the end of the simulation.
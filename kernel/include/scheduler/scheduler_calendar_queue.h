@@ -0,0 +1,61 @@
+/**
+ *  \file   scheduler_calendar_queue.h
+ *  \brief  Scheduler implementation using a calendar queue
+ *      Events are hashed by date into a circular array of buckets
+ *      (the "days" of a "year"), each bucket being a small sorted vector.
+ *      With a bucket width close to the mean time between events,
+ *      adding and extracting an event costs O(1) on average instead
+ *      of the O(log n) of a binary heap.
+ *
+ *      The number of buckets doubles (resp. halves) when the number
+ *      of events gets higher than twice (resp. lower than half) the
+ *      number of buckets, the bucket width being recomputed from the
+ *      earliest events at each resize (R. Brown, "Calendar queues", 1988).
+ *
+ *      Events are still ordered by (clock, priority, uid), so both
+ *      implementations execute events in the very same order.
+ *      Deleted callbacks are removed right away from their bucket.
+ *  \author agent
+ *  \date   2026
+ **/
+
+#ifndef WSNET_CORE_SCHEDULER_SCHEDULER_CALENDAR_QUEUE_H_
+#define WSNET_CORE_SCHEDULER_SCHEDULER_CALENDAR_QUEUE_H_
+
+#include <vector>
+#include <kernel/include/scheduler/scheduler.h>
+
+/** \brief SchedulerCalendarQueue: The Scheduler implementation using a calendar queue
+ *
+ * \fn AddEventImpl() add an event in its bucket
+ * \fn RemoveEventImpl() remove an event from its bucket
+ * \fn NextEventImpl() return the next event to be executed
+ * \fn CountEventsImpl() return the number of events on the queue
+ **/
+class SchedulerCalendarQueue : public Scheduler {
+ public:
+  SchedulerCalendarQueue();
+  SchedulerCalendarQueue(Time end);
+  ~SchedulerCalendarQueue();
+ private:
+  // events of a bucket are sorted by decreasing order, the earliest one being at the back
+  typedef std::vector<std::unique_ptr<Event>> Bucket;
+
+  void AddEventImpl(std::unique_ptr<Event> e_);
+  std::unique_ptr<Event> RemoveEventImpl(Event *e_);
+  std::unique_ptr<Event> NextEventImpl();
+  int CountEventsImpl();
+
+  void InsertInBucket(std::unique_ptr<Event> e_);
+  void SetCurrentBucket(Time clock);
+  void Resize(size_t nbr_buckets);
+  Time ComputeBucketWidth(std::vector<std::unique_ptr<Event>> &events);
+
+  std::vector<Bucket> buckets_;
+  Time bucket_width_;
+  size_t current_bucket_;
+  Time current_bucket_top_; // end (excluded) of the current bucket for the current year
+  size_t nbr_events_;
+};
+
+#endif //WSNET_CORE_SCHEDULER_SCHEDULER_CALENDAR_QUEUE_H_
@@ -0,0 +1,135 @@
+/**
+ *  \file   scheduler_partitioned.h
+ *  \brief  Scheduler running the nodes as logical processes, one after the other over each window
+ *      Nodes are split into logical processes (LP), i.e. stripes along the
+ *      x axis holding the same number of nodes, each LP having its own event
+ *      queue and its own clock. Events are given to the LP of the node they
+ *      are destined to, the rx begin event of a transmission being split
+ *      between the LPs of its receivers; events that are not bound to a node
+ *      (quit, milestone, mobility, signal events, callbacks with no node)
+ *      belong to a global LP.
+ *
+ *      Two nodes of different LPs are at least as far as the gap between
+ *      their stripes, thus a packet sent by one of them can not reach the other
+ *      one before the propagation delay over this gap: this is the lookahead,
+ *      computed from the nodes positions and medium->speed_of_light. Time is
+ *      cut into windows [t, t + lookahead), t being the date of the earliest
+ *      pending event, following the YAWNS protocol (Nicol, 1993). Within a
+ *      window, the LPs do not depend on each other: they are run one after the
+ *      other, each one up to the end of the window, i.e. in one of the orders
+ *      a run of the LPs on threads could give, each LP keeping the (clock,
+ *      priority, uid) order. Global events are barriers, alone in their own
+ *      window, as every event is when the lookahead is null. The run is thus
+ *      deterministic given the seed.
+ *
+ *      The transmission duration is not part of the lookahead: the carrier
+ *      sense of the receivers starts at the rx begin, i.e. after the
+ *      propagation delay only, and may change what they send next.
+ *
+ *      The LPs are not run on threads: models share global state (memory
+ *      slices, random generators, packet ids, monitors) which is not
+ *      protected. Running them one after the other shows what such a run
+ *      would give, and which models depend on this shared state.
+ *
+ *      The scheduler counts the windows, the parallelism a run of the LPs on
+ *      threads would have, the lookahead violations, i.e. events scheduled
+ *      from one LP to another one within the current window, and the events
+ *      executed by an LP once past their date, which the violations lead
+ *      to. The check mode compares the events executed by each node to the
+ *      trace of a sequential run (see scheduler_set_trace()): models drawing
+ *      from the shared random generators see the draws in another order and
+ *      are reported as well.
+ *
+ *      Positions are updated at the start of the windows; the lookahead is
+ *      recomputed after each mobility event. Mobility models moving the nodes
+ *      at each clock advance may still break it, which the check mode reports.
+ *  \author agent
+ *  \date   2026
+ **/
+
+#ifndef WSNET_CORE_SCHEDULER_SCHEDULER_PARTITIONED_H_
+#define WSNET_CORE_SCHEDULER_SCHEDULER_PARTITIONED_H_
+
+#include <vector>
+#include <kernel/include/scheduler/scheduler.h>
+#include <kernel/include/scheduler/event_heap.h>
+
+/** \brief SchedulerPartitioned: The Scheduler implementation running the logical processes one after the other over each window
+ *
+ * \fn AddEventImpl() add an event in the queue of its logical process
+ * \fn RemoveEventImpl() remove an event from the queue of its logical process
+ * \fn NextEventImpl() return the next event of the current logical process, opening a new window when needed
+ * \fn CountEventsImpl() return the number of events on the queues
+ * \fn PrintStatsImpl() print the windows and lookahead statistics, and the check result
+ * \fn TraceOpenImpl() read the trace of a sequential run, check mode only
+ * \fn TraceEventImpl() compare an executed event to the trace of its node, check mode only
+ * \fn TraceCloseImpl() count the events of the trace that have not been executed, check mode only
+ **/
+class SchedulerPartitioned : public Scheduler {
+ public:
+  SchedulerPartitioned(int nbr_partitions, bool check);
+  SchedulerPartitioned(Time end, int nbr_partitions, bool check);
+  ~SchedulerPartitioned();
+
+  int CountPartitions();
+  Time GetLookahead();
+  uint64_t CountWindows();
+  uint64_t CountViolations();
+  uint64_t CountStragglers();
+  uint64_t CountMismatches();
+
+ private:
+  void AddEventImpl(std::unique_ptr<Event> e_);
+  std::unique_ptr<Event> RemoveEventImpl(Event *e_);
+  std::unique_ptr<Event> NextEventImpl();
+  int CountEventsImpl();
+  void PrintStatsImpl();
+  int TraceOpenImpl(const char *path);
+  void TraceEventImpl(nodeid_t node, Time clock, event_priority_t priority);
+  void TraceCloseImpl();
+
+  int GetPartition(nodeid_t node);
+  int GetPartition(const Event *e_);
+  void PushEvent(std::unique_ptr<Event> e_);
+  void CreatePartitions();
+  void ComputeLookahead();
+  bool InWindow(int partition);
+  int NextPartition();
+  int OpenWindow();
+  void CloseWindow();
+  void CheckLookahead(Time clock, int partition);
+  void CheckOrder(int partition, const Event *e_);
+
+  int nbr_partitions_;                 // number of LPs requested, the global LP excluded
+  bool check_;
+  bool partitioned_;                   // nodes are partitioned at the first event
+  std::vector<EventHeap> partitions_;  // event queue of each LP, the global LP being the first one
+  std::vector<int> node_partitions_;   // LP of each node, indexed by node id
+  std::vector<Time> partition_clocks_; // date reached by each LP
+  size_t nbr_events_;
+
+  Time lookahead_;
+  bool lookahead_outdated_;            // a mobility event has been executed
+  Time window_start_;
+  Time window_end_;                    // end (excluded) of the current window
+  int current_partition_;              // LP of the event being executed
+  const Event *current_event_;         // event being executed, only compared to the events added
+
+  std::vector<uint64_t> window_events_; // events executed by each LP in the current window
+  std::vector<int> window_partitions_;  // LPs that executed events in the current window
+  uint64_t nbr_windows_;
+  uint64_t nbr_barriers_;
+  uint64_t nbr_window_events_;
+  uint64_t nbr_critical_events_;       // sum over the windows of the events of the busiest LP
+  uint64_t nbr_violations_;
+  uint64_t nbr_stragglers_;            // events executed by an LP once past their date
+
+  // check mode: the events of each node in the trace of a sequential run, the
+  // global events first, and the next one to be executed
+  std::vector<std::vector<std::pair<Time, event_priority_t>>> trace_events_;
+  std::vector<size_t> trace_next_;
+  bool trace_checked_;
+  uint64_t nbr_mismatches_;            // events differing from the trace, or missing
+};
+
+#endif //WSNET_CORE_SCHEDULER_SCHEDULER_PARTITIONED_H_
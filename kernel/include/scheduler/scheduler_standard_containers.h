@@ -1,22 +1,14 @@
 /**
  *  \file   scheduler_standard_containers.h
  *  \brief  Scheduler implementation using C++'s STD containers
- *      We use a priority queue for all events along with an
- *      unordered set used to store the uid of deleted_callbacks.
+ *      We use a binary heap, stored in a std::vector, for all events.
  *
- *      Thus, whenever a callback event is the next, we check whether
- *      it has been deleted or not by looking for its uid inside the
- *      unordered set. (O(1) complexity - considering our hash won't have collisions)
- *
- *      We could use only a priority queue, but this would imply that while
- *      deleting a callback we would need to either :
- *       - pop elements until you find and then insert them again
- *       - inherit the std::priority_queue and find the element on the protected
- *         container, delete it, and make a heap with the remaining elements.
- *      Both solutions would have a higher time complexity (O(nlogn) at least).
- *
- *      The extra memory needed is low compared to time gains, once we are only
- *      storing the uid's of the events that have been deleted.
+ *      Each event knows its position in the heap (queue_index_), which is
+ *      kept up to date whenever the event moves. Thus, deleting a callback
+ *      removes it right away from the heap in O(log n), instead of leaving it
+ *      in the queue until its date, as a std::priority_queue along with a set
+ *      of deleted uids would do. Timers that are often cancelled and
+ *      rescheduled (e.g. by MAC protocols) do not fill the queue anymore.
  *  \author Luiz Henrique Suraty Filho
  *  \date   2018
  **/
@@ -24,14 +16,13 @@
 #ifndef WSNET_CORE_SCHEDULER_SCHEDULER_STD_H_
 #define WSNET_CORE_SCHEDULER_SCHEDULER_STD_H_
 
-#include <unordered_set>
-#include <queue>
 #include <kernel/include/scheduler/scheduler.h>
+#include <kernel/include/scheduler/event_heap.h>
 
 /** \brief SchedulerStandardContainers: The Scheduler implementation using C++'s STD containers
  *
- * \fn AddEventImpl() add an event in the priority queue
- * \fn DeleteEventImpl() delete an event (mark an event as deleted on the unordered set)
+ * \fn AddEventImpl() add an event in the heap
+ * \fn RemoveEventImpl() remove an event from the heap
  * \fn NextEventImpl() return the next event to be executed
  * \fn CountEventsImpl() return the number of events on the queue
  **/
@@ -42,11 +33,11 @@ class SchedulerStandardContainers : public Scheduler {
   ~SchedulerStandardContainers();
  private:
   void AddEventImpl(std::unique_ptr<Event> e_);
-  void DeleteEventImpl(uid_t uid);
+  std::unique_ptr<Event> RemoveEventImpl(Event *e_);
   std::unique_ptr<Event> NextEventImpl();
   int CountEventsImpl();
-  std::priority_queue<std::unique_ptr<Event>, std::vector<std::unique_ptr<Event>>, CompareEventGreater> events_queue_;
-  std::unordered_set<uid_t> deleted_events_;
+
+  EventHeap events_queue_;
 };
 
 #endif //WSNET_CORE_SCHEDULER_SCHEDULER_STD_H_
@@ -0,0 +1,219 @@
+/**
+ *  \file   ber_table.h
+ *  \brief  Interpolated SNR to BER lookup table
+ *
+ *          A ber_table_t tabulates a BER function of the (linear) snr over a
+ *          dB range, so that modulation models can replace their erfc/exp
+ *          computations by a lookup.
+ *
+ *          The points of the table are the doubles whose mantissa has only its
+ *          k upper bits set: each octave of snr (3.01 dB) is divided into 2^k
+ *          cells of equal width, so the cells are at most 10/ln(10) * 2^-k dB
+ *          wide, and the cell of an snr is read from its bits, without any
+ *          logarithm. The BER is linearly interpolated between the two points
+ *          of the cell.
+ *
+ *          Error bound: on a cell [x, x + h], h = x * 2^-k, the interpolation
+ *          error is at most h^2 / 8 * max |BER''|, i.e. 2^-2k / 8 * max x^2 |BER''(x)|.
+ *          For the bpsk, fsk, oqpsk and mqam curves x^2 |BER''(x)| stays below 0.5,
+ *          so the absolute error is below 2^-2k / 16: about 4e-6 at the default
+ *          0.05 dB resolution (k = 7). The error measured at the middle of each
+ *          cell is kept in the table.
+ *
+ *  \author agent
+ *  \date   2026
+ **/
+#ifndef WSNET_CORE_INCLUDE_TOOLS_MATH_BER_TABLE_BER_TABLE_H_
+#define WSNET_CORE_INCLUDE_TOOLS_MATH_BER_TABLE_BER_TABLE_H_
+
+#include <stdint.h>
+#include <string.h>
+
+
+/* ************************************************** */
+/* ************************************************** */
+/** \def BER_TABLE_MIN_DB
+ * \brief The default lower bound of the table, in dB.
+ **/
+#define BER_TABLE_MIN_DB -10.0
+
+/** \def BER_TABLE_MAX_DB
+ * \brief The default upper bound of the table, in dB.
+ **/
+#define BER_TABLE_MAX_DB 30.0
+
+/** \def BER_TABLE_RESOLUTION_DB
+ * \brief The default maximum width of the table cells, in dB.
+ **/
+#define BER_TABLE_RESOLUTION_DB 0.05
+
+/** \def BER_TABLE_MAX_SIZE
+ * \brief The maximum number of points of a table.
+ **/
+#define BER_TABLE_MAX_SIZE (1 << 22)
+
+/**
+ * \brief The tabulated function, data is passed back untouched.
+ **/
+typedef double (*ber_function_t) (void *data, double snr);
+
+typedef struct _ber_table {
+  double   *ber;   /* the BER of each point, NULL if the table is empty (zeroed) */
+  int       size;  /* number of points */
+  int       shift; /* number of mantissa bits dropped to get the point of an snr */
+  uint64_t  first; /* bits of the first point, shifted */
+  uint64_t  mask;  /* mantissa bits dropped */
+  double    scale; /* 2^-shift, position of an snr in its cell */
+  double    min;   /* first point */
+  double    max;   /* last point */
+  double    error; /* maximum error measured at the middle of the cells */
+} ber_table_t;
+
+
+#ifdef __cplusplus
+extern "C"{
+#endif //__cplusplus
+/* ************************************************** */
+/* ************************************************** */
+/**
+ * \brief Tabulate a BER function.
+ * \param table the table, left empty in case of failure.
+ * \param min_dB, max_dB the snr range of the table, in dB.
+ * \param resolution_dB the maximum width of the cells, in dB.
+ * \param function the BER function.
+ * \param data the data given to the function.
+ * \return 0 in case of success, -1 else.
+ **/
+int ber_table_build(ber_table_t *table, double min_dB, double max_dB, double resolution_dB, ber_function_t function, void *data);
+
+/**
+ * \brief Tabulate a BER function as set by the class parameters of a modulation:
+ *        "ber" (exact, the default, or table), "ber-table-min", "ber-table-max"
+ *        and "ber-table-resolution".
+ * \param table the table, left empty in exact mode or in case of failure.
+ * \param params the class parameters, a list of param_t, may be NULL.
+ * \param name the modulation name, for the error messages.
+ * \param function the BER function.
+ * \param data the data given to the function.
+ * \return 0 in case of success, -1 else.
+ **/
+int ber_table_from_params(ber_table_t *table, void *params, const char *name, ber_function_t function, void *data);
+
+/**
+ * \brief Free the points of a table, which is left empty.
+ * \param table the table.
+ **/
+void ber_table_destroy(ber_table_t *table);
+
+/**
+ * \brief Tell whether an snr is in the table range.
+ * \param table the table.
+ * \param snr the linear snr.
+ * \return 1 if snr is in the table range, 0 else (including an empty table).
+ **/
+static inline int ber_table_contains(const ber_table_t *table, double snr) {
+  return (snr >= table->min) && (snr < table->max);
+}
+
+/**
+ * \brief Interpolate the BER of an snr in the table range.
+ * \param table the table, not empty.
+ * \param snr the linear snr, in the table range.
+ * \return The BER.
+ **/
+static inline double ber_table_interpolate(const ber_table_t *table, double snr) {
+  uint64_t bits;
+  uint64_t point;
+  double   position;
+
+  memcpy(&bits, &snr, sizeof(bits));
+  point = (bits >> table->shift) - table->first;
+  position = (double) (bits & table->mask) * table->scale;
+  return table->ber[point] + position * (table->ber[point + 1] - table->ber[point]);
+}
+
+/**
+ * \brief Interpolate the BER of an snr.
+ * \param table the table.
+ * \param snr the linear snr.
+ * \param ber filled with the BER if snr is in the table range.
+ * \return 0 if snr is in the table range, -1 else (including an empty table).
+ **/
+static inline int ber_table_lookup(const ber_table_t *table, double snr, double *ber) {
+  if (!ber_table_contains(table, snr)) {
+    return -1;
+  }
+
+  *ber = ber_table_interpolate(table, snr);
+  return 0;
+}
+
+/**
+ * \brief Interpolate the BER of n snr, without any branch in the loop.
+ *        snr and ber may be the same array.
+ * \param table the table.
+ * \param snr the linear snr.
+ * \param ber filled with the BER of each snr in the table range, the others
+ *        being copied untouched for the caller (see ber_table_evaluate_batch()).
+ * \param outside filled with the indices of the snr out of the table range,
+ *        at least n entries.
+ * \param n the number of snr.
+ * \return The number of snr out of the table range, n for an empty table.
+ **/
+static inline int ber_table_lookup_batch(const ber_table_t *table, const double *snr, double *ber, int *outside, int n) {
+  int count = 0;
+  int i;
+
+  if (table->ber == NULL) {
+    for (i = 0; i < n; i++) {
+      ber[i] = snr[i];
+      outside[i] = i;
+    }
+    return n;
+  }
+
+  for (i = 0; i < n; i++) {
+    double x = snr[i];
+    int inside = ber_table_contains(table, x);
+    double interpolated = ber_table_interpolate(table, inside ? x : table->min);
+    ber[i] = inside ? interpolated : x;
+    outside[count] = i;
+    count += !inside;
+  }
+  return count;
+}
+
+/** \def BER_TABLE_BATCH
+ * \brief The number of snr looked up at once by ber_table_evaluate_batch().
+ **/
+#define BER_TABLE_BATCH 64
+
+/**
+ * \brief Compute the BER of n snr, interpolated in the table range and given
+ *        by the BER function out of it. snr and ber may be the same array.
+ * \param table the table.
+ * \param snr the linear snr.
+ * \param ber filled with the BER of each snr.
+ * \param n the number of snr.
+ * \param function the BER function, for the snr out of the table range.
+ * \param data the data given to the function.
+ **/
+static inline void ber_table_evaluate_batch(const ber_table_t *table, const double *snr, double *ber, int n,
+                                            ber_function_t function, void *data) {
+  int outside[BER_TABLE_BATCH];
+  int i, j;
+
+  for (i = 0; i < n; i += BER_TABLE_BATCH) {
+    int size = (n - i < BER_TABLE_BATCH) ? (n - i) : BER_TABLE_BATCH;
+    int count = ber_table_lookup_batch(table, snr + i, ber + i, outside, size);
+    for (j = 0; j < count; j++) {
+      ber[i + outside[j]] = function(data, ber[i + outside[j]]);
+    }
+  }
+}
+
+#ifdef __cplusplus
+}
+#endif //__cplusplus
+
+#endif // WSNET_CORE_INCLUDE_TOOLS_MATH_BER_TABLE_BER_TABLE_H_
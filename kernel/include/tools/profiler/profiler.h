@@ -0,0 +1,132 @@
+/**
+ *  \file   profiler.h
+ *  \brief  Simulation profiling counters
+ *
+ *          When enabled (-P option), the profiler counts the events executed
+ *          by the scheduler along with their wall time, per event type and,
+ *          for the callbacks, per class. The kernel surrounds the calls to the
+ *          model methods with profiler_enter()/profiler_leave(), so that the
+ *          wall time is charged to the class whose method is running: each
+ *          class gets its own time, without the time of the methods of other
+ *          classes it calls. The time spent out of any model method is charged
+ *          to the kernel.
+ *
+ *          The counters, the peak size of the events queue and the mem_fs
+ *          counters are written as JSON at the end of the simulation.
+ *
+ *  \author agent
+ *  \date   2026
+ **/
+#ifndef WSNET_CORE_INCLUDE_TOOLS_PROFILER_PROFILER_H_
+#define WSNET_CORE_INCLUDE_TOOLS_PROFILER_PROFILER_H_
+
+#include <stdint.h>
+
+
+/* ************************************************** */
+/* ************************************************** */
+/** \def PROFILER_MAX_EVENT_TYPES
+ * \brief The maximum number of event types.
+ **/
+#define PROFILER_MAX_EVENT_TYPES 32
+
+/** \def PROFILER_MAX_DEPTH
+ * \brief The maximum nesting of the model methods calls, the deeper ones are charged to their caller.
+ **/
+#define PROFILER_MAX_DEPTH 256
+
+/** \def PROFILER_KERNEL
+ * \brief The class id under which the kernel time is counted.
+ **/
+#define PROFILER_KERNEL -1
+
+/* 1 when profiling, to be tested through the inline functions below */
+extern int profiler_enabled;
+
+
+#ifdef __cplusplus
+extern "C"{
+#endif //__cplusplus
+/* ************************************************** */
+/* ************************************************** */
+/**
+ * \brief Enable the profiler.
+ * \param path the JSON output file, "-" for the standard output.
+ **/
+void profiler_set_output(const char *path);
+
+/**
+ * \brief Start the wall time counters, called when the simulation starts.
+ **/
+void profiler_start(void);
+
+/**
+ * \brief Write the counters, called when the simulation ends.
+ * \param simulated_time the simulated time.
+ * \return 0 in case of success, -1 else.
+ **/
+int profiler_write(uint64_t simulated_time);
+
+/**
+ * \brief Free the counters.
+ **/
+void profiler_clean(void);
+
+/**
+ * \brief Return the wall clock.
+ * \return The monotonic wall clock, in ns.
+ **/
+uint64_t profiler_clock(void);
+
+void profiler_do_enter(int classid);
+void profiler_do_leave(void);
+void profiler_do_event(int type, const char *name, int classid, uint64_t start);
+void profiler_do_queue(int size);
+
+/**
+ * \brief Charge the wall time to a class until the matching profiler_leave().
+ * \param classid the class whose method is called.
+ **/
+static inline void profiler_enter(int classid) {
+  if (profiler_enabled) {
+    profiler_do_enter(classid);
+  }
+}
+
+/**
+ * \brief Charge the wall time back to the caller of the last profiler_enter().
+ **/
+static inline void profiler_leave(void) {
+  if (profiler_enabled) {
+    profiler_do_leave();
+  }
+}
+
+/**
+ * \brief Count an executed event.
+ * \param type the event type, in [0, PROFILER_MAX_EVENT_TYPES).
+ * \param name the event type name, kept as is.
+ * \param classid the class called back, PROFILER_KERNEL else.
+ * \param start the profiler_clock() value when the event execution started.
+ **/
+static inline void profiler_event(int type, const char *name, int classid, uint64_t start) {
+  if (profiler_enabled) {
+    profiler_do_event(type, name, classid, start);
+  }
+}
+
+/**
+ * \brief Record the size of the events queue, to keep its peak.
+ * \param size the number of events in the queue.
+ **/
+static inline void profiler_queue(int size) {
+  if (profiler_enabled) {
+    profiler_do_queue(size);
+  }
+}
+
+#ifdef __cplusplus
+}
+#endif //__cplusplus
+
+#endif // WSNET_CORE_INCLUDE_TOOLS_PROFILER_PROFILER_H_
@@ -24,6 +24,7 @@ static char *schemafile      = DEFAULT_SCHEMAFILE;
 static char *configfile      = DEFAULT_CONFIGFILE;
 static char *user_modulesdir = NULL;
 static char *sys_modulesdir  = DEFAULT_MODULESDIR;
+static char *scheduler_type  = NULL;
 
 gchar **user_path_list;
 gchar **sys_path_list;
@@ -48,6 +49,16 @@ void config_set_sys_modulesdir(char *c)
   sys_modulesdir = c;
 }
 
+void config_set_scheduler(char *c)
+{
+  scheduler_type = c;
+}
+
+char *config_get_scheduler(void)
+{
+  return scheduler_type;
+}
+
 void config_set_usr_modulesdir(void)
 {
   char *env_moddir = getenv(ENV_MODDIR);
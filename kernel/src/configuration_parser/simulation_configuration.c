@@ -29,6 +29,7 @@ void print_simulation(void)
 	fprintf(stderr, "\nSimulation will run using:\n");
 	fprintf(stderr, "   - nodes      : %d\n", nodes.size);
 	fprintf(stderr, "   - groups     : %d\n", groups.size);
+	fprintf(stderr, "   - scheduler  : %s\n", scheduler_get_type());
 
 	if (scheduler_get_end()) {
 		fprintf(stderr, "   - duration   : %" PRId64 " ns\n", scheduler_get_end());
@@ -657,6 +658,9 @@ void simulation_set_global_map(int id) {
 int parse_simulation_begin(xmlNodeSetPtr nodeset) {
 	xmlNodePtr nd1 = nodeset->nodeTab[0];
 	char *duration_str;
+	char *scheduler_str;
+	char *partitions_str;
+	char *trace_str;
 
 	DBG_SIMULATION("\n\n===============SIMULATION================\n");
 	DBG_SIMULATION("\n===Begin parsing simulation===\n");
@@ -665,6 +669,38 @@ int parse_simulation_begin(xmlNodeSetPtr nodeset) {
 	monitors.size = 0;
 	monitors.elts = NULL;
 
+	/* get the number of logical processes of the partitioned scheduler */
+	if ((partitions_str = get_xml_attr_content(nd1, XML_A_PARTITIONS)) != NULL) {
+		int partitions;
+		if (get_param_integer(partitions_str, &partitions) || scheduler_set_partitions(partitions)) {
+			fprintf(stderr, "config: bad number of partitions '%s' (parse_simulation_begin())\n", partitions_str);
+			return -1;
+		}
+		DBG_SIMULATION("Simulation: partitions = %s\n", partitions_str);
+	}
+
+	/* get the trace of the executed events, written or checked by the scheduler */
+	if ((trace_str = get_xml_attr_content(nd1, XML_A_TRACE)) != NULL) {
+		if (scheduler_set_trace(trace_str)) {
+			fprintf(stderr, "config: bad trace file '%s' (parse_simulation_begin())\n", trace_str);
+			return -1;
+		}
+		DBG_SIMULATION("Simulation: trace = %s\n", trace_str);
+	}
+
+	/* get the scheduler implementation, the command line prevails over the configuration file */
+	if ((scheduler_str = config_get_scheduler()) == NULL) {
+		scheduler_str = get_xml_attr_content(nd1, XML_A_SCHEDULER);
+	}
+
+	if (scheduler_str != NULL) {
+		if (scheduler_set_type(scheduler_str)) {
+			fprintf(stderr, "config: unknown scheduler '%s' (parse_simulation_begin())\n", scheduler_str);
+			return -1;
+		}
+		DBG_SIMULATION("Simulation: scheduler = %s\n", scheduler_str);
+	}
+
 	/* get duration of the simulation */
 	if ((duration_str = get_xml_attr_content(nd1, XML_A_DURATION)) != NULL) {
 		uint64_t duration;
@@ -149,10 +149,10 @@ void hashtable_delete(hashtable_t *hashtable, void *key) {
 /* ************************************************** */
 /* ************************************************** */
 unsigned long hash_string(void *string) {
-  int index;
+  char *c;
   unsigned long hash = 0;
-  for (index = 0; index < (int)strlen((char *) string); index++) {
-    hash += ((char *) string)[index] + (hash << 6) + (hash << 16) - hash;
+  for (c = (char *) string; *c != '\0'; c++) {
+    hash += *c + (hash << 6) + (hash << 16) - hash;
   }
   return (unsigned long) hash & SIGNEDSHORT;
 }
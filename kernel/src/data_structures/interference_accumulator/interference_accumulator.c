@@ -0,0 +1,479 @@
+/**
+ *  \file   interference_accumulator.c
+ *  \brief  Time-indexed interference accumulator
+ *  \author agent
+ *  \date   2026
+ **/
+#include <stdlib.h>
+#include <string.h>
+
+#include <kernel/include/data_structures/mem_fs/mem_fs.h>
+#include "interference_accumulator.h"
+
+
+/* ************************************************** */
+/* ************************************************** */
+#define INTERFERENCE_ACCUMULATOR_SEED 2463534242U
+
+struct _interference_segment {
+  uint64_t begin;
+  uint64_t end;
+  uint64_t first;      /* begin of the subtree */
+  uint64_t last;       /* end of the subtree */
+  uint64_t duration;   /* total duration of the subtree */
+  int      active;     /* signals not released yet over the segment */
+  int      min_active; /* minimum of active over the subtree */
+  uint32_t priority;
+
+  double   power[INTERFERENCE_CHANNELS];
+  double   max[INTERFERENCE_CHANNELS];    /* maximum power of the subtree */
+  double   energy[INTERFERENCE_CHANNELS]; /* sum of power * duration over the subtree */
+
+  /* addition applied to the segment but not yet to its children */
+  int      lazy;
+  int      lazy_active;
+  double   lazy_power[INTERFERENCE_CHANNELS];
+
+  struct _interference_segment *left;
+  struct _interference_segment *right;
+};
+
+static void *mem_segment = NULL;
+
+
+/* ************************************************** */
+/* ************************************************** */
+static inline uint32_t interference_accumulator_priority(interference_accumulator_t *accumulator) {
+  /* xorshift, the simulation random generators must not be disturbed */
+  uint32_t seed = accumulator->seed;
+  seed ^= seed << 13;
+  seed ^= seed >> 17;
+  seed ^= seed << 5;
+  return accumulator->seed = seed;
+}
+
+static inline void segment_apply(interference_segment_t *segment, const double *power, int active) {
+  int i;
+
+  if (segment == NULL) {
+    return;
+  }
+
+  if (power) {
+    for (i = 0; i < INTERFERENCE_CHANNELS; i++) {
+      segment->power[i]      += power[i];
+      segment->max[i]        += power[i];
+      segment->energy[i]     += power[i] * (double) segment->duration;
+      segment->lazy_power[i] += power[i];
+    }
+    segment->lazy = 1;
+  }
+  segment->active      += active;
+  segment->min_active  += active;
+  segment->lazy_active += active;
+}
+
+static inline void segment_push(interference_segment_t *segment) {
+  if (segment->lazy) {
+    segment_apply(segment->left, segment->lazy_power, 0);
+    segment_apply(segment->right, segment->lazy_power, 0);
+    memset(segment->lazy_power, 0, sizeof(segment->lazy_power));
+    segment->lazy = 0;
+  }
+  if (segment->lazy_active) {
+    segment_apply(segment->left, NULL, segment->lazy_active);
+    segment_apply(segment->right, NULL, segment->lazy_active);
+    segment->lazy_active = 0;
+  }
+}
+
+/* update the active signals of a subtree from its children */
+static inline void segment_pull_active(interference_segment_t *segment) {
+  interference_segment_t *left = segment->left, *right = segment->right;
+
+  segment->min_active = segment->active;
+  if (left && (left->min_active < segment->min_active)) {
+    segment->min_active = left->min_active;
+  }
+  if (right && (right->min_active < segment->min_active)) {
+    segment->min_active = right->min_active;
+  }
+}
+
+static inline void segment_pull(interference_segment_t *segment) {
+  interference_segment_t *left = segment->left, *right = segment->right;
+  uint64_t duration = segment->end - segment->begin;
+  int i;
+
+  segment_pull_active(segment);
+  segment->first = left ? left->first : segment->begin;
+  segment->last = right ? right->last : segment->end;
+  segment->duration = duration;
+  if (left) {
+    segment->duration += left->duration;
+  }
+  if (right) {
+    segment->duration += right->duration;
+  }
+
+  for (i = 0; i < INTERFERENCE_CHANNELS; i++) {
+    double max = segment->power[i];
+    double energy = segment->power[i] * (double) duration;
+
+    if (left) {
+      max = (left->max[i] > max) ? left->max[i] : max;
+      energy += left->energy[i];
+    }
+    if (right) {
+      max = (right->max[i] > max) ? right->max[i] : max;
+      energy += right->energy[i];
+    }
+    segment->max[i] = max;
+    segment->energy[i] = energy;
+  }
+}
+
+static interference_segment_t *segment_create(interference_accumulator_t *accumulator, uint64_t begin, uint64_t end,
+                                              const double *power, int active) {
+  interference_segment_t *segment = (interference_segment_t *) mem_fs_alloc(mem_segment);
+
+  segment->begin = begin;
+  segment->end = end;
+  segment->active = active;
+  segment->priority = interference_accumulator_priority(accumulator);
+  if (power) {
+    memcpy(segment->power, power, sizeof(segment->power));
+  } else {
+    memset(segment->power, 0, sizeof(segment->power));
+  }
+  segment->lazy = 0;
+  segment->lazy_active = 0;
+  memset(segment->lazy_power, 0, sizeof(segment->lazy_power));
+  segment->left = NULL;
+  segment->right = NULL;
+  segment_pull(segment);
+
+  accumulator->size++;
+  return segment;
+}
+
+static void segment_destroy(interference_accumulator_t *accumulator, interference_segment_t *segment) {
+  if (segment == NULL) {
+    return;
+  }
+
+  segment_destroy(accumulator, segment->left);
+  segment_destroy(accumulator, segment->right);
+  mem_fs_dealloc(mem_segment, segment);
+  accumulator->size--;
+}
+
+/* ************************************************** */
+/* ************************************************** */
+/* split a subtree into the segments beginning before time and the other ones */
+static void segment_split(interference_segment_t *segment, uint64_t time,
+                          interference_segment_t **left, interference_segment_t **right) {
+  if (segment == NULL) {
+    *left = *right = NULL;
+    return;
+  }
+
+  segment_push(segment);
+  if (segment->begin < time) {
+    segment_split(segment->right, time, &(segment->right), right);
+    *left = segment;
+  } else {
+    segment_split(segment->left, time, left, &(segment->left));
+    *right = segment;
+  }
+  segment_pull(segment);
+}
+
+/* merge two subtrees, all the segments of left being before the ones of right */
+static interference_segment_t *segment_merge(interference_segment_t *left, interference_segment_t *right) {
+  if (left == NULL) {
+    return right;
+  }
+  if (right == NULL) {
+    return left;
+  }
+
+  if (left->priority > right->priority) {
+    segment_push(left);
+    left->right = segment_merge(left->right, right);
+    segment_pull(left);
+    return left;
+  } else {
+    segment_push(right);
+    right->left = segment_merge(left, right->left);
+    segment_pull(right);
+    return right;
+  }
+}
+
+static interference_segment_t *segment_rotate_left(interference_segment_t *segment) {
+  interference_segment_t *right = segment->right;
+
+  segment_push(right);
+  segment->right = right->left;
+  segment_pull(segment);
+  right->left = segment;
+  segment_pull(right);
+  return right;
+}
+
+static interference_segment_t *segment_rotate_right(interference_segment_t *segment) {
+  interference_segment_t *left = segment->left;
+
+  segment_push(left);
+  segment->left = left->right;
+  segment_pull(segment);
+  left->right = segment;
+  segment_pull(left);
+  return left;
+}
+
+/* cut the segment containing time so that a segment begins at time */
+static interference_segment_t *segment_bound(interference_accumulator_t *accumulator,
+                                             interference_segment_t *segment, uint64_t time) {
+  if (segment == NULL) {
+    return NULL;
+  }
+
+  segment_push(segment);
+  if (time < segment->begin) {
+    segment->left = segment_bound(accumulator, segment->left, time);
+    if (segment->left && (segment->left->priority > segment->priority)) {
+      return segment_rotate_right(segment);
+    }
+  } else if (time >= segment->end) {
+    segment->right = segment_bound(accumulator, segment->right, time);
+    if (segment->right && (segment->right->priority > segment->priority)) {
+      return segment_rotate_left(segment);
+    }
+  } else if (time > segment->begin) {
+    /* the part after time becomes the first segment of the right subtree */
+    segment->right = segment_merge(segment_create(accumulator, time, segment->end, segment->power, segment->active),
+                                   segment->right);
+    segment->end = time;
+    if (segment->right->priority > segment->priority) {
+      return segment_rotate_left(segment);
+    }
+  }
+  segment_pull(segment);
+
+  return segment;
+}
+
+/* add power and active signals to the segments inside [t0, t1) */
+static void segment_update(interference_segment_t *segment, uint64_t t0, uint64_t t1, const double *power, int active) {
+  int i;
+
+  if ((segment == NULL) || (segment->last <= t0) || (segment->first >= t1)) {
+    return;
+  }
+
+  if ((t0 <= segment->first) && (segment->last <= t1)) {
+    segment_apply(segment, power, active);
+    return;
+  }
+
+  segment_push(segment);
+  if ((t0 <= segment->begin) && (segment->end <= t1)) {
+    if (power) {
+      for (i = 0; i < INTERFERENCE_CHANNELS; i++) {
+        segment->power[i] += power[i];
+      }
+    }
+    segment->active += active;
+  }
+  segment_update(segment->left, t0, t1, power, active);
+  segment_update(segment->right, t0, t1, power, active);
+  if (power) {
+    segment_pull(segment);
+  } else {
+    segment_pull_active(segment);
+  }
+}
+
+/* maximum and energy over [t0, t1) on a channel, add being the addition not yet pushed by the ancestors */
+static void segment_query(interference_segment_t *segment, int channel, uint64_t t0, uint64_t t1, double add,
+                          double *max, double *energy) {
+  uint64_t begin, end;
+  double power;
+
+  if ((segment == NULL) || (segment->last <= t0) || (segment->first >= t1)) {
+    return;
+  }
+
+  /* the whole subtree is in the range */
+  if ((t0 <= segment->first) && (segment->last <= t1)) {
+    if (segment->max[channel] + add > *max) {
+      *max = segment->max[channel] + add;
+    }
+    *energy += segment->energy[channel] + add * (double) segment->duration;
+    return;
+  }
+
+  begin = (segment->begin > t0) ? segment->begin : t0;
+  end = (segment->end < t1) ? segment->end : t1;
+  if (begin < end) {
+    power = segment->power[channel] + add;
+    if (power > *max) {
+      *max = power;
+    }
+    *energy += power * (double) (end - begin);
+  }
+
+  add += segment->lazy_power[channel];
+  segment_query(segment->left, channel, t0, t1, add, max, energy);
+  segment_query(segment->right, channel, t0, t1, add, max, energy);
+}
+
+/* last segment overlapping [t0, t1) without active signal, NULL if none */
+static interference_segment_t *segment_last_idle(interference_segment_t *segment, uint64_t t0, uint64_t t1) {
+  interference_segment_t *idle;
+
+  if ((segment == NULL) || (segment->last <= t0) || (segment->first >= t1) || (segment->min_active > 0)) {
+    return NULL;
+  }
+
+  segment_push(segment);
+  if ((idle = segment_last_idle(segment->right, t0, t1)) != NULL) {
+    return idle;
+  }
+  if ((segment->active <= 0) && (segment->begin < t1) && (segment->end > t0)) {
+    return segment;
+  }
+  return segment_last_idle(segment->left, t0, t1);
+}
+
+
+/* cut the segment containing time, if time is not already a bound */
+static void interference_accumulator_bound(interference_accumulator_t *accumulator, uint64_t time) {
+  interference_segment_t *segment = accumulator->root;
+
+  while (segment && ((time < segment->begin) || (time >= segment->end))) {
+    segment = (time < segment->begin) ? segment->left : segment->right;
+  }
+
+  if (segment && (segment->begin != time)) {
+    accumulator->root = segment_bound(accumulator, accumulator->root, time);
+  }
+}
+
+
+/* ************************************************** */
+/* ************************************************** */
+int interference_accumulator_init(void) {
+  if ((mem_segment = mem_fs_slice_declare(sizeof(interference_segment_t))) == NULL) {
+    return -1;
+  }
+
+  return 0;
+}
+
+void interference_accumulator_setup(interference_accumulator_t *accumulator) {
+  accumulator->root = NULL;
+  accumulator->begin = 0;
+  accumulator->end = 0;
+  accumulator->size = 0;
+  accumulator->seed = INTERFERENCE_ACCUMULATOR_SEED;
+}
+
+void interference_accumulator_clear(interference_accumulator_t *accumulator) {
+  segment_destroy(accumulator, accumulator->root);
+  accumulator->root = NULL;
+  accumulator->begin = 0;
+  accumulator->end = 0;
+}
+
+void interference_accumulator_add(interference_accumulator_t *accumulator, uint64_t begin, uint64_t end, const double *power) {
+  if (begin >= end) {
+    return;
+  }
+
+  /* segments are kept contiguous from the first to the last one */
+  if (accumulator->root == NULL) {
+    accumulator->root = segment_create(accumulator, begin, end, NULL, 0);
+    accumulator->begin = begin;
+    accumulator->end = end;
+  } else {
+    if (begin < accumulator->begin) {
+      accumulator->root = segment_merge(segment_create(accumulator, begin, accumulator->begin, NULL, 0), accumulator->root);
+      accumulator->begin = begin;
+    }
+    if (end > accumulator->end) {
+      accumulator->root = segment_merge(accumulator->root, segment_create(accumulator, accumulator->end, end, NULL, 0));
+      accumulator->end = end;
+    }
+  }
+
+  interference_accumulator_bound(accumulator, begin);
+  interference_accumulator_bound(accumulator, end);
+  segment_update(accumulator->root, begin, end, power, 1);
+}
+
+void interference_accumulator_release(interference_accumulator_t *accumulator, uint64_t begin, uint64_t end) {
+  interference_segment_t *idle, *left;
+
+  if (begin >= end) {
+    return;
+  }
+
+  interference_accumulator_bound(accumulator, begin);
+  interference_accumulator_bound(accumulator, end);
+  segment_update(accumulator->root, begin, end, NULL, -1);
+
+  /* no signal is active at the end of an idle segment before end, and the next
+   * signals will begin after end: the segments up to there are not needed any more */
+  if ((idle = segment_last_idle(accumulator->root, begin, end)) != NULL) {
+    uint64_t time = idle->end;
+
+    segment_split(accumulator->root, time, &left, &(accumulator->root));
+    segment_destroy(accumulator, left);
+    if (accumulator->root == NULL) {
+      accumulator->begin = accumulator->end = 0;
+    } else {
+      accumulator->begin = time;
+    }
+  }
+}
+
+double interference_accumulator_max(interference_accumulator_t *accumulator, int channel, uint64_t t0, uint64_t t1) {
+  double max = 0, energy = 0;
+
+  segment_query(accumulator->root, channel, t0, t1, 0, &max, &energy);
+  return max;
+}
+
+double interference_accumulator_average(interference_accumulator_t *accumulator, int channel, uint64_t t0, uint64_t t1) {
+  double max = 0, energy = 0;
+
+  if (t0 >= t1) {
+    return 0;
+  }
+
+  segment_query(accumulator->root, channel, t0, t1, 0, &max, &energy);
+  return energy / (double) (t1 - t0);
+}
+
+double interference_accumulator_value(interference_accumulator_t *accumulator, int channel, uint64_t time) {
+  interference_segment_t *segment = accumulator->root, *found = NULL;
+
+  while (segment) {
+    segment_push(segment);
+    if (segment->end > time) {
+      found = segment;
+      segment = segment->left;
+    } else {
+      segment = segment->right;
+    }
+  }
+
+  return found ? found->power[channel] : 0;
+}
+
+int interference_accumulator_size(interference_accumulator_t *accumulator) {
+  return accumulator->size;
+}
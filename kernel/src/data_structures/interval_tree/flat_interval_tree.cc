@@ -0,0 +1,231 @@
+/**
+ *  \file   flat_interval_tree.cc
+ *  \brief  FlatIntervalTree Concrete Class implementation
+ *  \author agent
+ *  \date   2026
+ *  \version 1.0
+ **/
+
+#include <algorithm>
+#include <limits>
+
+#include <kernel/include/data_structures/interval_tree/flat_interval_tree.h>
+
+/** \brief Constructor of the FlatIntervalTree Class
+ *  \fn FlatIntervalTree::FlatIntervalTree()
+ **/
+FlatIntervalTree::FlatIntervalTree() : IntervalTree(), nbr_deleted_(0), outdated_(false){
+}
+
+/** \brief Destructor of the FlatIntervalTree Class
+ *  \fn FlatIntervalTree::~FlatIntervalTree()
+ **/
+FlatIntervalTree::~FlatIntervalTree(){
+}
+
+/** \brief Rebuild the max_high fields of a range of the implicit tree
+ *  \fn IntervalBoundary FlatIntervalTree::UpdateMaxHigh(size_t begin, size_t end)
+ *  \param begin is the first element of the range
+ *  \param end is the element after the last one of the range
+ *  \return the highest point of the range
+ **/
+IntervalBoundary FlatIntervalTree::UpdateMaxHigh(size_t begin, size_t end){
+  if (begin >= end) {
+    return std::numeric_limits<IntervalBoundary>::lowest();
+  }
+
+  size_t middle = begin + (end - begin) / 2;
+  max_highs_[middle] = std::max(highs_[middle], std::max(UpdateMaxHigh(begin, middle), UpdateMaxHigh(middle + 1, end)));
+  return max_highs_[middle];
+}
+
+/** \brief Apply the buffered changes to the tree
+ * 	Removes the deleted elements, merges the inserted ones (placed after the elements
+ * 	with the same low point, in insertion order) and rebuilds the max_high fields
+ *  \fn void FlatIntervalTree::Update()
+ **/
+void FlatIntervalTree::Update(){
+  std::vector<IntervalBoundary> lows, highs;
+  std::vector<PayloadIndex> payloads;
+  size_t size = lows_.size() - nbr_deleted_ + inserted_.size();
+  size_t position = 0;
+
+  std::stable_sort(inserted_.begin(), inserted_.end(), [](const Element &lhs, const Element &rhs){
+    return lhs.low_ < rhs.low_;
+  });
+
+  lows.reserve(size);
+  highs.reserve(size);
+  payloads.reserve(size);
+  for (auto &element : inserted_) {
+    for (; (position < lows_.size()) && (lows_[position] <= element.low_); position++) {
+      if (payloads_[position] != FLAT_INTERVAL_TREE_DELETED) {
+        lows.push_back(lows_[position]);
+        highs.push_back(highs_[position]);
+        payloads.push_back(payloads_[position]);
+      }
+    }
+    lows.push_back(element.low_);
+    highs.push_back(element.high_);
+    payloads.push_back(element.payload_);
+  }
+  for (; position < lows_.size(); position++) {
+    if (payloads_[position] != FLAT_INTERVAL_TREE_DELETED) {
+      lows.push_back(lows_[position]);
+      highs.push_back(highs_[position]);
+      payloads.push_back(payloads_[position]);
+    }
+  }
+
+  lows_.swap(lows);
+  highs_.swap(highs);
+  payloads_.swap(payloads);
+  max_highs_.resize(size);
+  UpdateMaxHigh(0, size);
+
+  inserted_.clear();
+  nbr_deleted_ = 0;
+  outdated_ = false;
+}
+
+/** \brief Call a function on all elements that intersect with a given bound [low, high]
+ * 	The implicit tree is walked in order, the subtrees whose max_high is lower than low being
+ * 	pruned, and the walk stopping at the first element whose low point is higher than high.
+ *  \fn void FlatIntervalTree::ForEachIndexIntersection(IntervalBoundary low, IntervalBoundary high, Function &&function)
+ *  \param low is the low endpoint of the closed interval to be searched
+ *  \param high is the high endpoint of the closed interval to be searched
+ *  \param function is called on the index of each element that intersects [low,high]
+ **/
+template <typename Function>
+void FlatIntervalTree::ForEachIndexIntersection(IntervalBoundary low, IntervalBoundary high, Function &&function){
+  size_t stack[FLAT_INTERVAL_TREE_MAX_HEIGHT][2];
+  int top = 0;
+
+  if (outdated_) {
+    Update();
+  }
+
+  size_t begin = 0;
+  size_t end = lows_.size();
+
+  while (true) {
+    // go down to the leftmost subtree that may intersect [low,high]
+    while (begin < end) {
+      size_t middle = begin + (end - begin) / 2;
+      if (max_highs_[middle] < low) {
+        break;
+      }
+      stack[top][0] = begin;
+      stack[top++][1] = end;
+      end = middle;
+    }
+
+    if (top == 0) {
+      return;
+    }
+
+    begin = stack[--top][0];
+    end = stack[top][1];
+    size_t middle = begin + (end - begin) / 2;
+
+    // the next elements all begin after high
+    if (lows_[middle] > high) {
+      return;
+    }
+    if (highs_[middle] >= low) {
+      function(middle);
+    }
+    begin = middle + 1;
+  }
+}
+
+/** \brief Insert an interval
+ *  \fn void FlatIntervalTree::InsertImpl(std::weak_ptr<Interval> new_interval)
+ *  \param new_interval the interval to insert
+ **/
+void FlatIntervalTree::InsertImpl(std::weak_ptr<Interval> new_interval){
+  std::shared_ptr<Interval> interval = new_interval.lock();
+  PayloadIndex payload;
+
+  if (free_payloads_.empty()) {
+    payload = intervals_.size();
+    intervals_.push_back(new_interval);
+    uids_.push_back(interval->GetUID());
+  } else {
+    payload = free_payloads_.back();
+    free_payloads_.pop_back();
+    intervals_[payload] = new_interval;
+    uids_[payload] = interval->GetUID();
+  }
+
+  inserted_.push_back({interval->GetLowPoint(), interval->GetHighPoint(), payload});
+  outdated_ = true;
+
+  ++size_;
+}
+
+/** \brief Delete an Interval from the tree
+ * 	Deletes the entry for the interval if found (we look for its UID), but it does not delete (free) the Interval itself
+ *  \fn void FlatIntervalTree::DeleteImpl(std::weak_ptr<Interval> i)
+ *  \param i is the interval we are interested.
+ **/
+void FlatIntervalTree::DeleteImpl(std::weak_ptr<Interval> i){
+  std::shared_ptr<Interval> interval = i.lock();
+  IntervalUid uid = interval->GetUID();
+  auto deleted = [&](PayloadIndex payload){
+    if ((payload == FLAT_INTERVAL_TREE_DELETED) || (uids_[payload] != uid)) {
+      return false;
+    }
+    intervals_[payload].reset();
+    free_payloads_.push_back(payload);
+    outdated_ = true;
+    --size_;
+    return true;
+  };
+
+  // not merged yet
+  for (auto element = inserted_.begin(); element != inserted_.end(); element++) {
+    if (deleted(element->payload_)) {
+      inserted_.erase(element);
+      return;
+    }
+  }
+
+  // the element stays in the tree until the next update
+  auto range = std::equal_range(lows_.begin(), lows_.end(), interval->GetLowPoint());
+  for (size_t position = range.first - lows_.begin(); position < (size_t) (range.second - lows_.begin()); position++) {
+    if ((highs_[position] == interval->GetHighPoint()) && deleted(payloads_[position])) {
+      payloads_[position] = FLAT_INTERVAL_TREE_DELETED;
+      nbr_deleted_++;
+      return;
+    }
+  }
+}
+
+/** \brief Find all intervals that intersect with a given interval
+ *  \fn std::list<std::weak_ptr<Interval>> FlatIntervalTree::FindAllIntersectionsImpl(std::weak_ptr<Interval> i)
+ *  \param i is the interval to be searched
+ *  \return the list of intervals that intersects i
+ **/
+std::list<std::weak_ptr<Interval>> FlatIntervalTree::FindAllIntersectionsImpl(std::weak_ptr<Interval> i){
+  std::list<std::weak_ptr<Interval>> intersected_elements;
+  std::shared_ptr<Interval> interval = i.lock();
+
+  ForEachIndexIntersection(interval->GetLowPoint(), interval->GetHighPoint(), [&](size_t position){
+    intersected_elements.push_back(intervals_[payloads_[position]]);
+  });
+
+  return intersected_elements;
+}
+
+/** \brief Call a visitor on all intervals that intersect with a given bound [low, high]
+ *  \fn void FlatIntervalTree::VisitAllIntersectionsImpl(IntervalBoundary low, IntervalBoundary high, IntervalVisitor &visitor)
+ *  \param low is the low endpoint of the closed interval to be searched
+ *  \param high is the high endpoint of the closed interval to be searched
+ *  \param visitor is called on each interval that intersects [low,high]
+ **/
+void FlatIntervalTree::VisitAllIntersectionsImpl(IntervalBoundary low, IntervalBoundary high, IntervalVisitor &visitor){
+  ForEachIndexIntersection(low, high, [&](size_t position){
+    visitor.Visit(intervals_[payloads_[position]]);
+  });
+}
@@ -84,6 +84,41 @@ bool OverlapClosed(IntervalBoundary a_interval_low, IntervalBoundary a_interval_
   }
 }
 
+/** \brief Find all elements that intersect with a given bound [low, high]
+ * 	This algorithm walks the tree in pre-order with an explicit stack, pruning the subtrees
+ * 	that cannot intersect [low,high] thanks to the max_high_ fields
+ *  \fn void RedBlackIntervalTree::ForEachElementIntersection(IntervalBoundary low, IntervalBoundary high, Function &&function)
+ *  \param low is the low endpoint of the closed interval to be searched
+ *  \param high is the high endpoint of the closed interval to be searched
+ *  \param function is called on each element that intersects [low,high]
+ **/
+template <typename Function>
+void RedBlackIntervalTree::ForEachElementIntersection(IntervalBoundary low, IntervalBoundary high, Function &&function){
+  RedBlackIntervalTreeElement * stack[REDBLACK_INTERVAL_TREE_MAX_HEIGHT];
+  int top = 0;
+
+  if (root_->left_ == nil_){
+    return;
+  }
+  stack[top++] = root_->left_;
+
+  while (top > 0) {
+    RedBlackIntervalTreeElement * x = stack[--top];
+
+    if (OverlapClosed(low,high,x->key_,x->high_)) {
+      function(x);
+    }
+
+    // the right subtree is pushed first, so that the left one is walked first
+    if ((x->right_ != nil_) && (x->key_ <= high) && (x->right_->max_high_ >= low)) {
+      stack[top++] = x->right_;
+    }
+    if ((x->left_ != nil_) && (x->left_->max_high_ >= low)) {
+      stack[top++] = x->left_;
+    }
+  }
+}
+
 /** \brief Left Rotate the tree on an element
  * 	As described in [1], it basically makes the parent of x be to the left of x,
  * 	x the parent of its parent before the rotation and fixes other pointers accordingly
@@ -393,30 +428,25 @@ void RedBlackIntervalTree::DeleteFixUp(RedBlackIntervalTreeElement *x) {
 }
 
 /** \brief Find a specific interval (we look for its UID)
- * 	Performs a search of a specific interval
- * 	It is based on the algorithm described in [1]
+ * 	Performs a search of a specific interval among the elements overlapping it
  *  \fn RedBlackIntervalTreeElement * RedBlackIntervalTree::FindInterval(std::weak_ptr<Interval> i)
  *  \param i is the interval we are interested.
  *  \return the interval if found, the nil sentinel otherwise
  **/
 RedBlackIntervalTreeElement * RedBlackIntervalTree::FindInterval(std::weak_ptr<Interval> i) {
-  std::map<IntervalUid, RedBlackIntervalTreeElement*> possible_elements;
-
-  possible_elements = FindAllElementsIntersectionRecursive(root_->left_, i.lock()->GetLowPoint(), i.lock()->GetHighPoint());
-  auto found = possible_elements.find(i.lock()->GetUID());
-
-  if (found != possible_elements.end()){
-    return found->second;
-  }
-  return nil_;
-
-  /*Print();
-
-	RedBlackIntervalTreeElement * x = Search(root_->left_,i);
-
-	x->Print(nil_,root_);
-	return x;*/
+  std::shared_ptr<Interval> interval = i.lock();
+  IntervalUid uid = interval->GetUID();
+  RedBlackIntervalTreeElement * found = nil_;
+
+  ForEachElementIntersection(interval->GetLowPoint(), interval->GetHighPoint(), [&](RedBlackIntervalTreeElement * x){
+    // elements of the same interval have the same bounds, no need to lock the others
+    if ((found == nil_) && (x->key_ == interval->GetLowPoint()) && (x->high_ == interval->GetHighPoint())
+        && (x->interval_.lock()->GetUID() == uid)) {
+      found = x;
+    }
+  });
 
+  return found;
 }
 
 /** \brief Delete an Interval from the tree
@@ -430,6 +460,7 @@ void RedBlackIntervalTree::DeleteImpl(std::weak_ptr<Interval> i) {
 
   if (x!=nil_){
     DeleteElement(x);
+    --size_;
   }
 }
 
@@ -489,70 +520,32 @@ void RedBlackIntervalTree::DeleteElement(RedBlackIntervalTreeElement *z){
   return;
 }
 
-/** \brief Find all intervals that intersect with a given bound [low, high]
- * 	This algorithm calls another protected method that find the intervals recursively
- *  \fn std::list<std::weak_ptr<Interval>> RedBlackIntervalTree::FindAllIntersectionsImpl(IntervalBoundary low, IntervalBoundary high)
- *  \param low is the low endpoint of the closed interval to be searched
- *  \param high is the high endpoint of the closed interval to be searched
- *  \return the list of intervals that intersects [low,high]
+/** \brief Find all intervals that intersect with a given interval
+ *  \fn std::list<std::weak_ptr<Interval>> RedBlackIntervalTree::FindAllIntersectionsImpl(std::weak_ptr<Interval> i)
+ *  \param i is the interval to be searched
+ *  \return the list of intervals that intersects i
  **/
 std::list<std::weak_ptr<Interval>> RedBlackIntervalTree::FindAllIntersectionsImpl(std::weak_ptr<Interval> i){
-  return FindAllIntersectionsRecursive(root_->left_, i.lock()->GetLowPoint(), i.lock()->GetHighPoint());
-}
-
-/** \brief Find all elements that intersect with a given bound [low, high]
- * 	This algorithm runs recursively through the tree returning all overlapped elements
- *  \fn std::list<std::weak_ptr<Interval>> RedBlackIntervalTree::FindAllIntersectionsRecursive(RedBlackIntervalTreeElement *x, IntervalBoundary low, IntervalBoundary high)
- *  \param x is the element to start from
- *  \param low is the low endpoint of the closed interval to be searched
- *  \param high is the high endpoint of the closed interval to be searched
- *  \return a map with pairs [key=UID,RedBlackIntervalTreeElement*] of all elements that intersects [low,high]
- **/
-std::map<IntervalUid, RedBlackIntervalTreeElement*> RedBlackIntervalTree::FindAllElementsIntersectionRecursive(RedBlackIntervalTreeElement * x, IntervalBoundary low, IntervalBoundary high){
-  std::map<IntervalUid, RedBlackIntervalTreeElement*> intersected_elements;
-  if ((x != nil_)  && OverlapClosed(low,high,x->key_,x->high_) ){
-    intersected_elements.insert(std::make_pair(x->interval_.lock()->GetUID(),x));
-  }
+  std::list<std::weak_ptr<Interval>> intersected_elements;
+  std::shared_ptr<Interval> interval = i.lock();
 
-  if ((x->left_ != nil_) && (x->left_->max_high_ >= low) ){
-    std::map<IntervalUid,RedBlackIntervalTreeElement *> new_list = FindAllElementsIntersectionRecursive(x->left_, low, high);
-    intersected_elements.insert(new_list.begin(),new_list.end());
-  }
-
-  if ((x->right_ != nil_) && (x->interval_.lock()->GetLowPoint() <= high) && (x->right_->max_high_ >= low) ){
-    std::map<IntervalUid,RedBlackIntervalTreeElement *> new_list = FindAllElementsIntersectionRecursive(x->right_, low, high);
-    intersected_elements.insert(new_list.begin(),new_list.end());
-  }
+  ForEachElementIntersection(interval->GetLowPoint(), interval->GetHighPoint(), [&](RedBlackIntervalTreeElement * x){
+    intersected_elements.push_back(x->interval_);
+  });
 
   return intersected_elements;
 }
 
-
-/** \brief Find all intervals that intersect with a given bound [low, high]
- * 	This algorithm runs recursively through the tree returning all overlapped intersections
- *  \fn std::list<std::weak_ptr<Interval>> RedBlackIntervalTree::FindAllIntersectionsRecursive(RedBlackIntervalTreeElement *x, IntervalBoundary low, IntervalBoundary high)
- *  \param x is the element to start from
+/** \brief Call a visitor on all intervals that intersect with a given bound [low, high]
+ *  \fn void RedBlackIntervalTree::VisitAllIntersectionsImpl(IntervalBoundary low, IntervalBoundary high, IntervalVisitor &visitor)
  *  \param low is the low endpoint of the closed interval to be searched
  *  \param high is the high endpoint of the closed interval to be searched
- *  \return the list of intervals that intersects [low,high]
+ *  \param visitor is called on each interval that intersects [low,high]
  **/
-std::list<std::weak_ptr<Interval>> RedBlackIntervalTree::FindAllIntersectionsRecursive(RedBlackIntervalTreeElement * x, IntervalBoundary low, IntervalBoundary high){
-  std::list<std::weak_ptr<Interval>> intersected_elements;
-  if ((x != nil_)  && OverlapClosed(low,high,x->key_,x->high_) ){
-    intersected_elements.push_front(x->interval_);
-  }
-
-  if ((x->left_ != nil_) && (x->left_->max_high_ >= low) ){
-    std::list<std::weak_ptr<Interval>> new_list = FindAllIntersectionsRecursive(x->left_, low, high);
-    intersected_elements.insert(intersected_elements.end(), new_list.begin(),new_list.end());
-  }
-
-  if ((x->right_ != nil_) && (x->interval_.lock()->GetLowPoint() <= high) && (x->right_->max_high_ >= low) ){
-    std::list<std::weak_ptr<Interval>> new_list = FindAllIntersectionsRecursive(x->right_, low, high);
-    intersected_elements.insert(intersected_elements.end(), new_list.begin(),new_list.end());
-  }
-
-  return intersected_elements;
+void RedBlackIntervalTree::VisitAllIntersectionsImpl(IntervalBoundary low, IntervalBoundary high, IntervalVisitor &visitor){
+  ForEachElementIntersection(low, high, [&visitor](RedBlackIntervalTreeElement * x){
+    visitor.Visit(x->interval_);
+  });
 }
 
 /** \brief Check if the max_high_ fields are correct
@@ -0,0 +1,323 @@
+/**
+ *  \file   link_store.c
+ *  \brief  Sparse store of a value per (src, dst) link
+ *  \author agent
+ *  \date   2026
+ **/
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <limits.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include "link_store.h"
+
+
+/* ************************************************** */
+/* ************************************************** */
+#define LINK_STORE_MIN_CAPACITY 64
+
+struct _link_store_link {
+  uint32_t src;
+  uint32_t dst;
+  uint64_t order; /* the last link set wins */
+  double   value;
+};
+
+
+/* ************************************************** */
+/* ************************************************** */
+static int link_store_compare_links(const void *link0, const void *link1) {
+  const link_store_link_t *l0 = (const link_store_link_t *) link0;
+  const link_store_link_t *l1 = (const link_store_link_t *) link1;
+
+  if (l0->src != l1->src) {
+    return (l0->src < l1->src) ? -1 : 1;
+  }
+  if (l0->dst != l1->dst) {
+    return (l0->dst < l1->dst) ? -1 : 1;
+  }
+  return (l0->order < l1->order) ? -1 : (l0->order > l1->order);
+}
+
+static inline size_t link_store_dsts_size(uint64_t link_cnt) {
+  /* the values that follow are 8 bytes aligned */
+  return ((sizeof(uint32_t) * link_cnt + 7) / 8) * 8;
+}
+
+static inline size_t link_store_block_size(int node_cnt, uint64_t link_cnt) {
+  return sizeof(link_store_header_t) + sizeof(uint64_t) * (node_cnt + 1)
+    + link_store_dsts_size(link_cnt) + sizeof(double) * link_cnt;
+}
+
+/* point the rows into the block */
+static void link_store_attach(link_store_t *store) {
+  link_store_header_t *header = (link_store_header_t *) store->block;
+
+  store->node_cnt      = (int) header->node_cnt;
+  store->link_cnt      = header->link_cnt;
+  store->value_default = header->value_default;
+  store->offsets       = (const uint64_t *) (header + 1);
+  store->dsts          = (const uint32_t *) (store->offsets + store->node_cnt + 1);
+  store->values        = (const double *) ((const char *) store->dsts + link_store_dsts_size(store->link_cnt));
+}
+
+
+/* the rows of a mapped file must stay in the block and be sorted, as finalized */
+static int link_store_check(const link_store_t *store) {
+  uint64_t i;
+  int      src;
+
+  if ((store->offsets[0] != 0) || (store->offsets[store->node_cnt] != store->link_cnt)) {
+    return -1;
+  }
+
+  for (src = 0; src < store->node_cnt; src++) {
+    if (store->offsets[src] > store->offsets[src + 1]) {
+      return -1;
+    }
+    for (i = store->offsets[src]; i < store->offsets[src + 1]; i++) {
+      if ((store->dsts[i] >= (uint32_t) store->node_cnt)
+          || ((i > store->offsets[src]) && (store->dsts[i - 1] >= store->dsts[i]))) {
+        return -1;
+      }
+    }
+  }
+
+  return 0;
+}
+
+
+/* ************************************************** */
+/* ************************************************** */
+link_store_t *link_store_create(int node_cnt, double value_default) {
+  link_store_t *store;
+
+  if (node_cnt < 0) {
+    return NULL;
+  }
+
+  if ((store = (link_store_t *) calloc(1, sizeof(link_store_t))) == NULL) {
+    return NULL;
+  }
+
+  store->node_cnt      = node_cnt;
+  store->value_default = value_default;
+  return store;
+}
+
+void link_store_destroy(link_store_t *store) {
+  if (store == NULL) {
+    return;
+  }
+
+  if (store->mapped) {
+    munmap(store->block, store->block_size);
+  } else {
+    free(store->block);
+  }
+  free(store->links);
+  free(store);
+}
+
+
+/* ************************************************** */
+/* ************************************************** */
+int link_store_set(link_store_t *store, int src, int dst, double value) {
+  link_store_link_t *link;
+
+  if ((store->offsets != NULL) || (src < 0) || (src >= store->node_cnt) || (dst < 0) || (dst >= store->node_cnt)) {
+    return -1;
+  }
+
+  if (store->link_cnt == store->capacity) {
+    uint64_t           capacity = store->capacity ? 2 * store->capacity : LINK_STORE_MIN_CAPACITY;
+    link_store_link_t *links    = (link_store_link_t *) realloc(store->links, sizeof(link_store_link_t) * capacity);
+    if (links == NULL) {
+      return -1;
+    }
+    store->links    = links;
+    store->capacity = capacity;
+  }
+
+  link = store->links + store->link_cnt;
+  link->src   = (uint32_t) src;
+  link->dst   = (uint32_t) dst;
+  link->order = store->link_cnt++;
+  link->value = value;
+  return 0;
+}
+
+int link_store_finalize(link_store_t *store) {
+  link_store_header_t *header;
+  uint64_t            *offsets;
+  uint32_t            *dsts;
+  double              *values;
+  uint64_t             link_cnt = 0;
+  uint64_t             i;
+  int                  src;
+
+  if (store->offsets != NULL) {
+    return -1;
+  }
+
+  /* sorted by src then dst, the duplicates keep their last value */
+  qsort(store->links, store->link_cnt, sizeof(link_store_link_t), link_store_compare_links);
+  for (i = 0; i < store->link_cnt; i++) {
+    if ((link_cnt > 0) && (store->links[link_cnt - 1].src == store->links[i].src)
+        && (store->links[link_cnt - 1].dst == store->links[i].dst)) {
+      link_cnt--;
+    }
+    store->links[link_cnt++] = store->links[i];
+  }
+
+  store->block_size = link_store_block_size(store->node_cnt, link_cnt);
+  if ((store->block = calloc(1, store->block_size)) == NULL) {
+    return -1;
+  }
+
+  header = (link_store_header_t *) store->block;
+  memcpy(header->magic, LINK_STORE_MAGIC, sizeof(header->magic));
+  header->version       = LINK_STORE_VERSION;
+  header->node_cnt      = (uint32_t) store->node_cnt;
+  header->link_cnt      = link_cnt;
+  header->value_default = store->value_default;
+  link_store_attach(store);
+
+  offsets = (uint64_t *) store->offsets;
+  dsts    = (uint32_t *) store->dsts;
+  values  = (double *) store->values;
+  for (i = 0, src = 0; src <= store->node_cnt; src++) {
+    while ((i < link_cnt) && (store->links[i].src < (uint32_t) src)) {
+      i++;
+    }
+    offsets[src] = i;
+  }
+  for (i = 0; i < link_cnt; i++) {
+    dsts[i]   = store->links[i].dst;
+    values[i] = store->links[i].value;
+  }
+
+  free(store->links);
+  store->links    = NULL;
+  store->capacity = 0;
+  return 0;
+}
+
+
+/* ************************************************** */
+/* ************************************************** */
+double link_store_get(link_store_t *store, int src, int dst) {
+  uint64_t begin;
+  uint64_t end;
+
+  if ((src < 0) || (src >= store->node_cnt) || (dst < 0)) {
+    return store->value_default;
+  }
+
+  /* binary search of dst in the src row */
+  begin = store->offsets[src];
+  end   = store->offsets[src + 1];
+  while (begin < end) {
+    uint64_t middle = begin + (end - begin) / 2;
+    if (store->dsts[middle] < (uint32_t) dst) {
+      begin = middle + 1;
+    } else {
+      end = middle;
+    }
+  }
+
+  if ((begin < store->offsets[src + 1]) && (store->dsts[begin] == (uint32_t) dst)) {
+    return store->values[begin];
+  }
+  return store->value_default;
+}
+
+uint64_t link_store_size(link_store_t *store) {
+  return store->link_cnt;
+}
+
+
+/* ************************************************** */
+/* ************************************************** */
+int link_store_save(link_store_t *store, const char *path) {
+  FILE *file;
+  int   error;
+
+  if (store->offsets == NULL) {
+    return -1;
+  }
+
+  if ((file = fopen(path, "wb")) == NULL) {
+    return -1;
+  }
+
+  error = (fwrite(store->block, 1, store->block_size, file) != store->block_size);
+  error |= (fclose(file) != 0);
+  return error ? -1 : 0;
+}
+
+int link_store_is_file(const char *path) {
+  char  magic[sizeof(((link_store_header_t *) 0)->magic)];
+  FILE *file;
+  int   found;
+
+  if ((file = fopen(path, "rb")) == NULL) {
+    return 0;
+  }
+
+  found = (fread(magic, 1, sizeof(magic), file) == sizeof(magic)) && !memcmp(magic, LINK_STORE_MAGIC, sizeof(magic));
+  fclose(file);
+  return found;
+}
+
+link_store_t *link_store_load(const char *path) {
+  link_store_header_t *header;
+  link_store_t        *store;
+  struct stat          status;
+  void                *block;
+  int                  fd;
+
+  if ((fd = open(path, O_RDONLY)) < 0) {
+    return NULL;
+  }
+
+  if ((fstat(fd, &status) < 0) || (status.st_size < (off_t) sizeof(link_store_header_t))) {
+    close(fd);
+    return NULL;
+  }
+
+  block = mmap(NULL, (size_t) status.st_size, PROT_READ, MAP_SHARED, fd, 0);
+  close(fd);
+  if (block == MAP_FAILED) {
+    return NULL;
+  }
+
+  /* the file must be a store of the current version, with the size announced by its header,
+   * the counts being bounded by the file size first so that this size can not overflow */
+  header = (link_store_header_t *) block;
+  if (memcmp(header->magic, LINK_STORE_MAGIC, sizeof(header->magic))
+      || (header->version != LINK_STORE_VERSION)
+      || (header->node_cnt > INT_MAX)
+      || ((uint64_t) header->node_cnt + 1 > (uint64_t) status.st_size / sizeof(uint64_t))
+      || (header->link_cnt > (uint64_t) status.st_size / (sizeof(uint32_t) + sizeof(double)))
+      || ((size_t) status.st_size != link_store_block_size((int) header->node_cnt, header->link_cnt))
+      || ((store = (link_store_t *) calloc(1, sizeof(link_store_t))) == NULL)) {
+    munmap(block, (size_t) status.st_size);
+    return NULL;
+  }
+
+  store->block      = block;
+  store->block_size = (size_t) status.st_size;
+  store->mapped     = 1;
+  link_store_attach(store);
+
+  if (link_store_check(store)) {
+    link_store_destroy(store);
+    return NULL;
+  }
+  return store;
+}
@@ -8,6 +8,8 @@
 #include <stdio.h>
 #include <string.h>
 
+#include "mem_fs.h"
+
 
 /* ************************************************** */
 /* ************************************************** */
@@ -39,6 +41,8 @@ typedef struct _page {
 /* ************************************************** */
 slice_t *slices = NULL;
 page_t *pages = NULL;
+static mem_fs_stats_t stats = {0, 0, 0, 0, 0};
+static unsigned int generation = 0;
 
 
 /* ************************************************** */
@@ -59,9 +63,19 @@ void mem_fs_clean(void) {
         free(page);
     }
     
+    memset(&stats, 0, sizeof(stats));
+    generation++;
     return;
 }
 
+unsigned int mem_fs_get_generation(void) {
+    return generation;
+}
+
+void mem_fs_get_stats(mem_fs_stats_t *out) {
+    *out = stats;
+}
+
 
 /* ************************************************** */
 /* ************************************************** */
@@ -128,6 +142,10 @@ void *mem_fs_slice_declare(int size) {
     slice->next = slices;
     slices = slice;
 
+    stats.slices++;
+    stats.pages++;
+    stats.bytes += slice->size * slice->length;
+
     return (void *) slice;
 }
 
@@ -170,6 +188,9 @@ int mem_fs_slice_realloc(slice_t *slice) {
     page->next = pages;
     pages = page;
 
+    stats.pages++;
+    stats.bytes += slice->size * slice->free;
+
     return 0;
 }
 
@@ -191,6 +212,7 @@ void *mem_fs_alloc(void *arg0) {
     container = slice->f_free;
     slice->f_free = container->next;
     slice->free--;
+    stats.allocs++;
 
     /* return the allocated container */
     return (void *) container;
@@ -204,4 +226,5 @@ void mem_fs_dealloc(void *arg0, void *arg1) {
     container->next = slice->f_free;
     slice->f_free = container;
     slice->free++;
+    stats.deallocs++;
 }
@@ -0,0 +1,158 @@
+/**
+ *  \file   kd_range_tree.cc
+ *  \brief  KdRangeTree Class implementation
+ *  \author agent
+ *  \date   2026
+ **/
+
+#include <algorithm>
+#include <kernel/include/data_structures/range_tree/kd_range_tree.h>
+
+KdRangeTree::KdRangeTree() : outdated_(false), nbr_inactive_(0){
+}
+
+void KdRangeTree::InsertImpl(nodeid_t id, const position_t &position){
+	auto index = indexes_.find(id);
+
+	if (index == indexes_.end()){
+		indexes_.insert(std::make_pair(id, points_.size()));
+		points_.push_back({id, {position.x, position.y, position.z}, true});
+		outdated_ = true;
+		size_++;
+		return;
+	}
+
+	Point &point = points_[index->second];
+	if (!point.active_){
+		point.active_ = true;
+		nbr_inactive_--;
+		size_++;
+	}
+	UpdateImpl(id, position);
+}
+
+void KdRangeTree::DeleteImpl(nodeid_t id){
+	auto index = indexes_.find(id);
+
+	if ((index == indexes_.end()) || !points_[index->second].active_){
+		return;
+	}
+
+	points_[index->second].active_ = false;
+	nbr_inactive_++;
+	size_--;
+}
+
+void KdRangeTree::UpdateImpl(nodeid_t id, const position_t &position){
+	auto index = indexes_.find(id);
+
+	if (index == indexes_.end()){
+		return;
+	}
+
+	Point &point = points_[index->second];
+	if ((point.coordinates_[0] != position.x) || (point.coordinates_[1] != position.y)
+	    || (point.coordinates_[2] != position.z)){
+		point.coordinates_[0] = position.x;
+		point.coordinates_[1] = position.y;
+		point.coordinates_[2] = position.z;
+		outdated_ = true;
+	}
+}
+
+void KdRangeTree::Build(size_t begin, size_t end){
+	if (end - begin < 2){
+		if (begin < end){
+			axes_[begin] = 0;
+		}
+		return;
+	}
+
+	// split along the axis of largest spread
+	double low[3] = {points_[begin].coordinates_[0], points_[begin].coordinates_[1], points_[begin].coordinates_[2]};
+	double high[3] = {low[0], low[1], low[2]};
+	for (size_t i = begin + 1; i < end; i++){
+		for (int axis = 0; axis < 3; axis++){
+			low[axis] = std::min(low[axis], points_[i].coordinates_[axis]);
+			high[axis] = std::max(high[axis], points_[i].coordinates_[axis]);
+		}
+	}
+	uint8_t axis = 0;
+	for (uint8_t i = 1; i < 3; i++){
+		if (high[i] - low[i] > high[axis] - low[axis]){
+			axis = i;
+		}
+	}
+
+	size_t middle = begin + (end - begin) / 2;
+	std::nth_element(points_.begin() + begin, points_.begin() + middle, points_.begin() + end,
+	                 [axis](const Point &lhs, const Point &rhs){ return lhs.coordinates_[axis] < rhs.coordinates_[axis]; });
+	axes_[middle] = axis;
+
+	Build(begin, middle);
+	Build(middle + 1, end);
+}
+
+void KdRangeTree::Build(){
+	// drop the deleted nodes once they are the majority
+	if (2 * nbr_inactive_ > points_.size()){
+		points_.erase(std::remove_if(points_.begin(), points_.end(), [](const Point &point){ return !point.active_; }),
+		              points_.end());
+		nbr_inactive_ = 0;
+	}
+
+	axes_.resize(points_.size());
+	Build(0, points_.size());
+
+	indexes_.clear();
+	for (size_t i = 0; i < points_.size(); i++){
+		indexes_.insert(std::make_pair(points_[i].id_, i));
+	}
+
+	outdated_ = false;
+}
+
+void KdRangeTree::FindInRangeImpl(const position_t &center, double range, std::vector<nodeid_t> &ids){
+	double coordinates[3] = {center.x, center.y, center.z};
+	double range2 = range * range;
+
+	ids.clear();
+
+	if (outdated_){
+		Build();
+	}
+
+	stack_.clear();
+	stack_.push_back(std::make_pair((size_t) 0, points_.size()));
+
+	while (!stack_.empty()){
+		size_t begin = stack_.back().first;
+		size_t end = stack_.back().second;
+		stack_.pop_back();
+
+		if (begin >= end){
+			continue;
+		}
+
+		size_t middle = begin + (end - begin) / 2;
+		const Point &point = points_[middle];
+		double dx = point.coordinates_[0] - coordinates[0];
+		double dy = point.coordinates_[1] - coordinates[1];
+		double dz = point.coordinates_[2] - coordinates[2];
+
+		if (point.active_ && (dx * dx + dy * dy + dz * dz <= range2)){
+			ids.push_back(point.id_);
+		}
+
+		// visit the sides of the split plane that the sphere crosses
+		double offset = coordinates[axes_[middle]] - point.coordinates_[axes_[middle]];
+		if (offset - range <= 0){
+			stack_.push_back(std::make_pair(begin, middle));
+		}
+		if (offset + range >= 0){
+			stack_.push_back(std::make_pair(middle + 1, end));
+		}
+	}
+
+	std::sort(ids.begin(), ids.end());
+}
@@ -0,0 +1,197 @@
+/**
+ *  \file   spatial_grid.c
+ *  \brief  Uniform spatial grid used to index objects by position
+ *  \author agent
+ *  \date   2026
+ **/
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#include "spatial_grid.h"
+
+
+/* ************************************************** */
+/* ************************************************** */
+#define SPATIAL_GRID_MIN_BUCKETS 64
+
+
+/* ************************************************** */
+/* ************************************************** */
+static inline int64_t spatial_grid_coordinate(spatial_grid_t *grid, double value) {
+  return (int64_t) floor(value / grid->cell_size);
+}
+
+static inline int spatial_grid_hash(spatial_grid_t *grid, int64_t x, int64_t y, int64_t z) {
+  uint64_t hash = ((uint64_t) x * 73856093ULL) ^ ((uint64_t) y * 19349663ULL) ^ ((uint64_t) z * 83492791ULL);
+  return (int) (hash & (uint64_t) (grid->nbr_buckets - 1));
+}
+
+static int spatial_grid_compare_ids(const void *id0, const void *id1) {
+  return *((const int *) id0) - *((const int *) id1);
+}
+
+
+/* ************************************************** */
+/* ************************************************** */
+spatial_grid_t *spatial_grid_create(double cell_size, int capacity) {
+  spatial_grid_t *grid;
+
+  if ((cell_size <= 0) || (capacity < 0)) {
+    return NULL;
+  }
+
+  if ((grid = (spatial_grid_t *) malloc(sizeof(spatial_grid_t))) == NULL) {
+    return NULL;
+  }
+
+  /* a power of two number of buckets, at least one bucket per id */
+  grid->nbr_buckets = SPATIAL_GRID_MIN_BUCKETS;
+  while (grid->nbr_buckets < capacity) {
+    grid->nbr_buckets <<= 1;
+  }
+
+  grid->cell_size   = cell_size;
+  grid->capacity    = capacity;
+  grid->nbr_results = 0;
+  grid->buckets     = (spatial_grid_bucket_t *) calloc(grid->nbr_buckets, sizeof(spatial_grid_bucket_t));
+  grid->entries     = (spatial_grid_entry_t *) calloc(capacity ? capacity : 1, sizeof(spatial_grid_entry_t));
+  grid->results     = (int *) malloc(sizeof(int) * (capacity ? capacity : 1));
+
+  if ((grid->buckets == NULL) || (grid->entries == NULL) || (grid->results == NULL)) {
+    spatial_grid_destroy(grid);
+    return NULL;
+  }
+
+  return grid;
+}
+
+void spatial_grid_destroy(spatial_grid_t *grid) {
+  int i;
+
+  if (grid == NULL) {
+    return;
+  }
+
+  if (grid->buckets) {
+    for (i = 0; i < grid->nbr_buckets; i++) {
+      free(grid->buckets[i].ids);
+    }
+    free(grid->buckets);
+  }
+
+  free(grid->entries);
+  free(grid->results);
+  free(grid);
+}
+
+
+/* ************************************************** */
+/* ************************************************** */
+static void spatial_grid_bucket_remove(spatial_grid_t *grid, int id) {
+  spatial_grid_entry_t  *entry  = grid->entries + id;
+  spatial_grid_bucket_t *bucket = grid->buckets + spatial_grid_hash(grid, entry->cell.x, entry->cell.y, entry->cell.z);
+  int                    last   = bucket->ids[--bucket->size];
+
+  /* move the last id of the bucket into the freed slot */
+  bucket->ids[entry->slot] = last;
+  grid->entries[last].slot = entry->slot;
+  entry->indexed = 0;
+}
+
+static void spatial_grid_bucket_insert(spatial_grid_t *grid, int id) {
+  spatial_grid_entry_t  *entry  = grid->entries + id;
+  spatial_grid_bucket_t *bucket = grid->buckets + spatial_grid_hash(grid, entry->cell.x, entry->cell.y, entry->cell.z);
+
+  if (bucket->size == bucket->capacity) {
+    bucket->capacity = bucket->capacity ? 2 * bucket->capacity : 4;
+    bucket->ids = (int *) realloc(bucket->ids, sizeof(int) * bucket->capacity);
+  }
+
+  entry->slot = bucket->size;
+  entry->indexed = 1;
+  bucket->ids[bucket->size++] = id;
+}
+
+void spatial_grid_update(spatial_grid_t *grid, int id, double x, double y, double z) {
+  spatial_grid_entry_t *entry;
+  spatial_grid_cell_t   cell;
+
+  if ((id < 0) || (id >= grid->capacity)) {
+    return;
+  }
+
+  entry  = grid->entries + id;
+  cell.x = spatial_grid_coordinate(grid, x);
+  cell.y = spatial_grid_coordinate(grid, y);
+  cell.z = spatial_grid_coordinate(grid, z);
+
+  if (entry->indexed) {
+    /* the id did not leave its cell: nothing to do */
+    if ((entry->cell.x == cell.x) && (entry->cell.y == cell.y) && (entry->cell.z == cell.z)) {
+      return;
+    }
+    spatial_grid_bucket_remove(grid, id);
+  }
+
+  entry->cell = cell;
+  spatial_grid_bucket_insert(grid, id);
+}
+
+void spatial_grid_remove(spatial_grid_t *grid, int id) {
+  if ((id < 0) || (id >= grid->capacity) || !grid->entries[id].indexed) {
+    return;
+  }
+
+  spatial_grid_bucket_remove(grid, id);
+}
+
+
+/* ************************************************** */
+/* ************************************************** */
+int *spatial_grid_query(spatial_grid_t *grid, double x, double y, double z, double range, int *size) {
+  int64_t x0 = spatial_grid_coordinate(grid, x - range), x1 = spatial_grid_coordinate(grid, x + range);
+  int64_t y0 = spatial_grid_coordinate(grid, y - range), y1 = spatial_grid_coordinate(grid, y + range);
+  int64_t z0 = spatial_grid_coordinate(grid, z - range), z1 = spatial_grid_coordinate(grid, z + range);
+  double  nbr_cells = ((double) (x1 - x0 + 1)) * ((double) (y1 - y0 + 1)) * ((double) (z1 - z0 + 1));
+  int64_t cx, cy, cz;
+  int     i;
+
+  grid->nbr_results = 0;
+
+  /* the query covers more cells than there are ids: a linear scan is cheaper */
+  if (nbr_cells > grid->capacity) {
+    for (i = 0; i < grid->capacity; i++) {
+      spatial_grid_entry_t *entry = grid->entries + i;
+      if (entry->indexed
+          && (entry->cell.x >= x0) && (entry->cell.x <= x1)
+          && (entry->cell.y >= y0) && (entry->cell.y <= y1)
+          && (entry->cell.z >= z0) && (entry->cell.z <= z1)) {
+        grid->results[grid->nbr_results++] = i;
+      }
+    }
+    *size = grid->nbr_results;
+    return grid->results;
+  }
+
+  for (cx = x0; cx <= x1; cx++) {
+    for (cy = y0; cy <= y1; cy++) {
+      for (cz = z0; cz <= z1; cz++) {
+        spatial_grid_bucket_t *bucket = grid->buckets + spatial_grid_hash(grid, cx, cy, cz);
+
+        /* buckets are shared by colliding cells: keep only the ids of this cell */
+        for (i = 0; i < bucket->size; i++) {
+          spatial_grid_entry_t *entry = grid->entries + bucket->ids[i];
+          if ((entry->cell.x == cx) && (entry->cell.y == cy) && (entry->cell.z == cz)) {
+            grid->results[grid->nbr_results++] = bucket->ids[i];
+          }
+        }
+      }
+    }
+  }
+
+  qsort(grid->results, grid->nbr_results, sizeof(int), spatial_grid_compare_ids);
+
+  *size = grid->nbr_results;
+  return grid->results;
+}
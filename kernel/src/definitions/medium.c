@@ -11,6 +11,7 @@
 #include <stdio.h>
 #include <kernel/include/model_handlers/interface.h>
 #include <kernel/include/model_handlers/link.h>
+#include <kernel/include/tools/profiler/profiler.h>
 
 
 medium_array_t mediums = {0, NULL};
@@ -170,7 +171,11 @@ double medium_get_pathloss(call_t *to_interface, call_t *from_interface, packet_
   if (medium->pathloss == -1)
     return rxdBm;
   call_t to_pathloss = {medium->pathloss, medium->id};
-  return get_class_by_id(medium->pathloss)->methods->pathloss.pathloss(&to_pathloss, to_interface, from_interface, packet, rxdBm);
+  double pathloss;
+  profiler_enter(medium->pathloss);
+  pathloss = get_class_by_id(medium->pathloss)->methods->pathloss.pathloss(&to_pathloss, to_interface, from_interface, packet, rxdBm);
+  profiler_leave();
+  return pathloss;
 }
 
 double medium_get_fading(call_t *to_interface, call_t *from_interface, packet_t *packet, double rxdBm) {
@@ -178,7 +183,11 @@ double medium_get_fading(call_t *to_interface, call_t *from_interface, packet_t
   if (medium->fading == -1)
     return 0.0;
   call_t to_fading = {medium->fading, medium->id};
-  return get_class_by_id(medium->fading)->methods->fading.fading(&to_fading, to_interface, from_interface, packet, rxdBm);
+  double fading;
+  profiler_enter(medium->fading);
+  fading = get_class_by_id(medium->fading)->methods->fading.fading(&to_fading, to_interface, from_interface, packet, rxdBm);
+  profiler_leave();
+  return fading;
 }
 
 double medium_get_shadowing(call_t *to_interface, call_t *from_interface, packet_t *packet, double rxdBm) {
@@ -186,7 +195,11 @@ double medium_get_shadowing(call_t *to_interface, call_t *from_interface, packet
   if (medium->shadowing == -1)
     return 0.0;
   call_t to_shadowing = {medium->shadowing, medium->id};
-  return get_class_by_id(medium->shadowing)->methods->shadowing.shadowing(&to_shadowing, to_interface, from_interface, packet, rxdBm);
+  double shadowing;
+  profiler_enter(medium->shadowing);
+  shadowing = get_class_by_id(medium->shadowing)->methods->shadowing.shadowing(&to_shadowing, to_interface, from_interface, packet, rxdBm);
+  profiler_leave();
+  return shadowing;
 }
 
 void * medium_get_spectrum_object(call_t *interface) {
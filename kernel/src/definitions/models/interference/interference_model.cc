@@ -19,7 +19,7 @@ InterferenceModel::InterferenceModel() : uid_(uid_counter_) {
 
 InterferenceModel::~InterferenceModel() {}
 
-void InterferenceModel::ApplyInterference(std::shared_ptr<Signal> tracked_signal, MapOfSignals interferers) {
+void InterferenceModel::ApplyInterference(std::shared_ptr<Signal> tracked_signal, const MapOfSignals &interferers) {
   ApplyInterferenceImpl(tracked_signal,interferers);
   return;
 }
@@ -10,13 +10,73 @@
 
 #include <kernel/include/definitions/nodearch.h>
 #include <kernel/include/definitions/class.h>
+#include <kernel/include/definitions/medium.h>
+#include <kernel/include/data_structures/spatial_grid/spatial_grid.h>
 #include <kernel/include/scheduler/scheduler.h>
 #include <kernel/include/model_handlers/monitor.h>
+#include <kernel/include/tools/profiler/profiler.h>
 
 #include "node.h"
 
 
 node_array_t nodes = {0, NULL};
+node_table_t nodes_table = {0, NULL, NULL, NULL, NULL};
+
+/* spatial index of the nodes positions, NULL when no medium has a propagation range */
+static spatial_grid_t *nodes_grid = NULL;
+
+/* incremented at each change of a node position */
+static uint64_t nodes_positions_stamp = 0;
+
+/* lazy mobility: the positions evaluated before this date are outdated,
+ * and are evaluated again when read */
+static int      nodes_mobility_lazy      = 0;
+static uint64_t nodes_mobility_due       = 0;
+static uint64_t nodes_mobility_refreshed = 0;
+
+/* lazy mobility: a node is at most nodes_max_speed * (now - nodes_grid_refreshed)
+ * away from its position in the grid, nodes_grid_refreshed being the date
+ * of the last evaluation of all the positions. Unbounded when a mobile
+ * node does not give its maximum speed. */
+static double   nodes_max_speed          = 0;
+static int      nodes_speed_unbounded    = 0;
+static uint64_t nodes_grid_refreshed     = 0;
+
+
+/* ************************************************** */
+/* ************************************************** */
+/* refresh the node_t copy and the spatial index of a node position */
+static void node_position_update(nodeid_t id) {
+  position_t *position = nodes_table.positions + id;
+
+  get_node_by_id(id)->position = *position;
+  if (nodes_grid) {
+    spatial_grid_update(nodes_grid, id, position->x, position->y, position->z);
+  }
+}
+
+int *get_nodes_in_range(position_t *position, double range, int *size) {
+  if ((nodes_grid == NULL) || (range <= 0)) {
+    *size = 0;
+    return NULL;
+  }
+
+  /* the nodes may have moved since the grid was refreshed: enlarge the query,
+   * the candidates positions being evaluated by the caller. The grid is
+   * refreshed once the margin exceeds the range, to bound the candidates */
+  if (nodes_mobility_lazy && !nodes_speed_unbounded) {
+    double margin = nodes_max_speed * (get_time() - nodes_grid_refreshed) / 1000000000.0;
+
+    if (margin <= range) {
+      return spatial_grid_query(nodes_grid, position->x, position->y, position->z, range + margin, size);
+    }
+  }
+
+  /* the grid must hold the current positions */
+  nodes_refresh_mobility();
+  nodes_grid_refreshed = nodes_mobility_refreshed;
+  return spatial_grid_query(nodes_grid, position->x, position->y, position->z, range, size);
+}
 
 
 /* ************************************************** */
@@ -132,27 +192,109 @@ void nodes_clean(void) {
 
     free(nodes.elts);
   }
+
+  free(nodes_table.positions);
+  free(nodes_table.states);
+  free(nodes_table.nodearchs);
+  free(nodes_table.clocks);
+  nodes_table.size = 0;
+
+  spatial_grid_destroy(nodes_grid);
+  nodes_grid = NULL;
 }
 
 
 /* ************************************************** */
 /* ************************************************** */
+static int node_is_static(nodeid_t id) {
+  class_t *class = get_class_by_id(get_nodearch_by_id(nodes_table.nodearchs[id])->mobility);
+  call_t   to    = {class->id, id};
+
+  return class->methods->mobility.is_static && class->methods->mobility.is_static(&to);
+}
+
+/* the bound of the speeds of the mobile nodes born */
+static void node_bound_speed(nodeid_t id) {
+  class_t *class = get_class_by_id(get_nodearch_by_id(nodes_table.nodearchs[id])->mobility);
+  call_t   to    = {class->id, id};
+  double   speed;
+
+  if (class->methods->mobility.get_max_speed == NULL) {
+    nodes_speed_unbounded = 1;
+    return;
+  }
+
+  speed = class->methods->mobility.get_max_speed(&to);
+  if (speed > nodes_max_speed) {
+    nodes_max_speed = speed;
+  }
+}
+
+/* evaluate a node position at the current date */
+static void node_update_mobility(nodeid_t id) {
+  position_t *position = nodes_table.positions + id;
+  position_t  previous = *position;
+  class_t    *class    = get_class_by_id(get_nodearch_by_id(nodes_table.nodearchs[id])->mobility);
+  call_t      to       = {class->id, id};
+
+  /* set first, the model reads the position it updates */
+  nodes_table.clocks[id] = get_time();
+  profiler_enter(class->id);
+  if (nodes_mobility_lazy && class->methods->mobility.position_at) {
+    class->methods->mobility.position_at(&to, get_time(), position);
+  } else {
+    class->methods->mobility.update_position(&to, NULL);
+  }
+  profiler_leave();
+
+  if ((previous.x != position->x) || (previous.y != position->y) || (previous.z != position->z)) {
+    get_node_by_id(id)->position_stamp = ++nodes_positions_stamp;
+    node_position_update(id);
+  }
+}
+
 void nodes_update_mobility(void) {
   int i;
 
-  for (i = 0; i < nodes.size; i++) {
-    node_t     *node     = get_node_by_id(i);
-    nodearch_t *nodearch = get_nodearch_by_id(node->nodearch);
-    class_t    *class    = get_class_by_id(nodearch->mobility);
-    call_t      to       = {class->id, node->id};
+  /* the positions are evaluated when read */
+  if (nodes_mobility_lazy) {
+    nodes_mobility_due = get_time();
+    return;
+  }
 
-    if ((node->state == NODE_DEAD) || (node->state == NODE_UNDEF)) {
-      continue;
+  /* only the nodes table is scanned, the static, unborn and dead nodes are skipped */
+  for (i = 0; i < nodes_table.size; i++) {
+    if (nodes_table.clocks[i] != NODE_POSITION_FIXED) {
+      node_update_mobility(i);
     }
+  }
+}
 
+void nodes_refresh_mobility(void) {
+  int i;
 
-    class->methods->mobility.update_position(&to, NULL);
+  if (nodes_mobility_refreshed == nodes_mobility_due) {
+    return;
   }
+
+  for (i = 0; i < nodes_table.size; i++) {
+    if (nodes_table.clocks[i] < nodes_mobility_due) {
+      node_update_mobility(i);
+    }
+  }
+  nodes_mobility_refreshed = nodes_mobility_due;
+}
+
+void nodes_set_mobility_lazy(void) {
+  nodes_mobility_lazy = 1;
+}
+
+uint64_t get_nodes_positions_stamp(void) {
+  return nodes_positions_stamp;
+}
+
+uint64_t get_node_position_stamp(nodeid_t id) {
+  return get_node_by_id(id)->position_stamp;
 }
 
 
@@ -186,14 +328,30 @@ void node_birth(nodeid_t id) {
 
   /* set node active */
   node->state = NODE_ACTIVE;
+  nodes_table.states[id] = NODE_ACTIVE;
+
+  /* the mobility bootstrap may have moved the node */
+  node_position_update(id);
+
+  /* the position of a static node is never evaluated again */
+  if (node_is_static(id)) {
+    nodes_table.clocks[id] = NODE_POSITION_FIXED;
+  } else {
+    nodes_table.clocks[id] = get_time();
+    node_bound_speed(id);
+  }
 }
 
 
 /* ************************************************** */
 /* ************************************************** */
 int is_node_alive(nodeid_t id) {
-  node_t *node = get_node_by_id(id);
-  return ((node->state != NODE_DEAD) && (node->state != NODE_UNDEF));
+  int state = nodes_table.states[id];
+  return ((state != NODE_DEAD) && (state != NODE_UNDEF));
+}
+
+int get_node_state(nodeid_t id) {
+  return nodes_table.states[id];
 }
 
 
@@ -208,6 +366,12 @@ void node_kill(nodeid_t id) {
   }
 
   node->state = NODE_DEAD;
+  nodes_table.states[id] = NODE_DEAD;
+  nodes_table.clocks[id] = NODE_POSITION_FIXED;
+
+  if (nodes_grid) {
+    spatial_grid_remove(nodes_grid, id);
+  }
 
   //PRINT_REPLAY("kill %"PRId64" %d %lf %lf %lf\n", get_time(), id, node->position.x, node->position.y, node->position.z);
 
@@ -226,6 +390,7 @@ void node_kill(nodeid_t id) {
 /* ************************************************** */
 /* ************************************************** */
 int nodes_bootstrap(void) {
+  double cell_size = 0;
   int i;
 
   for (i = 0; i < nodearchs.size; i++) {
@@ -241,9 +406,26 @@ int nodes_bootstrap(void) {
     }
   }
 
-  /*  set node birth */
+  /* index nodes positions using the largest propagation range as cell size */
+  for (i = 0; i < mediums.size; i++) {
+    medium_t *medium = get_medium_by_id(i);
+    if (medium->propagation_range > cell_size) {
+      cell_size = medium->propagation_range;
+    }
+  }
+
+  if (cell_size > 0) {
+    if ((nodes_grid = spatial_grid_create(cell_size, nodes.size)) == NULL) {
+      fprintf(stderr, "unable to create the nodes spatial grid\n");
+      return -1;
+    }
+  }
+
+  /*  set node birth, the nodes architectures are known once the configuration is parsed */
   for (i = 0; i < nodes.size; i++) {
     node_t *node = get_node_by_id(i);
+    nodes_table.nodearchs[i] = node->nodearch;
+    node_position_update(i);
     scheduler_add_birth(node->birth, node->id);
   }
 
@@ -259,6 +441,16 @@ int nodes_create(void)
 
   nodes.elts = (node_t *) malloc(sizeof(node_t) * nodes.size);
 
+  nodes_table.size      = nodes.size;
+  nodes_table.positions = (position_t *) calloc(nodes.size, sizeof(position_t));
+  nodes_table.states    = (int *) malloc(sizeof(int) * nodes.size);
+  nodes_table.nodearchs = (nodearchid_t *) malloc(sizeof(nodearchid_t) * nodes.size);
+  nodes_table.clocks    = (uint64_t *) malloc(sizeof(uint64_t) * nodes.size);
+  if ((nodes_table.positions == NULL) || (nodes_table.states == NULL) || (nodes_table.nodearchs == NULL)
+      || (nodes_table.clocks == NULL)) {
+    return -1;
+  }
+
   while (i--)
   {
     node_t *node    	= get_node_by_id(i);
@@ -271,8 +463,13 @@ int nodes_create(void)
     node->position.x  = 0;
     node->position.y  = 0;
     node->position.z  = 0;
+    node->position_stamp = 0;
     node->groups.size = 0;
     node->groups.elts = NULL;
+
+    nodes_table.states[i]    = NODE_UNDEF;
+    nodes_table.nodearchs[i] = -1;
+    nodes_table.clocks[i]    = NODE_POSITION_FIXED;
   }
 
   return 0;
@@ -333,8 +530,11 @@ void set_node_private_data(call_t *to, void *data) {
 /* ************************************************** */
 /* ************************************************** */
 position_t *get_node_position(nodeid_t id) {
-  node_t *node = get_node_by_id(id);
-  return &(node->position);
+  /* never true without lazy mobility */
+  if (nodes_table.clocks[id] < nodes_mobility_due) {
+    node_update_mobility(id);
+  }
+  return nodes_table.positions + id;
 }
 
 
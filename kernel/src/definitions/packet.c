@@ -6,36 +6,77 @@
  **/
 
 #include <stdio.h>
+#include <stdint.h>
 #include <string.h>
 #include <kernel/include/data_structures/hashtable/hashtable.h>
+#include <kernel/include/data_structures/mem_fs/mem_fs.h>
 #include <kernel/include/options.h>
 #include "packet.h"
 
 
 /* ************************************************** */
 /* ************************************************** */
-// these variables are initialized but never used.
-/*static void *mem_packet = NULL;
+/* the models mostly pass literal names, whose address does not change:
+ * the last key found for an address is kept, to avoid hashing the name */
+#define FIELD_KEY_CACHE_SIZE 64
+
+typedef struct _field_key_cache {
+    char        *name;
+    field_key_t  key;
+} field_key_cache_t;
+
+static void *mem_packet = NULL;
+static void *mem_fields = NULL;
+static hashtable_t *field_keys = NULL;  /* field name -> field key + 1 */
+static char **field_key_names = NULL;   /* field key -> field name */
+static int nbr_field_keys = 0;
+static int field_keys_capacity = 0;
+static unsigned int field_keys_generation = 0; /* mem_fs generation of the field_keys table */
+static field_key_cache_t field_key_cache[FIELD_KEY_CACHE_SIZE]; /* name pointer -> field key */
 #if (SNR_STEP > 0)
 static void *mem_snr = NULL;
-#endif *///SNR_STEP //
+#endif //SNR_STEP//
 static packetid_t id = 0;
 
 
 /* ************************************************** */
 /* ************************************************** */
-int packet_init(void) {
+static void packet_field_keys_reset(void) {
+    int i;
+
+    for (i = 0; i < nbr_field_keys; i++) {
+        free(field_key_names[i]);
+    }
+    free(field_key_names);
+    field_key_names = NULL;
+    nbr_field_keys = field_keys_capacity = 0;
+    memset(field_key_cache, 0, sizeof(field_key_cache));
+}
 
-  // these variables are initialized but never used.
-    /*if ((mem_packet = malloc(sizeof(packet_t))) == NULL) {
+int packet_init(void) {
+    if ((mem_packet = mem_fs_slice_declare(sizeof(packet_t))) == NULL) {
         return -1;
     }
+    if ((mem_fields = mem_fs_slice_declare(sizeof(packet_fields_t))) == NULL) {
+        return -1;
+    }
+    /* the keys are interned once and for all, they survive a new init,
+     * unless mem_fs_clean() released the table without packet_clean() */
+    if ((field_keys != NULL) && (field_keys_generation != mem_fs_get_generation())) {
+        field_keys = NULL;
+        packet_field_keys_reset();
+    }
+    if (field_keys == NULL) {
+        if ((field_keys = hashtable_create(hash_string, equal_string, NULL, NULL)) == NULL) {
+            return -1;
+        }
+        field_keys_generation = mem_fs_get_generation();
+    }
 #if (SNR_STEP > 0)
-    if ((mem_snr = malloc(sizeof(double) * SNR_STEP)) == NULL) {
+    if ((mem_snr = mem_fs_slice_declare(sizeof(double) * SNR_STEP)) == NULL) {
         return -1;
     }
 #endif //SNR_STEP//
-*/
     return 0;
 }
 
@@ -44,6 +85,133 @@ int packet_bootstrap(void) {
 }
 
 void packet_clean(void) {
+    if (field_keys != NULL) {
+        hashtable_destroy(field_keys);
+        field_keys = NULL;
+    }
+    packet_field_keys_reset();
+}
+
+
+/* ************************************************** */
+/* ************************************************** */
+static packet_fields_t *packet_fields_create(void) {
+    packet_fields_t *fields = (packet_fields_t *) mem_fs_alloc(mem_fields);
+
+    fields->refs = 1;
+    fields->size = 0;
+    fields->capacity = PACKET_FIELDS_INLINE;
+    fields->elts = fields->inline_elts;
+    return fields;
+}
+
+static packet_fields_t *packet_fields_clone(packet_fields_t *fields) {
+    packet_fields_t *fields0 = (packet_fields_t *) mem_fs_alloc(mem_fields);
+    int i;
+
+    memcpy(fields0, fields, sizeof(packet_fields_t));
+    fields0->refs = 1;
+    if (fields->elts == fields->inline_elts) {
+        fields0->elts = fields0->inline_elts;
+    } else {
+        fields0->elts = (packet_field_t *) malloc(sizeof(packet_field_t) * fields->capacity);
+        memcpy(fields0->elts, fields->elts, sizeof(packet_field_t) * fields->size);
+    }
+
+    /* the values are owned by the fields */
+    for (i = 0; i < fields0->size; i++) {
+        fields0->elts[i].field = (field_t *) hashtable_field_clone(fields->elts[i].field);
+    }
+    return fields0;
+}
+
+static void packet_fields_release(packet_fields_t *fields) {
+    int i;
+
+    if (--fields->refs == 0) {
+        for (i = 0; i < fields->size; i++) {
+            field_destroy(fields->elts[i].field);
+        }
+        if (fields->elts != fields->inline_elts) {
+            free(fields->elts);
+        }
+        mem_fs_dealloc(mem_fields, fields);
+    }
+}
+
+/* the fields are shared by the rx clones of a packet until
+ * one of them may modify them: give it its own copy first.
+ * The copy made for the rx clones of the packet no longer
+ * matches its fields: the next clones get a new copy. */
+static void packet_fields_unshare(packet_t *packet) {
+    packet_fields_t *shared = packet->fields;
+
+    if (packet->rx_fields) {
+        packet_fields_release(packet->rx_fields);
+        packet->rx_fields = NULL;
+    }
+    if (shared->refs > 1) {
+        packet->fields = packet_fields_clone(shared);
+        shared->refs--;
+    }
+}
+
+/* a field may be added twice: the last one prevails, as with the former hashtable */
+static field_t *packet_fields_find(packet_fields_t *fields, field_key_t key) {
+    int i = fields->size;
+
+    while (i--) {
+        if (fields->elts[i].key == key) {
+            return fields->elts[i].field;
+        }
+    }
+    return NULL;
+}
+
+
+/* ************************************************** */
+/* ************************************************** */
+/* -1 if the name was never interned */
+static field_key_t packet_field_key_lookup(char *name) {
+    field_key_cache_t *cached = field_key_cache + (((uintptr_t) name >> 3) & (FIELD_KEY_CACHE_SIZE - 1));
+    field_key_t key;
+
+    /* the caller may have reused its buffer for another name: compare the names */
+    if ((cached->name == name) && !strcmp(field_key_names[cached->key], name)) {
+        return cached->key;
+    }
+
+    key = (field_key_t) ((intptr_t) hashtable_retrieve(field_keys, name) - 1);
+    if (key >= 0) {
+        cached->name = name;
+        cached->key = key;
+    }
+    return key;
+}
+
+field_key_t packet_field_key(char *name) {
+    field_key_t key = packet_field_key_lookup(name);
+
+    if (key >= 0) {
+        return key;
+    }
+
+    if (nbr_field_keys == field_keys_capacity) {
+        field_keys_capacity = field_keys_capacity ? 2 * field_keys_capacity : 32;
+        field_key_names = (char **) realloc(field_key_names, sizeof(char *) * field_keys_capacity);
+    }
+
+    /* the table refers to our own copy of the name */
+    field_key_names[nbr_field_keys] = strdup(name);
+    hashtable_insert(field_keys, field_key_names[nbr_field_keys], (void *) ((intptr_t) nbr_field_keys + 1));
+    return nbr_field_keys++;
+}
+
+char *packet_field_key_name(field_key_t key) {
+    if ((key < 0) || (key >= nbr_field_keys)) {
+        return NULL;
+    }
+    return field_key_names[key];
 }
 
 
@@ -54,8 +222,9 @@ void packet_clean(void) {
 packet_t *packet_create(call_t *to, int size, int real_size) {
     packet_t *packet;
  
-    packet = (packet_t *) malloc(sizeof(packet_t));
-    packet->fields = hashtable_create(hash_string, equal_string, hashtable_field_destroy, hashtable_field_clone);
+    packet = (packet_t *) mem_fs_alloc(mem_packet);
+    packet->fields = packet_fields_create();
+    packet->rx_fields = NULL;
     packet->noise_mW = NULL;
     packet->ber = NULL;   
     packet->id = id++;
@@ -91,15 +260,18 @@ packet_t *packet_alloc(call_t *to, int size) {
 void packet_dealloc(packet_t *packet) {
     if (packet->ber) {
 #if (SNR_STEP > 0)
-      free(packet->noise_mW);
-      free(packet->ber);        
+      mem_fs_dealloc(mem_snr, packet->noise_mW);
+      mem_fs_dealloc(mem_snr, packet->ber);
 #elif (SNR_STEP < 0)
         free(packet->noise_mW);
         free(packet->ber);
 #endif /*SNR_STEP*/
     }
-    hashtable_destroy(packet->fields);
-    free(packet);
+    packet_fields_release(packet->fields);
+    if (packet->rx_fields) {
+        packet_fields_release(packet->rx_fields);
+    }
+    mem_fs_dealloc(mem_packet, packet);
 }
 
 
@@ -108,9 +280,10 @@ void packet_dealloc(packet_t *packet) {
 packet_t *packet_clone(packet_t *packet) {
     packet_t *packet0;
 
-    packet0 = (packet_t *) malloc(sizeof(packet_t));
+    packet0 = (packet_t *) mem_fs_alloc(mem_packet);
     memcpy(packet0, packet, sizeof(packet_t));
-    packet0->fields = clone_hashtable(packet->fields);
+    packet0->fields = packet_fields_clone(packet->fields);
+    packet0->rx_fields = NULL;
     packet0->noise_mW = NULL;
     packet0->ber = NULL;
     packet0->id = id++;
@@ -122,12 +295,22 @@ packet_t *packet_clone(packet_t *packet) {
 packet_t *packet_rxclone(packet_t *packet) {
     packet_t *packet0;
 
-    packet0 = (packet_t *) malloc(sizeof(packet_t));
+    /* the rx clones share one copy of the fields, not the fields of the
+     * packet: the pointers already retrieved by its owner can not modify
+     * what the receivers read */
+    if (packet->rx_fields == NULL) {
+        packet->rx_fields = packet_fields_clone(packet->fields);
+    }
+
+    packet0 = (packet_t *) mem_fs_alloc(mem_packet);
     memcpy(packet0, packet, sizeof(packet_t));
-    packet0->fields = clone_hashtable(packet->fields);
+    /* the fields are shared, each reception only owns its own header and noise */
+    packet0->fields = packet->rx_fields;
+    packet0->fields->refs++;
+    packet0->rx_fields = NULL;
 #if (SNR_STEP > 0)
-    packet0->noise_mW = (double *) malloc(sizeof(double) * SNR_STEP);
-    packet0->ber = (double *) malloc(sizeof(double) * SNR_STEP);
+    packet0->noise_mW = (double *) mem_fs_alloc(mem_snr);
+    packet0->ber = (double *) mem_fs_alloc(mem_snr);
 #elif (SNR_STEP < 0)
     packet0->noise_mW = (double *) malloc(ceil(packet->real_size/8) * sizeof(double));
     packet0->ber = (double *) malloc(ceil(packet->real_size/8) * sizeof(double));
@@ -137,15 +320,57 @@ packet_t *packet_rxclone(packet_t *packet) {
 }
 
 
+void packet_add_field_by_key(packet_t *packet, field_key_t key, field_t *field){
+  packet_fields_t *fields;
+
+  packet_fields_unshare(packet);
+  fields = packet->fields;
+
+  if (fields->size == fields->capacity) {
+    fields->capacity *= 2;
+    if (fields->elts == fields->inline_elts) {
+      fields->elts = (packet_field_t *) malloc(sizeof(packet_field_t) * fields->capacity);
+      memcpy(fields->elts, fields->inline_elts, sizeof(packet_field_t) * fields->size);
+    } else {
+      fields->elts = (packet_field_t *) realloc(fields->elts, sizeof(packet_field_t) * fields->capacity);
+    }
+  }
+
+  fields->elts[fields->size].key = key;
+  fields->elts[fields->size].field = field;
+  fields->size++;
+
+  return;
+}
+
+
+field_t *packet_retrieve_field_by_key(packet_t *packet, field_key_t key){
+  /* the field may be modified through the returned pointer */
+  packet_fields_unshare(packet);
+  return packet_fields_find(packet->fields, key);
+}
+
+
+const field_t *packet_get_field_by_key(packet_t *packet, field_key_t key){
+  return packet_fields_find(packet->fields, key);
+}
+
+
+/* ************************************************** */
+/* ************************************************** */
 void packet_add_field(packet_t *packet, char* name, field_t *field){
-  hashtable_insert(packet->fields, name, field);
+  packet_add_field_by_key(packet, packet_field_key(name), field);
 
   return;
 }
 
 
 field_t *packet_retrieve_field(packet_t *packet, char* name){
-  return hashtable_retrieve(packet->fields, name);
+  field_key_t key = packet_field_key_lookup(name);
+
+  if (key < 0)
+    return NULL;
+  return packet_retrieve_field_by_key(packet, key);
 }
 
 
@@ -156,3 +381,22 @@ void *packet_retrieve_field_value_ptr(packet_t *packet, char* name){
   else
     return field->value;
 }
+
+
+const field_t *packet_get_field(packet_t *packet, char* name){
+  /* a name never interned cannot be the one of a field: do not intern it */
+  field_key_t key = packet_field_key_lookup(name);
+
+  if (key < 0)
+    return NULL;
+  return packet_get_field_by_key(packet, key);
+}
+
+
+const void *packet_get_field_value_ptr(packet_t *packet, char* name){
+  const field_t *field = packet_get_field(packet, name);
+  if (field == NULL)
+      return NULL;
+  else
+    return field->value;
+}
@@ -33,6 +33,6 @@ PhyModel* RegisteredRxNode::GetPhyModel() const{
   return phy_model_ptr_;
 }
 
-SetOfFrequencyIntervalRegisteredRxNode RegisteredRxNode::GetAllFrequencyInterval() const{
+const SetOfFrequencyIntervalRegisteredRxNode &RegisteredRxNode::GetAllFrequencyInterval() const{
   return frequency_bands_;
 }
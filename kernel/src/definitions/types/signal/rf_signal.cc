@@ -13,14 +13,19 @@
 #include <kernel/include/definitions/types/signal/rf_signal.h>
 #include <kernel/include/definitions/packet.h>
 
-RFSignal::RFSignal(nodeid_t source, packet_t* packet) : Signal(source), packet_(packet){};
+RFSignal::RFSignal(nodeid_t source, packet_t* packet, SignalKind kind) : Signal(source, kind), packet_(packet){};
 
-RFSignal::RFSignal(call_t *to, call_t *from_interface, packet_t* packet) : Signal(to, from_interface), packet_(packet){};
+RFSignal::RFSignal(call_t *to, call_t *from_interface, packet_t* packet, SignalKind kind) : Signal(to, from_interface, kind), packet_(packet){};
 
-RFSignal::RFSignal(nodeid_t source,std::shared_ptr<Waveform> waveform) : Signal(source), waveform_(waveform){};
+RFSignal::RFSignal(nodeid_t source,std::shared_ptr<Waveform> waveform, SignalKind kind) : Signal(source, kind), waveform_(waveform){};
 
 //RFSignal::RFSignal(call_t *to, call_t *from_interface, packet_t* packet, Time T_begin, Time T_end) : Signal(to, from_interface), packet_(packet), begin_(T_begin), end_(T_end){};
-RFSignal::RFSignal(call_t *to, call_t *from_interface, packet_t* packet, Time T_begin, Time T_end) : Signal(to, from_interface, T_begin, T_end), packet_(packet){};
+RFSignal::RFSignal(call_t *to, call_t *from_interface, packet_t* packet, Time T_begin, Time T_end, SignalKind kind) : Signal(to, from_interface, T_begin, T_end, kind), packet_(packet){};
+
+// the radio frequency signals are the RF, LoRa and jamming ones
+bool RFSignal::IsKindOf(SignalKind kind){
+  return (kind == SignalKind::RF) || (kind == SignalKind::LoRa) || (kind == SignalKind::JammingRF);
+}
 
 RFSignal::~RFSignal(){};
 
@@ -33,11 +38,7 @@ Frequency RFSignal::GetBandwidth() const {
 }
 
 Frequency RFSignal::GetBandwidthImpl() const {
-  Frequency signal_bandwidth_Hz = 0;
-  for (auto freq_interval : waveform_->GetAllFrequencyInterval()){
-    signal_bandwidth_Hz += (freq_interval->GetHighPoint() - freq_interval->GetLowPoint());
-  }
-  return signal_bandwidth_Hz;
+  return waveform_->GetBandwidth();
 }
 
 
@@ -47,6 +48,14 @@ void RFSignal::SetWaveform(std::shared_ptr<Waveform> waveform) {
 }
 
 
+double RFSignal::GetPSDScale() const {
+  return psd_scale_;
+}
+
+void RFSignal::SetPSDScale(double psd_scale) {
+  psd_scale_ = psd_scale;
+}
+
 packet_t *RFSignal::GetPacket_Deprecated(){
   return GetPacket_DeprecatedImpl();
 }
@@ -72,6 +81,12 @@ std::shared_ptr<Signal> RFSignal::CloneImpl(){
   return new_signal;
 };
 
+std::shared_ptr<Signal> RFSignal::CreateReceptionImpl(){
+  auto reception = std::make_shared<RFSignal>(source_, packet_);
+  reception->SetWaveform(waveform_);
+  return reception;
+}
+
 void RFSignal::PrintSignalImpl() const {
   std::cout<<" This is a RF Signal which contains the following packet:"<< std::endl;
   std::cout<<"   packet information : id="<<packet_->id<<", rxdBm="<<packet_->rxdBm<<std::endl;
@@ -14,13 +14,13 @@
 
 SignallUid Signal::uid_counter_ = 0;
 
-Signal::Signal (nodeid_t source): uid_(uid_counter_), source_(source), SINR_(0.0), SNR_(0.0) {
+Signal::Signal (nodeid_t source, SignalKind kind): uid_(uid_counter_), kind_(kind), source_(source), SINR_(0.0), SNR_(0.0) {
   ++uid_counter_;
   begin_=0;
   end_=0;
 }
 
-Signal::Signal (call_t *to,call_t *from_interface): uid_(uid_counter_), source_(from_interface->object), SINR_(0.0), SNR_(0.0) {
+Signal::Signal (call_t *to,call_t *from_interface, SignalKind kind): uid_(uid_counter_), kind_(kind), source_(from_interface->object), SINR_(0.0), SNR_(0.0) {
   from_interface_ = {from_interface->classid, from_interface->object};
   to_interface_ = {to->classid, to->object};
   ++uid_counter_;
@@ -28,7 +28,7 @@ Signal::Signal (call_t *to,call_t *from_interface): uid_(uid_counter_), source_(
   end_=0;
 }
 
-Signal::Signal (call_t *to,call_t *from_interface, Time T_begin, Time T_end): uid_(uid_counter_), source_(from_interface->object), SINR_(0.0), SNR_(0.0){
+Signal::Signal (call_t *to,call_t *from_interface, Time T_begin, Time T_end, SignalKind kind): uid_(uid_counter_), kind_(kind), source_(from_interface->object), SINR_(0.0), SNR_(0.0){
   from_interface_ = {from_interface->classid, from_interface->object};
   to_interface_ = {to->classid, to->object};
   ++uid_counter_;
@@ -47,10 +47,23 @@ SignallUid Signal::GetUID() const{
   return uid_;
 }
 
+SignalKind Signal::GetKind() const{
+  return kind_;
+}
+
 std::shared_ptr<Signal> Signal::Clone() {
   return CloneImpl();
 }
 
+std::shared_ptr<Signal> Signal::CreateReception() {
+  return CreateReceptionImpl();
+}
+
+// by default, nothing is known to be shared between the receivers
+std::shared_ptr<Signal> Signal::CreateReceptionImpl() {
+  return CloneImpl();
+}
+
 double Signal::GetSINR() const{
   return SINR_;
 }
@@ -15,6 +15,9 @@ WaveformUid Waveform::uid_counter_ = 0;
 
 Waveform::Waveform(SetOfFrequencyIntervalWaveform frequency_bands) : uid_(uid_counter_) {
   frequency_interval_ = frequency_bands;
+  for (auto const &freq : frequency_interval_){
+    bandwidth_ += freq->GetHighPoint() - freq->GetLowPoint();
+  }
   ++uid_counter_;
 }
 
@@ -26,11 +29,16 @@ Waveform::~Waveform(){};
 
 void Waveform::AddFrequencyInterval(std::shared_ptr<FrequencyIntervalWaveform> freq){
   frequency_interval_.push_back(freq);
+  bandwidth_ += freq->GetHighPoint() - freq->GetLowPoint();
 };
-SetOfFrequencyIntervalWaveform Waveform::GetAllFrequencyInterval(){
+const SetOfFrequencyIntervalWaveform &Waveform::GetAllFrequencyInterval() const{
   return frequency_interval_;
 }
 
+Frequency Waveform::GetBandwidth() const{
+  return bandwidth_;
+}
+
 void Waveform::SetSignal(std::weak_ptr<Signal> signal) {
   signal_ = signal;
 }
@@ -41,7 +49,7 @@ std::weak_ptr<Signal> Waveform::GetSignal() {
 
 std::shared_ptr<Waveform> Waveform::Clone() {
   auto new_waveform = std::make_shared<Waveform>();
-  for (std::shared_ptr<FrequencyIntervalWaveform> freq : frequency_interval_){
+  for (auto const &freq : frequency_interval_){
     auto new_freq = std::dynamic_pointer_cast<FrequencyIntervalWaveform>(freq->Clone());
     new_waveform->AddFrequencyInterval(new_freq);
     new_freq->AddToWaveform(new_waveform);
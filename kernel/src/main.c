@@ -25,6 +25,7 @@
 #include <kernel/include/model_handlers/monitor.h>
 #include <kernel/include/model_handlers/noise.h>
 #include <kernel/include/tools/math/rng/rng.h>
+#include <kernel/include/tools/profiler/profiler.h>
 #include <libraries/wiplan/wiplan_parser.h>
 
 /* ************************************************** */
@@ -79,7 +80,7 @@ int main(int argc, char *argv[]) {
 int do_parse_arg(int argc, char *argv[]) {
   char c;
 
-  while((c = getopt(argc, argv, "c:s:m:S:")) != -1) {
+  while((c = getopt(argc, argv, "c:s:m:S:q:lP:")) != -1) {
 
     switch (c) {
       case 'c':
@@ -94,6 +95,15 @@ int do_parse_arg(int argc, char *argv[]) {
       case 'S':
         rng_set_position_seed(optarg);
         break;
+      case 'q':
+        config_set_scheduler(optarg);
+        break;
+      case 'l':
+        nodes_set_mobility_lazy();
+        break;
+      case 'P':
+        profiler_set_output(optarg);
+        break;
       default: 
         return -1;
     }
@@ -162,6 +172,7 @@ void do_clean(void) {
   wiplan_parser_clean();
   timer_clean();
   packet_clean();
+  profiler_clean();
   mem_fs_clean();
 }
 
@@ -7,6 +7,7 @@
 
 #include <kernel/include/definitions/types.h>
 #include <kernel/include/definitions/class.h>
+#include <kernel/include/tools/profiler/profiler.h>
 
 
 /* ************************************************** */
@@ -40,7 +41,9 @@ void interface_cs(call_t *to, call_t *from, packet_t *packet)
   class_t *class = get_class_by_id(to->class);
   if (class->model->type != MODELTYPE_INTERFACE)
     return;
-  return class->methods->interface.cs(to, from, packet);
+  profiler_enter(to->class);
+  class->methods->interface.cs(to, from, packet);
+  profiler_leave();
 }
 
 void interface_rx(call_t *to, call_t *from, packet_t *packet)
@@ -48,7 +51,9 @@ void interface_rx(call_t *to, call_t *from, packet_t *packet)
   class_t *class = get_class_by_id(to->class);
   if (class->model->type != MODELTYPE_INTERFACE)
     return;
+  profiler_enter(to->class);
   class->methods->interface.rx(to, from, packet);
+  profiler_leave();
 }
 
 double interface_gain_tx(call_t *to, call_t *from, position_t *pos)
@@ -5,6 +5,9 @@
  *  \date   2017
  **/
 
+#include <unordered_map>
+#include <vector>
+
 #include <kernel/include/options.h>
 
 #include <kernel/include/definitions/class.h>
@@ -21,6 +24,7 @@
 #include <kernel/include/model_handlers/transceiver.h>
 #include <kernel/include/model_handlers/interface.h>
 #include <kernel/include/model_handlers/noise.h>
+#include <kernel/include/tools/profiler/profiler.h>
 
 #include <kernel/include/model_handlers/cxx_model_handlers.h>
 #include <kernel/include/definitions/models/spectrum/spectrum_model.h>
@@ -37,12 +41,49 @@ double MEDIA_GET_NOISE(call_t *from_transceiver, call_t *from_interface, int cha
 
 /* ************************************************** */
 /* ************************************************** */
+// receptions of the transmission being processed, kept from one transmission to the other
+static std::vector<rx_begin_t> media_receptions;
+
+// only the nodes table is read for the receivers, not their node_t
+static void media_tx_to_node(nodeid_t node, nodeid_t rx_node, medium_t *medium, call_t *from_interface, packet_t *packet) {
+  double      dist     = distance(get_node_position(node), get_node_position(rx_node));
+  double      travel_time   = dist / medium->speed_of_light;
+  nodearch_t *nodearch;
+  uint64_t    clock;
+  int j;
+
+  if (nodes_table.states[rx_node] == NODE_DEAD) {
+    return;
+  }
+
+  if ((medium->propagation_range) && (dist > medium->propagation_range)) {
+    return;
+  }
+
+  nodearch = get_nodearch_by_id(nodes_table.nodearchs[rx_node]);
+
+  for (j = 0; j < nodearch->interfaces.size; j++) {
+    class_t  *interface_class = get_class_by_id(nodearch->interfaces.elts[j]);
+    call_t    to_interface   = {interface_class->id, rx_node};
+
+    // rx interface receives signal only if it is connected to the same medium than tx interface
+    if (medium->id == interface_get_medium(&to_interface, from_interface)) {
+      packet_t *packet_rx = packet_rxclone(packet);
+      clock = packet->clock0 + ((uint64_t) travel_time);
+      packet_rx->clock0 = clock;
+      packet_rx->clock1 = clock + packet->duration;
+      media_receptions.push_back({clock, to_interface, packet_rx});
+    }
+  }
+}
+
 void MEDIA_TX(call_t *from_transceiver, call_t *from_interface, packet_t *packet) {
   int        i      = get_node_count();
   node_t    *node   = get_node_by_id(from_interface->object);
   call_t     from0  = {-1, -1};
   medium_t  *medium = get_medium_by_id(interface_get_medium(from_interface, &from0));
-  uint64_t   clock;
+  int       *rx_nodes = NULL;
+  int        nbr_rx_nodes;
 
   // check wether node is active
   if (node->state != NODE_ACTIVE) {
@@ -67,37 +108,23 @@ void MEDIA_TX(call_t *from_transceiver, call_t *from_interface, packet_t *packet
   // scheduler tx_end event
   scheduler_add_tx_end(packet->clock1, from_transceiver, from_interface, packet);
 
-  // scheduler rx_begin event for old WSNET version (packet based)
-  while (i--) {
-    node_t     *rx_node  = get_node_by_id(i);
-    double      dist     = distance(&(node->position), &(rx_node->position));
-    double      travel_time   = dist / medium->speed_of_light;
-    nodearch_t *nodearch = get_nodearch_by_id(rx_node->nodearch);
-    int j;
-
-    if (rx_node->state == NODE_DEAD) {
-      continue;
-    }
-
-    if ((medium->propagation_range) && (dist > medium->propagation_range)) {
-      continue;
+  // only nodes close enough are candidates when the medium has a propagation range
+  if (medium->propagation_range) {
+    if ((rx_nodes = get_nodes_in_range(get_node_position(node->id), medium->propagation_range, &nbr_rx_nodes)) != NULL) {
+      i = nbr_rx_nodes;
     }
+  }
 
-    for (j = 0; j < nodearch->interfaces.size; j++) {
-      class_t  *interface_class = get_class_by_id(nodearch->interfaces.elts[j]);
-      call_t    to_interface   = {interface_class->id, rx_node->id};
-
-      // rx interface receives signal only if it is connected to the same medium than tx interface
-      if (medium->id == interface_get_medium(&to_interface, from_interface)) {
-        packet_t *packet_rx = packet_rxclone(packet);
-        clock = packet->clock0 + ((uint64_t) travel_time);
-        packet_rx->clock0 = clock;
-        packet_rx->clock1 = clock + packet->duration;
-        scheduler_add_rx_begin(clock, &to_interface, from_interface, packet_rx);
-      }
-    }
+  // scheduler rx_begin event for old WSNET version (packet based)
+  // nodes are visited by decreasing id to keep the events order of the exhaustive search
+  media_receptions.clear();
+  while (i--) {
+    media_tx_to_node(node->id, rx_nodes ? rx_nodes[i] : i, medium, from_interface, packet);
   }
 
+  // a single queue entry for all the receivers
+  scheduler_add_rx_begin_fanout(from_interface, media_receptions.data(), media_receptions.size());
+
 }
 
 
@@ -110,7 +137,9 @@ void medium_tx_end(packet_t *packet, call_t *from_transceiver, call_t *from_inte
     return;
   }
 
+  profiler_enter(from_transceiver->classid);
   from_transceiver_class->methods->transceiver.tx_end(from_transceiver, from_interface, packet);
+  profiler_leave();
 
   //TODO : to be moved at least in tx_end of transceiver but MAC in more appropriated
   packet_dealloc(packet);
@@ -187,7 +216,66 @@ void medium_rx(packet_t *packet, call_t *to_interface, call_t *from_interface) {
 
 /* ************************************************** */
 /* ************************************************** */
-void medium_compute_rxdBm(packet_t *packet, call_t *to_interface, call_t *from_interface)
+// pathloss of a link, computed once as long as its nodes do not move
+struct link_budget_t {
+  bool     valid;
+  double   txdBm;   // pathloss input
+  int      channel;
+  uint64_t stamp;   // nodes positions stamp when it was computed
+  double   rxdBm;   // pathloss output
+};
+
+struct medium_link_budgets_t {
+  int cacheable = -1; // asked to the pathloss model on the first packet
+  std::unordered_map<uint64_t, link_budget_t> links; // by (tx node, rx node)
+};
+
+// link budgets of each medium
+static std::vector<medium_link_budgets_t> media_link_budgets;
+
+static double media_get_pathloss(call_t *to_interface, call_t *from_interface, packet_t *packet, double rxdBm) {
+  medium_t *medium = get_medium_by_id(interface_get_medium(to_interface, from_interface));
+  if (medium->pathloss == -1) {
+    return rxdBm;
+  }
+
+  class_t *pathloss    = get_class_by_id(medium->pathloss);
+  call_t   to_pathloss = {medium->pathloss, medium->id};
+
+  if (media_link_budgets.size() <= (size_t) medium->id) {
+    media_link_budgets.resize(medium->id + 1);
+  }
+  medium_link_budgets_t &budgets = media_link_budgets[medium->id];
+
+  if (budgets.cacheable == -1) {
+    budgets.cacheable = pathloss->methods->pathloss.cacheable ? pathloss->methods->pathloss.cacheable(&to_pathloss) : 0;
+  }
+  if (!budgets.cacheable) {
+    profiler_enter(medium->pathloss);
+    rxdBm = pathloss->methods->pathloss.pathloss(&to_pathloss, to_interface, from_interface, packet, rxdBm);
+    profiler_leave();
+    return rxdBm;
+  }
+
+  // outdated when the tx power or the channel changed, or when one of the nodes moved since
+  uint64_t       key  = (((uint64_t) (uint32_t) from_interface->object) << 32) | ((uint32_t) to_interface->object);
+  link_budget_t &link = budgets.links[key];
+  if (!link.valid || (link.txdBm != rxdBm) || (link.channel != packet->channel)
+      || (get_node_position_stamp(from_interface->object) > link.stamp)
+      || (get_node_position_stamp(to_interface->object) > link.stamp)) {
+    link.valid   = true;
+    link.txdBm   = rxdBm;
+    link.channel = packet->channel;
+    link.stamp   = get_nodes_positions_stamp();
+    profiler_enter(medium->pathloss);
+    link.rxdBm   = pathloss->methods->pathloss.pathloss(&to_pathloss, to_interface, from_interface, packet, rxdBm);
+    profiler_leave();
+  }
+
+  return link.rxdBm;
+}
+
+double medium_get_rxdBm(packet_t *packet, call_t *to_interface, call_t *from_interface)
 {
   double      rxdBm  = packet->txdBm;
   position_t *pos_tx = get_node_position(packet->node);
@@ -204,7 +292,8 @@ void medium_compute_rxdBm(packet_t *packet, call_t *to_interface, call_t *from_i
   {
 
     //rxdbm = pathloss + shadowing + fading      (pathloss has the original rxdBm value embedded)
-    rxdBm = medium_get_pathloss(to_interface, from_interface, packet, rxdBm) +
+    //only the fading and the shadowing are drawn for each packet when the pathloss is cacheable
+    rxdBm = media_get_pathloss(to_interface, from_interface, packet, rxdBm) +
         medium_get_fading(to_interface, from_interface, packet, rxdBm) +
         medium_get_shadowing(to_interface, from_interface, packet, rxdBm);
 
@@ -216,6 +305,13 @@ void medium_compute_rxdBm(packet_t *packet, call_t *to_interface, call_t *from_i
   // antenna rx white noise
   rxdBm += interface_get_loss(to_interface, from_interface);
 
+  return rxdBm;
+}
+
+void medium_compute_rxdBm(packet_t *packet, call_t *to_interface, call_t *from_interface)
+{
+  double rxdBm = medium_get_rxdBm(packet, to_interface, from_interface);
+
   // rx power
   packet->rxdBm = rxdBm;
   packet->rxmW = dBm2mW(rxdBm);
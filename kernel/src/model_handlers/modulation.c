@@ -11,6 +11,7 @@
 #include <kernel/include/definitions/class.h>
 #include "media_rxtx.h"
 #include <kernel/include/modelutils.h>
+#include <kernel/include/tools/profiler/profiler.h>
 
 /* ************************************************** */
 /* ************************************************** */
@@ -45,7 +46,10 @@ double do_modulate(call_t *from, classid_t modulation, double rxmW, double noise
   //printf("Do-modulate:  SNR = %f (%f dBm), noise = %.10f mW (%f dBm), rxmW = %.10f (%f dbm)\n", snr, mW2dBm(snr), noise, mW2dBm(noise), rxmW, mW2dBm(rxmW));
 
   //return class->methods->modulation.modulate(&to, NULL, snr);
-  return class->methods->modulation.modulate(&to, from, snr);
+  profiler_enter(modulation);
+  snr = class->methods->modulation.modulate(&to, from, snr);
+  profiler_leave();
+  return snr;
 }
 
 double do_modulate_snr(call_t *from, classid_t modulation, double snr) {
@@ -57,6 +61,27 @@ double do_modulate_snr(call_t *from, classid_t modulation, double snr) {
   return class->methods->modulation.modulate(&to, from, snr);
 }
 
+void do_modulate_batch(call_t *from, classid_t modulation, double rxmW, const double *noise, double *ber, int n) {
+  class_t *class = get_class_by_id(modulation);
+  call_t   to    = {modulation, -1};
+  int      i;
+
+  /* the snr are computed in place, in the ber array */
+  for (i = 0; i < n; i++) {
+    ber[i] = noise[i] ? (rxmW / noise[i]) : MAX_SNR;
+  }
+
+  profiler_enter(modulation);
+  if (class->methods->modulation.modulate_batch) {
+    class->methods->modulation.modulate_batch(&to, from, ber, ber, n);
+  } else {
+    for (i = 0; i < n; i++) {
+      ber[i] = class->methods->modulation.modulate(&to, from, ber[i]);
+    }
+  }
+  profiler_leave();
+}
+
 /* ************************************************** */
 /* ************************************************** */
 
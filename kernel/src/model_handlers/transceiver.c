@@ -6,6 +6,7 @@
  **/
 
 #include <kernel/include/definitions/class.h>
+#include <kernel/include/tools/profiler/profiler.h>
 #include "media_rxtx.h"
 
 
@@ -104,7 +105,9 @@ void transceiver_cs(call_t *to, call_t *from, packet_t *packet)
   class_t *class = get_class_by_id(to->class);
   if (class->model->type != MODELTYPE_TRANSCEIVER)
     return;
-  return class->methods->transceiver.cs(to, from, packet);    
+  profiler_enter(to->class);
+  class->methods->transceiver.cs(to, from, packet);
+  profiler_leave();
 }
 
 void transceiver_set_sensibility(call_t *to, call_t *from, double sensibility) {
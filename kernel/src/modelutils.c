@@ -11,12 +11,14 @@
 
 #include <kernel/include/definitions/class.h>
 #include <kernel/include/definitions/types.h>
+#include <kernel/include/tools/profiler/profiler.h>
 
 
 /* ************************************************** */
 /* ************************************************** */
 void TX(call_t *to, call_t *from, packet_t *packet) {
   class_t *class = get_class_by_id(to->class);
+  profiler_enter(to->class);
   if (class->implem.cxx.implem_type == CXX_IMPLEM){
     int item = *((int *) hashtable_retrieve(class->objects.indexes, (void *) &to->object));
     class->methods->generic_cpp.tx(class->objects.object[item],to, from, packet);
@@ -24,9 +26,11 @@ void TX(call_t *to, call_t *from, packet_t *packet) {
   else {
     class->methods->generic.tx(to, from, packet);
   }
+  profiler_leave();
 }
 void RX(call_t *to, call_t *from, packet_t *packet) {
   class_t *class = get_class_by_id(to->class);
+  profiler_enter(to->class);
   if (class->implem.cxx.implem_type == CXX_IMPLEM){
     int item = *((int *) hashtable_retrieve(class->objects.indexes, (void *) &to->object));
     class->methods->generic_cpp.rx(class->objects.object[item],to, from, packet);
@@ -34,6 +38,7 @@ void RX(call_t *to, call_t *from, packet_t *packet) {
   else {
     class->methods->generic.rx(to, from, packet);
   }
+  profiler_leave();
 }
 
 int IOCTL(call_t *to, int option, void *in, void **out) {
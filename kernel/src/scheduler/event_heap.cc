@@ -0,0 +1,77 @@
+/**
+ *  \file   event_heap.cc
+ *  \brief  Binary heap of events, stored in a std::vector
+ *  \author agent
+ *  \date   2026
+ **/
+
+#include <kernel/include/scheduler/event_heap.h>
+
+void EventHeap::SiftUp(size_t index){
+  std::unique_ptr<Event> e(std::move(events_[index]));
+
+  while (index > 0){
+    size_t parent = (index - 1) / 2;
+    if (!(*e < *events_[parent])){
+      break;
+    }
+    events_[index] = std::move(events_[parent]);
+    events_[index]->queue_index_ = index;
+    index = parent;
+  }
+
+  e->queue_index_ = index;
+  events_[index] = std::move(e);
+}
+
+void EventHeap::SiftDown(size_t index){
+  size_t size = events_.size();
+  std::unique_ptr<Event> e(std::move(events_[index]));
+
+  while (2 * index + 1 < size){
+    size_t child = 2 * index + 1;
+    if ((child + 1 < size) && (*events_[child + 1] < *events_[child])){
+      child++;
+    }
+    if (!(*events_[child] < *e)){
+      break;
+    }
+    events_[index] = std::move(events_[child]);
+    events_[index]->queue_index_ = index;
+    index = child;
+  }
+
+  e->queue_index_ = index;
+  events_[index] = std::move(e);
+}
+
+std::unique_ptr<Event> EventHeap::RemoveAt(size_t index){
+  std::unique_ptr<Event> removed(std::move(events_[index]));
+  std::unique_ptr<Event> last(std::move(events_.back()));
+  events_.pop_back();
+
+  // fill the hole with the last event, then restore the heap property
+  if (index < events_.size()){
+    events_[index] = std::move(last);
+    if ((index > 0) && (*events_[index] < *events_[(index - 1) / 2])){
+      SiftUp(index);
+    } else {
+      SiftDown(index);
+    }
+  }
+
+  return removed;
+}
+
+void EventHeap::Push(std::unique_ptr<Event> e){
+  events_.push_back(std::move(e));
+  SiftUp(events_.size() - 1);
+}
+
+std::unique_ptr<Event> EventHeap::Pop(){
+  return RemoveAt(0);
+}
+
+std::unique_ptr<Event> EventHeap::Remove(Event *e){
+  return RemoveAt(e->queue_index_);
+}
@@ -6,8 +6,10 @@
  **/
 
 #include <iostream>
+#include <new>
 #include <stdlib.h>
 #include <stdio.h>
+#include <string.h>
 #include <sys/time.h>
 #include <sys/resource.h>
 #include <inttypes.h>
@@ -28,7 +30,10 @@
 
 #include <kernel/include/model_handlers/node_mobility.h>
 #include <kernel/include/model_handlers/media_rxtx.h>
+#include <kernel/include/tools/profiler/profiler.h>
 #include <kernel/include/scheduler/scheduler_standard_containers.h>
+#include <kernel/include/scheduler/scheduler_calendar_queue.h>
+#include <kernel/include/scheduler/scheduler_partitioned.h>
 
 
 /* ************************************************** */
@@ -41,25 +46,140 @@
 /* ************************************************** */
 #define SCHEDULER_MILESTONE_PERIOD 2000000000
 
+#define EVENT_SLICE_ALIGNMENT 8
+#define EVENT_SLICE_MAX_SIZE  256
+
 EventUid Event::uid_counter_ = 0;
 
+// names of the event types in the profiling report, indexed by priority
+static const char *event_names[] = {"NONE", "BIRTH", "MOBILITY", "TX_END", "RX_END", "RX_BEGIN",
+                                    "RX_SIGNAL_BEGIN", "TX_SIGNAL_END", "RX_SIGNAL_END",
+                                    "CALLBACK", "MILESTONE", "QUIT"};
+
+/* ************************************************** */
+/* ************************************************** */
+
+// one mem_fs slice per (aligned) event size, declared on first use
+static void *event_slices[EVENT_SLICE_MAX_SIZE / EVENT_SLICE_ALIGNMENT + 1] = {NULL};
+
+// slice of the event_t returned by scheduler_add_callback()
+static void *event_t_slice = NULL;
+
+// mem_fs generation the slices above were declared in
+static unsigned int event_slices_generation = 0;
+
+// forget the slices once mem_fs_clean() released them, so that they are declared again
+static void event_slices_refresh(void){
+  unsigned int generation = mem_fs_get_generation();
+
+  if (generation == event_slices_generation){
+    return;
+  }
+
+  for (auto &slice : event_slices){
+    slice = NULL;
+  }
+  event_t_slice = NULL;
+  event_slices_generation = generation;
+}
+
+// blocks allocated before mem_fs_clean() were released along with their slice
+static bool event_slices_released(void){
+  return mem_fs_get_generation() != event_slices_generation;
+}
+
+void *Event::operator new(std::size_t size){
+  std::size_t index = (size + EVENT_SLICE_ALIGNMENT - 1) / EVENT_SLICE_ALIGNMENT;
+  void *pointer;
+
+  if (size > EVENT_SLICE_MAX_SIZE){
+    return ::operator new(size);
+  }
+
+  event_slices_refresh();
+
+  if ((event_slices[index] == NULL)
+      && ((event_slices[index] = mem_fs_slice_declare(index * EVENT_SLICE_ALIGNMENT)) == NULL)){
+    throw std::bad_alloc();
+  }
+
+  if ((pointer = mem_fs_alloc(event_slices[index])) == NULL){
+    throw std::bad_alloc();
+  }
+
+  return pointer;
+}
+
+void Event::operator delete(void *pointer, std::size_t size){
+  if (pointer == NULL){
+    return;
+  }
+
+  if (size > EVENT_SLICE_MAX_SIZE){
+    ::operator delete(pointer);
+    return;
+  }
+
+  if (event_slices_released()){
+    return;
+  }
+
+  mem_fs_dealloc(event_slices[(size + EVENT_SLICE_ALIGNMENT - 1) / EVENT_SLICE_ALIGNMENT], pointer);
+}
+
+// reception buffers released by the rx begin events, reused by the next ones
+static std::vector<std::vector<EventRxFanout::Reception>> reception_buffers;
+
+std::vector<EventRxFanout::Reception> EventRxFanout::AcquireReceptions(){
+  std::vector<Reception> receptions;
+
+  if (!reception_buffers.empty()){
+    receptions = std::move(reception_buffers.back());
+    reception_buffers.pop_back();
+  }
+
+  return receptions;
+}
+
+void EventRxFanout::ReleaseReceptions(std::vector<Reception> receptions){
+  if (receptions.capacity() == 0){
+    return;
+  }
+
+  receptions.clear();
+  reception_buffers.push_back(std::move(receptions));
+}
+
 /* ************************************************** */
 /* ************************************************** */
 
-// create the scheduler
-auto scheduler = std::make_unique<SchedulerStandardContainers>();
+// create the scheduler, the implementation may be changed before bootstrap (see scheduler_set_type)
+std::unique_ptr<Scheduler> scheduler = std::make_unique<SchedulerStandardContainers>();
+static const char *scheduler_type = SCHEDULER_TYPE_STANDARD;
+static int scheduler_partitions = SCHEDULER_DEFAULT_PARTITIONS;
+static char *scheduler_trace = NULL;
 
 /* ************************************************** */
 /* ************************************************** */
 
-Scheduler::Scheduler() : running_(false), clock_(0), end_(0), nbr_events_executed_(0){
+Scheduler::Scheduler() : running_(false), clock_(0), end_(0), nbr_events_executed_(0), rx_begin_preempted_(false),
+    tracing_(false), trace_(NULL){
 }
 
-Scheduler::Scheduler(Time end) : running_(false), clock_(0), end_(end), nbr_events_executed_(0){
+Scheduler::Scheduler(Time end) : running_(false), clock_(0), end_(end), nbr_events_executed_(0),
+    rx_begin_preempted_(false), tracing_(false), trace_(NULL){
 }
 
 void Scheduler::SimulationRun(){
   running_ = true;
+  profiler_start();
+
+  if (scheduler_trace != NULL){
+    tracing_ = (TraceOpenImpl(scheduler_trace) == 0);
+    if (!tracing_){
+      fprintf(stderr, "scheduler: can not open the trace '%s', the events are not traced\n", scheduler_trace);
+    }
+  }
 
   while (running_) {
     std::unique_ptr<Event> event(NextEvent());
@@ -97,7 +217,15 @@ void Scheduler::SimulationEnd(){
   std::cout<<"  speedup: "<<speedup<<std::endl;
   std::cout<<"  events in queue: "<<CountEvents()<<std::endl;
   std::cout<<"  events executed: "<<CountEventsExecuted()<<std::endl;
+  std::cout<<"  events per second: "<<(unanotime ? ((double) CountEventsExecuted()) * NANO / unanotime : 0)<<std::endl;
+  if (tracing_){
+    TraceCloseImpl();
+    tracing_ = false;
+  }
+  PrintStatsImpl();
   std::cout<<"-----------------------------------"<<std::endl;
+
+  profiler_write(SimulationTimeGet());
 }
 
 Time Scheduler::SimulationTimeGet(){
@@ -141,7 +269,11 @@ event_t Scheduler::AddTxEnd(Time clock, call_t to, call_t from, packet_t *packet
   return AddEvent(std::move(e));
 }
 event_t Scheduler::AddRxBegin(Time clock, call_t to, call_t from, packet_t *packet){
-  auto e = std::make_unique<EventRxTx>(clock, PRIORITY_RX_BEGIN, to, from, packet);
+  rx_begin_t reception = {clock, to, packet};
+  return AddRxBegin(from, &reception, 1);
+}
+event_t Scheduler::AddRxBegin(call_t from, const rx_begin_t *receptions, int size){
+  auto e = std::make_unique<EventRxFanout>(PRIORITY_RX_BEGIN, from, receptions, size);
   return AddEvent(std::move(e));
 }
 event_t Scheduler::AddRxEnd(Time clock, call_t to, call_t from, packet_t *packet){
@@ -167,7 +299,27 @@ event_t Scheduler::AddCallback(Time clock, call_t to, call_t from, callback_t ca
   return AddEvent(std::move(e));
 }
 void Scheduler::DeleteCallback(event_t event_info){
-  DeleteEvent(event_info.uid_);
+  DeleteEvent(event_info);
+}
+event_t Scheduler::RescheduleCallback(event_t event_info, Time clock){
+  Event *e = GetEventByHandle(event_info);
+
+  // the callback has already been executed or deleted
+  if (e == nullptr){
+    event_info.handle_ = -1;
+    return event_info;
+  }
+
+  // remove and add it again under a new uid, as a new callback would be,
+  // so that the execution order is not changed by the reschedule
+  std::unique_ptr<Event> event(RemoveEventImpl(e));
+  event->clock_ = clock;
+  event->uid_ = Event::uid_counter_++;
+
+  event_info.uid_ = event->uid_;
+  event_info.clock_ = event->clock_;
+  AddEventImpl(std::move(event));
+  return event_info;
 }
 
 int Scheduler::CountEvents(){
@@ -178,8 +330,17 @@ int Scheduler::CountEventsExecuted(){
 }
 
 void Scheduler::ExecuteEvent(std::unique_ptr<Event> event){
+  event_priority_t priority = event->priority_;
+  int classid = PROFILER_KERNEL;
+  uint64_t start = profiler_enabled ? profiler_clock() : 0;
+
   nbr_events_executed_++;
 
+  // the receptions of a rx begin event are traced one by one
+  if (tracing_ && (event->priority_ != PRIORITY_RX_BEGIN)){
+    TraceEventImpl(GetEventNode(event.get()), event->clock_, event->priority_);
+  }
+
   switch (event->priority_) {
     case PRIORITY_BIRTH:{
       std::unique_ptr<EventBirth> event_birth(static_cast<EventBirth*>(event.release()));
@@ -189,8 +350,34 @@ void Scheduler::ExecuteEvent(std::unique_ptr<Event> event){
       mobility_event(event->clock_);
       break;}
     case PRIORITY_RX_BEGIN:{
-      std::unique_ptr<EventRxTx> event_rxtx(static_cast<EventRxTx*>(event.release()));
-      medium_cs(event_rxtx->packet_, &(event_rxtx->to_), &(event_rxtx->from_));
+      EventRxFanout *event_fanout = static_cast<EventRxFanout*>(event.get());
+      call_t from = event_fanout->from_;
+
+      // the receptions due now are executed in a row: their uids follow each
+      // other, thus no pending event comes between them, unless a reception
+      // adds an event of a lower priority at the current date
+      rx_begin_preempted_ = false;
+      for (;;){
+        EventRxFanout::Reception reception = event_fanout->receptions_.back();
+        event_fanout->receptions_.pop_back();
+        if (tracing_){
+          TraceEventImpl(reception.to_.object, reception.clock_, PRIORITY_RX_BEGIN);
+        }
+        medium_cs(reception.packet_, &(reception.to_), &from);
+
+        if (event_fanout->receptions_.empty() || (event_fanout->receptions_.back().clock_ != clock_)
+            || rx_begin_preempted_){
+          break;
+        }
+        nbr_events_executed_++;
+      }
+
+      // the other receptions go back to the queue under the date and uid of the next one
+      if (!event_fanout->receptions_.empty()){
+        event_fanout->clock_ = event_fanout->receptions_.back().clock_;
+        event_fanout->uid_ = event_fanout->receptions_.back().uid_;
+        AddEventImpl(std::move(event));
+      }
       break;}
     case PRIORITY_RX_END:{
       std::unique_ptr<EventRxTx> event_rxtx(static_cast<EventRxTx*>(event.release()));
@@ -217,7 +404,15 @@ void Scheduler::ExecuteEvent(std::unique_ptr<Event> event){
       if ((event_cb->to_.object != -1) && (!is_node_alive(event_cb->to_.object))) {
         break;
       }
+      // the callbacks of the kernel have no class
+      classid = (event_cb->to_.classid >= 0) ? event_cb->to_.classid : PROFILER_KERNEL;
+      if (classid != PROFILER_KERNEL){
+        profiler_enter(classid);
+      }
       event_cb->callback_(&(event_cb->to_), &(event_cb->from_), event_cb->arg_);
+      if (classid != PROFILER_KERNEL){
+        profiler_leave();
+      }
       break;}
     case PRIORITY_MILESTONE:
       AddMilestone(SimulationTimeGet() + SCHEDULER_MILESTONE_PERIOD);
@@ -228,26 +423,133 @@ void Scheduler::ExecuteEvent(std::unique_ptr<Event> event){
     default:
       break;
   }
+
+  profiler_event(priority, event_names[priority], classid, start);
 }
 
+nodeid_t Scheduler::GetEventNode(const Event *e){
+  switch (e->priority_){
+    case PRIORITY_BIRTH:
+      return static_cast<const EventBirth*>(e)->nodeid_;
+    case PRIORITY_RX_BEGIN:
+      return static_cast<const EventRxFanout*>(e)->receptions_.back().to_.object;
+    case PRIORITY_TX_END:
+    case PRIORITY_RX_END:
+      return static_cast<const EventRxTx*>(e)->to_.object;
+    case PRIORITY_CALLBACK:
+      return static_cast<const EventCallback*>(e)->to_.object;
+    default:
+      return -1;
+  }
+}
+
+int Scheduler::TraceOpenImpl(const char *path){
+  trace_ = fopen(path, "w");
+  return (trace_ == NULL) ? -1 : 0;
+}
+
+void Scheduler::TraceEventImpl(nodeid_t node, Time clock, event_priority_t priority){
+  fprintf(trace_, "%d %" PRIu64 " %d\n", node, clock, priority);
+}
+
+void Scheduler::TraceCloseImpl(void){
+  fclose(trace_);
+  trace_ = NULL;
+}
 
 event_t Scheduler::AddEvent(std::unique_ptr<Event> e){
-  event_t event_info = {e->uid_, e->clock_};
+  // this event comes before the next receptions of the rx begin event being executed
+  if ((e->clock_ == clock_) && (e->priority_ < PRIORITY_RX_BEGIN)){
+    rx_begin_preempted_ = true;
+  }
+
+  // only callbacks may be deleted or rescheduled, thus only them get a handle
+  if (e->priority_ == PRIORITY_CALLBACK){
+    if (free_handles_.empty()){
+      e->handle_ = handles_.size();
+      handles_.push_back(e.get());
+    } else {
+      e->handle_ = free_handles_.back();
+      free_handles_.pop_back();
+      handles_[e->handle_] = e.get();
+    }
+  }
+
+  event_t event_info = {e->uid_, e->clock_, e->handle_};
   AddEventImpl(std::move(e));
+  if (profiler_enabled){
+    profiler_queue(CountEventsImpl());
+  }
   return event_info;
 }
-void Scheduler::DeleteEvent(uid_t uid){
-  DeleteEventImpl(uid);
+void Scheduler::DeleteEvent(event_t event_info){
+  Event *e = GetEventByHandle(event_info);
+
+  // the event has already been executed or deleted
+  if (e == nullptr){
+    return;
+  }
+
+  std::unique_ptr<Event> event(RemoveEventImpl(e));
+  ReleaseHandle(event.get());
 }
 std::unique_ptr<Event> Scheduler::NextEvent(void){
-  return NextEventImpl();
+  std::unique_ptr<Event> event(NextEventImpl());
+
+  if (event != nullptr){
+    ReleaseHandle(event.get());
+  }
+
+  return event;
+}
+Event *Scheduler::GetEventByHandle(event_t event_info){
+  if ((event_info.handle_ < 0) || ((size_t) event_info.handle_ >= handles_.size())){
+    return nullptr;
+  }
+
+  // the handle may have been given to another event since then
+  Event *e = handles_[event_info.handle_];
+  if ((e == nullptr) || (e->uid_ != event_info.uid_)){
+    return nullptr;
+  }
+
+  return e;
+}
+void Scheduler::ReleaseHandle(Event *e){
+  if (e->handle_ < 0){
+    return;
+  }
+
+  handles_[e->handle_] = nullptr;
+  free_handles_.push_back(e->handle_);
+  e->handle_ = -1;
 }
 
 /* ************************************************** */
 /* ************************************************** */
+static int scheduler_create(const char *type, Time end) {
+  if (!strcmp(type, SCHEDULER_TYPE_STANDARD)) {
+    scheduler = std::make_unique<SchedulerStandardContainers>(end);
+    scheduler_type = SCHEDULER_TYPE_STANDARD;
+  } else if (!strcmp(type, SCHEDULER_TYPE_CALENDAR)) {
+    scheduler = std::make_unique<SchedulerCalendarQueue>(end);
+    scheduler_type = SCHEDULER_TYPE_CALENDAR;
+  } else if (!strcmp(type, SCHEDULER_TYPE_PARTITIONED)) {
+    scheduler = std::make_unique<SchedulerPartitioned>(end, scheduler_partitions, false);
+    scheduler_type = SCHEDULER_TYPE_PARTITIONED;
+  } else if (!strcmp(type, SCHEDULER_TYPE_PARTITIONED_CHECK)) {
+    scheduler = std::make_unique<SchedulerPartitioned>(end, scheduler_partitions, true);
+    scheduler_type = SCHEDULER_TYPE_PARTITIONED_CHECK;
+  } else {
+    return -1;
+  }
 
+  return 0;
+}
 
 void scheduler_clean(void) {
+  // destroy the remaining events while their mem_fs slices are still valid
+  scheduler_create(scheduler_type, scheduler->SimulationTimeGetEnd());
 }
 
 int scheduler_bootstrap(void) {
@@ -286,26 +588,62 @@ void scheduler_add_milestone(uint64_t clock) {
 }
 
 event_t *scheduler_add_callback(uint64_t clock, call_t *to, call_t *from, callback_t callback, void *arg) {
+  event_t *event;
+
   if ( ( (scheduler->SimulationTimeGetEnd()) && (clock > scheduler->SimulationTimeGetEnd()) ) || (clock < scheduler->SimulationTimeGet()) ) {
     return NULL;
   }
 
   // create a pointer to an event for backward compatibility
-  event_t *event = (event_t *) malloc(sizeof(event_t));
-
-  event_t event_info = scheduler->AddCallback(clock, *to, *from, callback, arg);
+  event_slices_refresh();
+  if ((event_t_slice == NULL) && ((event_t_slice = mem_fs_slice_declare(sizeof(event_t))) == NULL)) {
+    return NULL;
+  }
+  if ((event = (event_t *) mem_fs_alloc(event_t_slice)) == NULL) {
+    return NULL;
+  }
 
-  event->uid_ = event_info.uid_;
-  event->clock_ = event_info.clock_;
+  *event = scheduler->AddCallback(clock, *to, *from, callback, arg);
 
   return event;
 }
 
+int scheduler_add_callback_event(event_t *event, uint64_t clock, call_t *to, call_t *from, callback_t callback, void *arg) {
+  if ( ( (scheduler->SimulationTimeGetEnd()) && (clock > scheduler->SimulationTimeGetEnd()) ) || (clock < scheduler->SimulationTimeGet()) ) {
+    event->handle_ = -1;
+    return -1;
+  }
+
+  *event = scheduler->AddCallback(clock, *to, *from, callback, arg);
+  return 0;
+}
+
+void scheduler_cancel_callback(event_t *event) {
+  scheduler->DeleteCallback(*event);
+  event->handle_ = -1;
+}
+
+int scheduler_reschedule_callback(event_t *event, uint64_t clock) {
+  if ( ( (scheduler->SimulationTimeGetEnd()) && (clock > scheduler->SimulationTimeGetEnd()) ) || (clock < scheduler->SimulationTimeGet()) ) {
+    return -1;
+  }
+
+  *event = scheduler->RescheduleCallback(*event, clock);
+  return (event->handle_ < 0) ? -1 : 0;
+}
+
 void scheduler_add_rx_begin(uint64_t clock, call_t *to, call_t *from, packet_t *packet) {
   scheduler->AddRxBegin(clock, *to, *from, packet);
   return;
 }
 
+void scheduler_add_rx_begin_fanout(call_t *from, rx_begin_t *receptions, int size) {
+  if (size > 0) {
+    scheduler->AddRxBegin(*from, receptions, size);
+  }
+  return;
+}
+
 void scheduler_add_rx_signal_begin(uint64_t clock, SpectrumModel *spectrum, std::shared_ptr<Signal> signal) {
   scheduler->AddRxBegin(clock,spectrum,signal);
   return;
@@ -333,10 +671,51 @@ void scheduler_add_tx_signal_end(uint64_t clock, SpectrumModel *spectrum, std::s
 
 void scheduler_delete_callback(event_t *event) {
   scheduler->DeleteCallback(*event);
-  free(event);
+  if (!event_slices_released()) {
+    mem_fs_dealloc(event_t_slice, event);
+  }
   return;
 }
 
+int scheduler_set_type(const char *type) {
+  Time end = scheduler->SimulationTimeGetEnd();
+
+  if (!strcmp(type, scheduler_type)) {
+    return 0;
+  }
+
+  // events already scheduled would be lost
+  if (scheduler->CountEvents()) {
+    fprintf(stderr, "scheduler: can not change the scheduler once events are scheduled\n");
+    return -1;
+  }
+
+  return scheduler_create(type, end);
+}
+
+int scheduler_set_partitions(int nbr_partitions) {
+  if (nbr_partitions < 1) {
+    return -1;
+  }
+
+  scheduler_partitions = nbr_partitions;
+  return 0;
+}
+
+int scheduler_set_trace(const char *path) {
+  if ((path == NULL) || (*path == '\0')) {
+    return -1;
+  }
+
+  free(scheduler_trace);
+  scheduler_trace = strdup(path);
+  return 0;
+}
+
+const char *scheduler_get_type(void) {
+  return scheduler_type;
+}
+
 void scheduler_set_end(uint64_t end) {
   scheduler->SimulationTimeSetEnd(end);
 }
@@ -0,0 +1,178 @@
+/**
+ *  \file   scheduler_calendar_queue.cc
+ *  \brief  Scheduler implementation using a calendar queue
+ *  \author agent
+ *  \date   2026
+ **/
+
+#include <algorithm>
+#include <kernel/include/scheduler/scheduler_calendar_queue.h>
+
+/* ************************************************** */
+/* ************************************************** */
+#define CALENDAR_QUEUE_MIN_BUCKETS   16
+#define CALENDAR_QUEUE_DEFAULT_WIDTH 1000000 // 1 ms
+#define CALENDAR_QUEUE_WIDTH_SAMPLES 25
+
+
+/* ************************************************** */
+/* ************************************************** */
+SchedulerCalendarQueue::SchedulerCalendarQueue() : buckets_(CALENDAR_QUEUE_MIN_BUCKETS),
+    bucket_width_(CALENDAR_QUEUE_DEFAULT_WIDTH), current_bucket_(0),
+    current_bucket_top_(CALENDAR_QUEUE_DEFAULT_WIDTH), nbr_events_(0){
+}
+
+SchedulerCalendarQueue::SchedulerCalendarQueue(Time end) : Scheduler(end), buckets_(CALENDAR_QUEUE_MIN_BUCKETS),
+    bucket_width_(CALENDAR_QUEUE_DEFAULT_WIDTH), current_bucket_(0),
+    current_bucket_top_(CALENDAR_QUEUE_DEFAULT_WIDTH), nbr_events_(0){
+}
+
+SchedulerCalendarQueue::~SchedulerCalendarQueue(){
+  buckets_.clear();
+}
+
+/* ************************************************** */
+/* ************************************************** */
+void SchedulerCalendarQueue::SetCurrentBucket(Time clock){
+  Time day = clock / bucket_width_;
+  current_bucket_ = day & (buckets_.size() - 1);
+  current_bucket_top_ = (day + 1) * bucket_width_;
+}
+
+void SchedulerCalendarQueue::InsertInBucket(std::unique_ptr<Event> e_){
+  Bucket &bucket = buckets_[(e_->clock_ / bucket_width_) & (buckets_.size() - 1)];
+  // buckets are sorted by decreasing order
+  auto position = std::lower_bound(bucket.begin(), bucket.end(), e_, CompareEventGreater());
+  bucket.insert(position, std::move(e_));
+}
+
+Time SchedulerCalendarQueue::ComputeBucketWidth(std::vector<std::unique_ptr<Event>> &events){
+  size_t nbr_samples = std::min(events.size(), (size_t) CALENDAR_QUEUE_WIDTH_SAMPLES);
+
+  if (nbr_samples < 2){
+    return bucket_width_;
+  }
+
+  // the width is computed from the earliest events, which are the next to be dequeued
+  std::partial_sort(events.begin(), events.begin() + nbr_samples, events.end(), CompareEventLess());
+
+  double average = (double) (events[nbr_samples-1]->clock_ - events[0]->clock_) / (nbr_samples - 1);
+  double sum = 0;
+  int nbr_separations = 0;
+
+  // recompute the average without the separations much larger than the average
+  for (size_t i = 1; i < nbr_samples; i++){
+    double separation = (double) (events[i]->clock_ - events[i-1]->clock_);
+    if (separation <= 2 * average){
+      sum += separation;
+      nbr_separations++;
+    }
+  }
+
+  if (nbr_separations == 0 || sum == 0){
+    return bucket_width_;
+  }
+
+  return std::max((Time) (3 * sum / nbr_separations), (Time) 1);
+}
+
+void SchedulerCalendarQueue::Resize(size_t nbr_buckets){
+  std::vector<std::unique_ptr<Event>> events;
+  events.reserve(nbr_events_);
+
+  for (auto &bucket : buckets_){
+    for (auto &e : bucket){
+      events.push_back(std::move(e));
+    }
+  }
+
+  bucket_width_ = ComputeBucketWidth(events);
+  buckets_.clear();
+  buckets_.resize(nbr_buckets);
+
+  if (events.empty()){
+    return;
+  }
+
+  SetCurrentBucket((*std::min_element(events.begin(), events.end(), CompareEventLess()))->clock_);
+  for (auto &e : events){
+    InsertInBucket(std::move(e));
+  }
+}
+
+/* ************************************************** */
+/* ************************************************** */
+void SchedulerCalendarQueue::AddEventImpl(std::unique_ptr<Event> e_){
+  // the current bucket must never be after the earliest event
+  if (nbr_events_ == 0 || e_->clock_ < current_bucket_top_ - bucket_width_){
+    SetCurrentBucket(e_->clock_);
+  }
+
+  InsertInBucket(std::move(e_));
+  nbr_events_++;
+
+  if (nbr_events_ > 2 * buckets_.size()){
+    Resize(2 * buckets_.size());
+  }
+}
+
+std::unique_ptr<Event> SchedulerCalendarQueue::RemoveEventImpl(Event *e_){
+  Bucket &bucket = buckets_[(e_->clock_ / bucket_width_) & (buckets_.size() - 1)];
+  // events are unique, the search stops right on the event
+  auto position = std::lower_bound(bucket.begin(), bucket.end(), e_,
+      [](const std::unique_ptr<Event> &lhs, const Event *rhs){ return *lhs > *rhs; });
+
+  if ((position == bucket.end()) || (position->get() != e_)){
+    return nullptr;
+  }
+
+  std::unique_ptr<Event> removed(std::move(*position));
+  bucket.erase(position);
+  nbr_events_--;
+
+  return removed;
+}
+
+std::unique_ptr<Event> SchedulerCalendarQueue::NextEventImpl(){
+  if (nbr_events_ == 0){
+    running_ = false;
+    return nullptr;
+  }
+
+  Bucket *bucket = nullptr;
+
+  // look for an event in the current year, one bucket after the other
+  for (size_t i = 0; i < buckets_.size(); i++){
+    Bucket &candidate = buckets_[current_bucket_];
+    if (!candidate.empty() && candidate.back()->clock_ < current_bucket_top_){
+      bucket = &candidate;
+      break;
+    }
+    current_bucket_ = (current_bucket_ + 1) & (buckets_.size() - 1);
+    current_bucket_top_ += bucket_width_;
+  }
+
+  // no event in the current year: direct search for the earliest event
+  if (bucket == nullptr){
+    for (auto &candidate : buckets_){
+      if (!candidate.empty() && (bucket == nullptr || *candidate.back() < *bucket->back())){
+        bucket = &candidate;
+      }
+    }
+    SetCurrentBucket(bucket->back()->clock_);
+  }
+
+  std::unique_ptr<Event> current_event(std::move(bucket->back()));
+  bucket->pop_back();
+  nbr_events_--;
+
+  if (buckets_.size() > CALENDAR_QUEUE_MIN_BUCKETS && nbr_events_ < buckets_.size() / 2){
+    Resize(buckets_.size() / 2);
+  }
+
+  return current_event;
+}
+
+int SchedulerCalendarQueue::CountEventsImpl(){
+  return nbr_events_;
+}
@@ -0,0 +1,464 @@
+/**
+ *  \file   scheduler_partitioned.cc
+ *  \brief  Scheduler running the nodes as logical processes, one after the other over each window
+ *  \author agent
+ *  \date   2026
+ **/
+
+#include <iostream>
+#include <algorithm>
+#include <limits>
+#include <numeric>
+#include <stdio.h>
+#include <inttypes.h>
+#include <kernel/include/scheduler/scheduler_partitioned.h>
+#include <kernel/include/definitions/medium.h>
+
+/* ************************************************** */
+/* ************************************************** */
+#define PARTITIONED_GLOBAL_PARTITION 0
+#define PARTITIONED_NO_LOOKAHEAD     std::numeric_limits<Time>::max()
+
+
+/* ************************************************** */
+/* ************************************************** */
+SchedulerPartitioned::SchedulerPartitioned(int nbr_partitions, bool check) :
+    nbr_partitions_(nbr_partitions), check_(check), partitioned_(false), partitions_(1),
+    nbr_events_(0), lookahead_(0), lookahead_outdated_(false), window_start_(0), window_end_(0),
+    current_partition_(PARTITIONED_GLOBAL_PARTITION), current_event_(nullptr), nbr_windows_(0), nbr_barriers_(0),
+    nbr_window_events_(0), nbr_critical_events_(0), nbr_violations_(0), nbr_stragglers_(0),
+    trace_checked_(false), nbr_mismatches_(0){
+}
+
+SchedulerPartitioned::SchedulerPartitioned(Time end, int nbr_partitions, bool check) : Scheduler(end),
+    nbr_partitions_(nbr_partitions), check_(check), partitioned_(false), partitions_(1),
+    nbr_events_(0), lookahead_(0), lookahead_outdated_(false), window_start_(0), window_end_(0),
+    current_partition_(PARTITIONED_GLOBAL_PARTITION), current_event_(nullptr), nbr_windows_(0), nbr_barriers_(0),
+    nbr_window_events_(0), nbr_critical_events_(0), nbr_violations_(0), nbr_stragglers_(0),
+    trace_checked_(false), nbr_mismatches_(0){
+}
+
+SchedulerPartitioned::~SchedulerPartitioned(){
+  partitions_.clear();
+}
+
+int SchedulerPartitioned::CountPartitions(){
+  return partitions_.size() - 1;
+}
+
+Time SchedulerPartitioned::GetLookahead(){
+  return lookahead_;
+}
+
+uint64_t SchedulerPartitioned::CountWindows(){
+  return nbr_windows_;
+}
+
+uint64_t SchedulerPartitioned::CountViolations(){
+  return nbr_violations_;
+}
+
+uint64_t SchedulerPartitioned::CountStragglers(){
+  return nbr_stragglers_;
+}
+
+uint64_t SchedulerPartitioned::CountMismatches(){
+  return nbr_mismatches_;
+}
+
+/* ************************************************** */
+/* ************************************************** */
+int SchedulerPartitioned::GetPartition(nodeid_t node){
+  if (!partitioned_ || (node < 0) || ((size_t) node >= node_partitions_.size())){
+    return PARTITIONED_GLOBAL_PARTITION;
+  }
+
+  return node_partitions_[node];
+}
+
+int SchedulerPartitioned::GetPartition(const Event *e_){
+  return GetPartition(GetEventNode(e_));
+}
+
+void SchedulerPartitioned::PushEvent(std::unique_ptr<Event> e_){
+  int partition = GetPartition(e_.get());
+
+  // a transmission reaching several LPs gives each of them the rx begin event
+  // of its own receivers, under the uid of their next reception
+  if (partitioned_ && (e_->priority_ == PRIORITY_RX_BEGIN)){
+    EventRxFanout *fanout = static_cast<EventRxFanout*>(e_.get());
+    std::vector<EventRxFanout::Reception> &receptions = fanout->receptions_;
+
+    if (std::any_of(receptions.begin(), receptions.end(), [this, partition](const EventRxFanout::Reception &reception){
+          return GetPartition(reception.to_.object) != partition; })){
+      std::vector<std::vector<EventRxFanout::Reception>> split(partitions_.size());
+      for (auto &reception : receptions){
+        split[GetPartition(reception.to_.object)].push_back(reception);
+      }
+
+      for (size_t i = 0; i < split.size(); i++){
+        if ((i != (size_t) partition) && !split[i].empty()){
+          partitions_[i].Push(std::make_unique<EventRxFanout>(PRIORITY_RX_BEGIN, fanout->from_, std::move(split[i])));
+          nbr_events_++;
+        }
+      }
+      receptions.swap(split[partition]);
+    }
+  }
+
+  partitions_[partition].Push(std::move(e_));
+  nbr_events_++;
+}
+
+void SchedulerPartitioned::CreatePartitions(){
+  int nbr_nodes = get_node_count();
+  int nbr_partitions = std::max(1, std::min(nbr_partitions_, nbr_nodes));
+  std::vector<nodeid_t> ids(nbr_nodes);
+
+  // stripes along the x axis, holding the same number of nodes
+  std::iota(ids.begin(), ids.end(), 0);
+  std::stable_sort(ids.begin(), ids.end(), [](nodeid_t lhs, nodeid_t rhs){
+      return get_node_position(lhs)->x < get_node_position(rhs)->x; });
+
+  node_partitions_.assign(nbr_nodes, PARTITIONED_GLOBAL_PARTITION);
+  for (int i = 0; i < nbr_nodes; i++){
+    node_partitions_[ids[i]] = 1 + (int) (((int64_t) i * nbr_partitions) / nbr_nodes);
+  }
+
+  partitions_.resize(nbr_partitions + 1);
+  partition_clocks_.assign(nbr_partitions + 1, 0);
+  window_events_.assign(nbr_partitions + 1, 0);
+  partitioned_ = true;
+
+  // give the events scheduled at bootstrap to their LP
+  EventHeap pending;
+  std::swap(pending, partitions_[PARTITIONED_GLOBAL_PARTITION]);
+  nbr_events_ = 0;
+  while (!pending.Empty()){
+    PushEvent(pending.Pop());
+  }
+
+  ComputeLookahead();
+}
+
+void SchedulerPartitioned::ComputeLookahead(){
+  size_t nbr_partitions = partitions_.size() - 1;
+  double speed_of_light = 0;
+
+  lookahead_outdated_ = false;
+
+  // no other LP to receive from
+  if ((nbr_partitions < 2) || (mediums.size == 0)){
+    lookahead_ = PARTITIONED_NO_LOOKAHEAD;
+    return;
+  }
+
+  for (int i = 0; i < mediums.size; i++){
+    // instantaneous propagation
+    if (mediums.elts[i].speed_of_light <= 0){
+      lookahead_ = 0;
+      return;
+    }
+    speed_of_light = std::max(speed_of_light, mediums.elts[i].speed_of_light);
+  }
+
+  // x range of each stripe, nodes may have moved across the stripes
+  std::vector<std::pair<double, double>> ranges(nbr_partitions,
+      std::make_pair(std::numeric_limits<double>::max(), std::numeric_limits<double>::lowest()));
+  for (size_t id = 0; id < node_partitions_.size(); id++){
+    std::pair<double, double> &range = ranges[node_partitions_[id] - 1];
+    double x = get_node_position(id)->x;
+    range.first = std::min(range.first, x);
+    range.second = std::max(range.second, x);
+  }
+  std::sort(ranges.begin(), ranges.end());
+
+  // smallest x distance between two nodes of different LPs
+  double gap = std::numeric_limits<double>::max();
+  double right = ranges[0].second;
+  for (size_t i = 1; i < nbr_partitions; i++){
+    gap = std::min(gap, ranges[i].first - right);
+    right = std::max(right, ranges[i].second);
+  }
+
+  lookahead_ = (gap > 0) ? (Time) (gap / speed_of_light) : 0;
+}
+
+/* ************************************************** */
+/* ************************************************** */
+bool SchedulerPartitioned::InWindow(int partition){
+  const EventHeap &global = partitions_[PARTITIONED_GLOBAL_PARTITION];
+
+  if (partitions_[partition].Empty() || (partitions_[partition].Top()->clock_ >= window_end_)){
+    return false;
+  }
+
+  // a global event scheduled within the window stops it
+  return global.Empty() || (*partitions_[partition].Top() < *global.Top());
+}
+
+int SchedulerPartitioned::NextPartition(){
+  // a barrier is alone in its window
+  if (current_partition_ == PARTITIONED_GLOBAL_PARTITION){
+    return -1;
+  }
+
+  // the current LP goes on up to the end of the window, then the next ones
+  for (size_t i = current_partition_; i < partitions_.size(); i++){
+    if (InWindow(i)){
+      return i;
+    }
+  }
+
+  return -1;
+}
+
+void SchedulerPartitioned::CloseWindow(){
+  uint64_t critical = 0;
+
+  for (auto partition : window_partitions_){
+    critical = std::max(critical, window_events_[partition]);
+    nbr_window_events_ += window_events_[partition];
+    window_events_[partition] = 0;
+  }
+
+  nbr_critical_events_ += critical;
+  window_partitions_.clear();
+}
+
+int SchedulerPartitioned::OpenWindow(){
+  int first = -1;
+
+  CloseWindow();
+  nbr_windows_++;
+
+  if (lookahead_outdated_){
+    ComputeLookahead();
+  }
+
+  for (size_t i = 0; i < partitions_.size(); i++){
+    if (!partitions_[i].Empty() && ((first < 0) || (*partitions_[i].Top() < *partitions_[first].Top()))){
+      first = i;
+    }
+  }
+
+  // the positions are updated once per window, the LPs then run from its start
+  Time start = partitions_[first].Top()->clock_;
+  if (start > window_start_){
+    SimulationTimeAdvanceClock(start);
+  }
+  window_start_ = start;
+
+  // global events are barriers, and so is every event without lookahead
+  if ((first == PARTITIONED_GLOBAL_PARTITION) || (lookahead_ == 0)){
+    if (first == PARTITIONED_GLOBAL_PARTITION){
+      nbr_barriers_++;
+    }
+    window_end_ = window_start_;
+    current_partition_ = first;
+    return first;
+  }
+
+  window_end_ = (window_start_ > PARTITIONED_NO_LOOKAHEAD - lookahead_) ?
+      PARTITIONED_NO_LOOKAHEAD : window_start_ + lookahead_;
+
+  // the window stops at the next global event
+  if (!partitions_[PARTITIONED_GLOBAL_PARTITION].Empty()){
+    window_end_ = std::min(window_end_, partitions_[PARTITIONED_GLOBAL_PARTITION].Top()->clock_);
+  }
+
+  // the earliest event is in the window, whatever the global events at its date
+  current_partition_ = 1;
+  int next = NextPartition();
+  return (next < 0) ? first : next;
+}
+
+/* ************************************************** */
+/* ************************************************** */
+void SchedulerPartitioned::CheckLookahead(Time clock, int partition){
+  // the LPs of the window would not have been independent
+  if ((current_partition_ != PARTITIONED_GLOBAL_PARTITION) && (partition != current_partition_)
+      && (clock < window_end_)){
+    nbr_violations_++;
+    if (check_){
+      fprintf(stderr, "scheduler: lookahead violation at %" PRIu64 ": event scheduled at %" PRIu64
+              " from LP %d to LP %d, window ending at %" PRIu64 "\n",
+              clock_, clock, current_partition_, partition, window_end_);
+    }
+  }
+}
+
+void SchedulerPartitioned::CheckOrder(int partition, const Event *e_){
+  // the LP has already gone past this date, it has been run too far
+  if (e_->clock_ < partition_clocks_[partition]){
+    nbr_stragglers_++;
+    if (check_){
+      fprintf(stderr, "scheduler: LP %d executes event %" PRIu64 " at %" PRIu64 " after reaching %" PRIu64 "\n",
+              partition, (uint64_t) e_->uid_, e_->clock_, partition_clocks_[partition]);
+    }
+  }
+
+  partition_clocks_[partition] = std::max(partition_clocks_[partition], e_->clock_);
+}
+
+void SchedulerPartitioned::AddEventImpl(std::unique_ptr<Event> e_){
+  if (e_.get() == current_event_){
+    // remaining receptions of a transmission, they have been checked when scheduled
+  } else if (partitioned_ && (e_->priority_ == PRIORITY_RX_BEGIN)){
+    for (auto &reception : static_cast<EventRxFanout*>(e_.get())->receptions_){
+      CheckLookahead(reception.clock_, GetPartition(reception.to_.object));
+    }
+  } else {
+    CheckLookahead(e_->clock_, GetPartition(e_.get()));
+  }
+
+  PushEvent(std::move(e_));
+}
+
+std::unique_ptr<Event> SchedulerPartitioned::RemoveEventImpl(Event *e_){
+  nbr_events_--;
+  return partitions_[GetPartition(e_)].Remove(e_);
+}
+
+std::unique_ptr<Event> SchedulerPartitioned::NextEventImpl(){
+  if (nbr_events_ == 0){
+    running_ = false;
+    return nullptr;
+  }
+
+  if (!partitioned_){
+    CreatePartitions();
+  }
+
+  int next = NextPartition();
+  if (next < 0){
+    next = OpenWindow();
+  }
+
+  std::unique_ptr<Event> current_event(partitions_[next].Pop());
+  nbr_events_--;
+
+  // each LP has its own clock within the window
+  clock_ = current_event->clock_;
+  CheckOrder(next, current_event.get());
+
+  current_partition_ = next;
+  current_event_ = current_event.get();
+  if (window_events_[next]++ == 0){
+    window_partitions_.push_back(next);
+  }
+
+  if (current_event->priority_ == PRIORITY_MOBILITY){
+    lookahead_outdated_ = true;
+  }
+
+  return current_event;
+}
+
+int SchedulerPartitioned::CountEventsImpl(){
+  return nbr_events_;
+}
+
+/* ************************************************** */
+/* ************************************************** */
+int SchedulerPartitioned::TraceOpenImpl(const char *path){
+  FILE *trace;
+  int node, priority;
+  Time clock;
+
+  if (!check_){
+    return Scheduler::TraceOpenImpl(path);
+  }
+
+  if ((trace = fopen(path, "r")) == NULL){
+    return -1;
+  }
+
+  // the events of each node, the global events first
+  while (fscanf(trace, "%d %" SCNu64 " %d", &node, &clock, &priority) == 3){
+    if (node < -1){
+      continue;
+    }
+    if ((size_t) (node + 1) >= trace_events_.size()){
+      trace_events_.resize(node + 2);
+    }
+    trace_events_[node + 1].emplace_back(clock, (event_priority_t) priority);
+  }
+  fclose(trace);
+
+  trace_next_.assign(trace_events_.size(), 0);
+  trace_checked_ = true;
+  return 0;
+}
+
+void SchedulerPartitioned::TraceEventImpl(nodeid_t node, Time clock, event_priority_t priority){
+  size_t index = node + 1;
+  bool expected;
+
+  if (!check_){
+    Scheduler::TraceEventImpl(node, clock, priority);
+    return;
+  }
+
+  // events of a node are compared in order, those at the same date and of the same type being alike
+  expected = (index < trace_events_.size()) && (trace_next_[index] < trace_events_[index].size());
+  if (expected && (trace_events_[index][trace_next_[index]] == std::make_pair(clock, priority))){
+    trace_next_[index]++;
+    return;
+  }
+
+  if (nbr_mismatches_++ == 0){
+    if (expected){
+      fprintf(stderr, "scheduler: node %d executes an event of priority %d at %" PRIu64 ", the sequential run"
+              " an event of priority %d at %" PRIu64 "\n", node, priority, clock,
+              trace_events_[index][trace_next_[index]].second, trace_events_[index][trace_next_[index]].first);
+    } else {
+      fprintf(stderr, "scheduler: node %d executes an event of priority %d at %" PRIu64 ", missing from the"
+              " sequential run\n", node, priority, clock);
+    }
+  }
+
+  // a different event takes the place of the expected one
+  if (expected){
+    trace_next_[index]++;
+  }
+}
+
+void SchedulerPartitioned::TraceCloseImpl(){
+  if (!check_){
+    Scheduler::TraceCloseImpl();
+    return;
+  }
+
+  // the events of the sequential run that have not been executed
+  for (size_t i = 0; i < trace_events_.size(); i++){
+    nbr_mismatches_ += trace_events_[i].size() - trace_next_[i];
+  }
+}
+
+/* ************************************************** */
+/* ************************************************** */
+void SchedulerPartitioned::PrintStatsImpl(){
+  CloseWindow();
+
+  std::cout<<"  logical processes: "<<CountPartitions()<<std::endl;
+  if (lookahead_ == PARTITIONED_NO_LOOKAHEAD){
+    std::cout<<"  lookahead: unbounded"<<std::endl;
+  } else {
+    std::cout<<"  lookahead: "<<lookahead_<<std::endl;
+  }
+  std::cout<<"  windows: "<<nbr_windows_<<" ("<<nbr_barriers_<<" global events)"<<std::endl;
+  std::cout<<"  events per window: "<<(nbr_windows_ ? ((double) nbr_window_events_) / nbr_windows_ : 0)<<std::endl;
+  std::cout<<"  available parallelism: "<<(nbr_critical_events_ ? ((double) nbr_window_events_) / nbr_critical_events_ : 0)<<std::endl;
+  std::cout<<"  lookahead violations: "<<nbr_violations_<<std::endl;
+  std::cout<<"  events out of their LP order: "<<nbr_stragglers_<<std::endl;
+  if (check_){
+    std::cout<<"  lookahead check: "<<((nbr_violations_ || nbr_stragglers_) ? "FAILED" : "passed")<<std::endl;
+    if (trace_checked_){
+      std::cout<<"  events differing from the sequential run: "<<nbr_mismatches_<<std::endl;
+      std::cout<<"  sequential run check: "<<(nbr_mismatches_ ? "FAILED" : "passed")<<std::endl;
+    } else {
+      std::cout<<"  sequential run check: no trace of a sequential run"<<std::endl;
+    }
+  }
+}
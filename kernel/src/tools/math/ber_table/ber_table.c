@@ -0,0 +1,91 @@
+/**
+ *  \file   ber_table.c
+ *  \brief  Interpolated SNR to BER lookup table
+ *  \author agent
+ *  \date   2026
+ **/
+#include <math.h>
+#include <stdlib.h>
+
+#include <kernel/include/tools/math/ber_table/ber_table.h>
+
+
+/* ************************************************** */
+/* ************************************************** */
+#define MANTISSA_BITS 52
+
+static inline uint64_t snr2bits(double snr) {
+  uint64_t bits;
+  memcpy(&bits, &snr, sizeof(bits));
+  return bits;
+}
+
+static inline double bits2snr(uint64_t bits) {
+  double snr;
+  memcpy(&snr, &bits, sizeof(snr));
+  return snr;
+}
+
+
+/* ************************************************** */
+/* ************************************************** */
+int ber_table_build(ber_table_t *table, double min_dB, double max_dB, double resolution_dB, ber_function_t function, void *data) {
+  double   min = pow(10, min_dB / 10);
+  double   max = pow(10, max_dB / 10);
+  int      bits = 0;
+  uint64_t last;
+  int      i;
+
+  memset(table, 0, sizeof(ber_table_t));
+  if (!(resolution_dB > 0) || !(min_dB < max_dB) || !(min > 0) || isinf(max)) {
+    return -1;
+  }
+
+  /* an octave of cells of 2^-bits relative width spans at most 10/ln(10) * 2^-bits dB */
+  while (bits < MANTISSA_BITS && 10 / log(10) * ldexp(1, -bits) > resolution_dB) {
+    bits++;
+  }
+
+  table->shift = MANTISSA_BITS - bits;
+  table->mask = (((uint64_t) 1) << table->shift) - 1;
+  table->scale = ldexp(1, -table->shift);
+
+  /* the first point is at or below min, the last one at or above max */
+  table->first = snr2bits(min) >> table->shift;
+  last = snr2bits(max) >> table->shift;
+  if (snr2bits(max) & table->mask) {
+    last++;
+  }
+  if (last - table->first + 1 > BER_TABLE_MAX_SIZE) {
+    memset(table, 0, sizeof(ber_table_t));
+    return -1;
+  }
+
+  table->size = (int) (last - table->first + 1);
+  if ((table->ber = (double *) malloc(sizeof(double) * table->size)) == NULL) {
+    memset(table, 0, sizeof(ber_table_t));
+    return -1;
+  }
+
+  for (i = 0; i < table->size; i++) {
+    table->ber[i] = function(data, bits2snr((table->first + i) << table->shift));
+  }
+  table->min = bits2snr(table->first << table->shift);
+  table->max = bits2snr(last << table->shift);
+
+  /* error at the middle of the cells */
+  for (i = 0; i + 1 < table->size; i++) {
+    double middle = (bits2snr((table->first + i) << table->shift) + bits2snr((table->first + i + 1) << table->shift)) / 2;
+    double error = fabs(function(data, middle) - (table->ber[i] + table->ber[i + 1]) / 2);
+    if (error > table->error) {
+      table->error = error;
+    }
+  }
+
+  return 0;
+}
+
+void ber_table_destroy(ber_table_t *table) {
+  free(table->ber);
+  memset(table, 0, sizeof(ber_table_t));
+}
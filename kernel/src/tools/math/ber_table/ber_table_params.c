@@ -0,0 +1,71 @@
+/**
+ *  \file   ber_table_params.c
+ *  \brief  Interpolated SNR to BER lookup table, built from the modulation parameters
+ *  \author agent
+ *  \date   2026
+ **/
+#include <stdio.h>
+
+#include <kernel/include/log.h>
+#include <kernel/include/definitions/types.h>
+#include <kernel/include/data_structures/list/list.h>
+#include <kernel/include/configuration_parser/param.h>
+#include <kernel/include/tools/math/ber_table/ber_table.h>
+
+
+/* ************************************************** */
+/* ************************************************** */
+int ber_table_from_params(ber_table_t *table, void *params, const char *name, ber_function_t function, void *data) {
+  param_t *param;
+  int tabulate = 0;
+  double min_dB = BER_TABLE_MIN_DB;
+  double max_dB = BER_TABLE_MAX_DB;
+  double resolution_dB = BER_TABLE_RESOLUTION_DB;
+
+  memset(table, 0, sizeof(ber_table_t));
+
+  /* get parameters, the ber is exact by default */
+  if (params) {
+    list_init_traverse(params);
+    while ((param = (param_t *) list_traverse(params)) != NULL) {
+      if (!strcmp(param->key, "ber")) {
+        if (!strcmp(param->value, "exact")) {
+          tabulate = 0;
+        } else if (!strcmp(param->value, "table")) {
+          tabulate = 1;
+        } else {
+          fprintf(stderr, "[%s] Unknown ber mode (%s), possible modes are: exact and table\n", name, param->value);
+          return -1;
+        }
+      }
+      if (!strcmp(param->key, "ber-table-min")) {
+        if (get_param_double(param->value, &min_dB)) {
+          return -1;
+        }
+      }
+      if (!strcmp(param->key, "ber-table-max")) {
+        if (get_param_double(param->value, &max_dB)) {
+          return -1;
+        }
+      }
+      if (!strcmp(param->key, "ber-table-resolution")) {
+        if (get_param_double(param->value, &resolution_dB)) {
+          return -1;
+        }
+      }
+    }
+  }
+
+  if (!tabulate) {
+    return 0;
+  }
+
+  /* tabulate the ber over the snr range */
+  if (ber_table_build(table, min_dB, max_dB, resolution_dB, function, data)) {
+    fprintf(stderr, "[%s] Unable to tabulate the ber over [%lf, %lf] dB with a %lf dB resolution\n", name, min_dB, max_dB, resolution_dB);
+    return -1;
+  }
+  PRINT_MODULATIONS("model %s: ber table of %d points, measured error %e\n", name, table->size, table->error);
+
+  return 0;
+}
@@ -0,0 +1,273 @@
+/**
+ *  \file   profiler.c
+ *  \brief  Simulation profiling counters
+ *  \author agent
+ *  \date   2026
+ **/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <inttypes.h>
+
+#include <kernel/include/definitions/class.h>
+#include <kernel/include/data_structures/mem_fs/mem_fs.h>
+#include <kernel/include/tools/profiler/profiler.h>
+
+
+/* ************************************************** */
+/* ************************************************** */
+typedef struct _profiler_counter {
+  uint64_t count; /* events executed or methods called */
+  uint64_t time;  /* wall time, in ns */
+} profiler_counter_t;
+
+/* counters indexed by class id, PROFILER_KERNEL included */
+typedef struct _profiler_counter_array {
+  int                 size;
+  profiler_counter_t *elts;
+} profiler_counter_array_t;
+
+typedef struct _profiler_event {
+  const char              *name;    /* NULL if no event of this type was executed */
+  profiler_counter_t       counter;
+  profiler_counter_array_t classes; /* the callbacks, per class */
+} profiler_event_t;
+
+
+/* ************************************************** */
+/* ************************************************** */
+int profiler_enabled = 0;
+
+static const char *profiler_path = NULL;
+
+static profiler_event_t         profiler_events[PROFILER_MAX_EVENT_TYPES];
+static profiler_counter_array_t profiler_classes = {0, NULL};
+static int                      profiler_queue_peak = 0;
+static uint64_t                 profiler_events_executed = 0;
+static uint64_t                 profiler_started = 0;
+
+/* classes of the methods being called, the last one is charged */
+static int      profiler_stack[PROFILER_MAX_DEPTH];
+static int      profiler_depth = 0;
+static uint64_t profiler_mark = 0;
+
+
+/* ************************************************** */
+/* ************************************************** */
+static profiler_counter_t *profiler_counter(profiler_counter_array_t *array, int classid) {
+  int index = classid - PROFILER_KERNEL;
+
+  if (index >= array->size) {
+    int                 size = (index + 1 > 2 * array->size) ? index + 1 : 2 * array->size;
+    profiler_counter_t *elts = (profiler_counter_t *) realloc(array->elts, sizeof(profiler_counter_t) * size);
+    if (elts == NULL) {
+      return NULL;
+    }
+    memset(elts + array->size, 0, sizeof(profiler_counter_t) * (size - array->size));
+    array->elts = elts;
+    array->size = size;
+  }
+
+  return array->elts + index;
+}
+
+/* charge the time since the last mark to the running class */
+static void profiler_charge(uint64_t now) {
+  int                 depth   = (profiler_depth < PROFILER_MAX_DEPTH) ? profiler_depth : PROFILER_MAX_DEPTH;
+  int                 classid = depth ? profiler_stack[depth - 1] : PROFILER_KERNEL;
+  profiler_counter_t *counter = profiler_counter(&profiler_classes, classid);
+
+  if (counter) {
+    counter->time += now - profiler_mark;
+  }
+  profiler_mark = now;
+}
+
+
+/* ************************************************** */
+/* ************************************************** */
+void profiler_set_output(const char *path) {
+  profiler_path    = path;
+  profiler_enabled = 1;
+}
+
+void profiler_start(void) {
+  profiler_started = profiler_mark = profiler_clock();
+}
+
+uint64_t profiler_clock(void) {
+  struct timespec now;
+
+  clock_gettime(CLOCK_MONOTONIC, &now);
+  return ((uint64_t) now.tv_sec) * 1000000000 + (uint64_t) now.tv_nsec;
+}
+
+void profiler_clean(void) {
+  int i;
+
+  for (i = 0; i < PROFILER_MAX_EVENT_TYPES; i++) {
+    free(profiler_events[i].classes.elts);
+  }
+  memset(profiler_events, 0, sizeof(profiler_events));
+  free(profiler_classes.elts);
+  profiler_classes.elts = NULL;
+  profiler_classes.size = 0;
+  profiler_enabled = 0;
+}
+
+
+/* ************************************************** */
+/* ************************************************** */
+void profiler_do_enter(int classid) {
+  profiler_counter_t *counter = profiler_counter(&profiler_classes, classid);
+
+  profiler_charge(profiler_clock());
+  if (profiler_depth < PROFILER_MAX_DEPTH) {
+    profiler_stack[profiler_depth] = classid;
+  }
+  profiler_depth++;
+
+  if (counter) {
+    counter->count++;
+  }
+}
+
+void profiler_do_leave(void) {
+  if (profiler_depth == 0) {
+    return;
+  }
+
+  profiler_charge(profiler_clock());
+  profiler_depth--;
+}
+
+void profiler_do_event(int type, const char *name, int classid, uint64_t start) {
+  profiler_event_t   *event;
+  profiler_counter_t *counter;
+  uint64_t            time = profiler_clock() - start;
+
+  if ((type < 0) || (type >= PROFILER_MAX_EVENT_TYPES)) {
+    return;
+  }
+
+  event = profiler_events + type;
+  event->name = name;
+  event->counter.count++;
+  event->counter.time += time;
+  profiler_events_executed++;
+
+  if ((classid != PROFILER_KERNEL) && ((counter = profiler_counter(&event->classes, classid)) != NULL)) {
+    counter->count++;
+    counter->time += time;
+  }
+}
+
+void profiler_do_queue(int size) {
+  if (size > profiler_queue_peak) {
+    profiler_queue_peak = size;
+  }
+}
+
+
+/* ************************************************** */
+/* ************************************************** */
+static void profiler_write_string(FILE *file, const char *string) {
+  fputc('"', file);
+  for (; *string; string++) {
+    if ((*string == '"') || (*string == '\\')) {
+      fputc('\\', file);
+    }
+    if ((unsigned char) *string >= 0x20) {
+      fputc(*string, file);
+    }
+  }
+  fputc('"', file);
+}
+
+static const char *profiler_class_name(int classid) {
+  if (classid == PROFILER_KERNEL) {
+    return "kernel";
+  }
+  return ((classid < classes.size) && classes.elts[classid].name) ? classes.elts[classid].name : "unknown";
+}
+
+/* the classes with a count or a time, as "name": {"<count_key>": n, "time": t} */
+static void profiler_write_classes(FILE *file, profiler_counter_array_t *array, const char *count_key, const char *indent) {
+  int first = 1;
+  int i;
+
+  fprintf(file, "{");
+  for (i = 0; i < array->size; i++) {
+    profiler_counter_t *counter = array->elts + i;
+    if ((counter->count == 0) && (counter->time == 0)) {
+      continue;
+    }
+    fprintf(file, "%s\n%s  ", first ? "" : ",", indent);
+    profiler_write_string(file, profiler_class_name(i + PROFILER_KERNEL));
+    fprintf(file, ": {\"%s\": %" PRIu64 ", \"time\": %" PRIu64 "}", count_key, counter->count, counter->time);
+    first = 0;
+  }
+  fprintf(file, "%s%s}", first ? "" : "\n", first ? "" : indent);
+}
+
+int profiler_write(uint64_t simulated_time) {
+  mem_fs_stats_t mem_fs;
+  FILE          *file;
+  int            first = 1;
+  int            i;
+
+  if (!profiler_enabled) {
+    return 0;
+  }
+
+  /* the time left is the kernel one */
+  profiler_charge(profiler_clock());
+
+  if (!strcmp(profiler_path, "-")) {
+    file = stdout;
+  } else if ((file = fopen(profiler_path, "w")) == NULL) {
+    fprintf(stderr, "profiler: unable to open %s\n", profiler_path);
+    return -1;
+  }
+
+  fprintf(file, "{\n");
+  fprintf(file, "  \"simulated_time\": %" PRIu64 ",\n", simulated_time);
+  fprintf(file, "  \"wall_time\": %" PRIu64 ",\n", profiler_mark - profiler_started);
+  fprintf(file, "  \"events_executed\": %" PRIu64 ",\n", profiler_events_executed);
+  fprintf(file, "  \"queue_peak\": %d,\n", profiler_queue_peak);
+
+  fprintf(file, "  \"events\": {");
+  for (i = 0; i < PROFILER_MAX_EVENT_TYPES; i++) {
+    profiler_event_t *event = profiler_events + i;
+    if (event->name == NULL) {
+      continue;
+    }
+    fprintf(file, "%s\n    ", first ? "" : ",");
+    profiler_write_string(file, event->name);
+    fprintf(file, ": {\"count\": %" PRIu64 ", \"time\": %" PRIu64, event->counter.count, event->counter.time);
+    if (event->classes.size) {
+      fprintf(file, ", \"classes\": ");
+      profiler_write_classes(file, &event->classes, "count", "      ");
+    }
+    fprintf(file, "}");
+    first = 0;
+  }
+  fprintf(file, "%s},\n", first ? "" : "\n  ");
+
+  fprintf(file, "  \"classes\": ");
+  profiler_write_classes(file, &profiler_classes, "calls", "  ");
+  fprintf(file, ",\n");
+
+  mem_fs_get_stats(&mem_fs);
+  fprintf(file, "  \"mem_fs\": {\"slices\": %" PRIu64 ", \"pages\": %" PRIu64 ", \"bytes\": %" PRIu64
+          ", \"allocs\": %" PRIu64 ", \"deallocs\": %" PRIu64 "}\n",
+          mem_fs.slices, mem_fs.pages, mem_fs.bytes, mem_fs.allocs, mem_fs.deallocs);
+  fprintf(file, "}\n");
+
+  if (file != stdout) {
+    return fclose(file) ? -1 : 0;
+  }
+  fflush(file);
+  return 0;
+}
@@ -0,0 +1,203 @@
+/**
+ *  \file   ber_table_unit_test.cc
+ *  \brief  BER Table Unit Tests
+ *  \author agent
+ *  \date   2026
+ **/
+
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include <kernel/include/tools/math/ber_table/ber_table.h>
+#include <kernel/include/tools/math/ber_table/ber_vector.h>
+
+// bpsk ber
+static double Bpsk(void *data, double snr){
+  (void) data;
+  return 0.5 * std::erfc(std::sqrt(snr));
+}
+
+// ieee 802.15.4 oqpsk ber
+static double Oqpsk(void *data, double snr){
+  static const double coefficients[] = {120, -560, 1820, -4368, 8008, -11440, 12870, -11440, 8008, -4368, 1820, -560, 120, -16, 1};
+  double ber = 0;
+  (void) data;
+  for (int k = 2; k <= 16; k++){
+    ber += coefficients[k - 2] * std::exp(20.0 * snr * (1.0 / k - 1));
+  }
+  return 8.0 / 15 / 16 * ber;
+}
+
+// fixture
+class BerTableTest : public ::testing::Test {
+protected:
+  virtual void TearDown() {
+    ber_table_destroy(&table_);
+  }
+
+  // maximum error over a fine grid of the range, in dB
+  double MaxError(ber_function_t function, double min_dB, double max_dB){
+    double error = 0;
+    for (double dB = min_dB; dB < max_dB; dB += 0.001){
+      double ber;
+      double snr = std::pow(10, dB / 10);
+      if (ber_table_lookup(&table_, snr, &ber) == 0){
+        error = std::max(error, std::fabs(ber - function(nullptr, snr)));
+      }
+    }
+    return error;
+  }
+
+  ber_table_t table_ = {};
+};
+
+TEST_F(BerTableTest, Empty){
+  double ber = 0;
+  EXPECT_EQ(-1, ber_table_lookup(&table_, 1, &ber));
+  EXPECT_EQ(-1, ber_table_build(&table_, 10, 0, BER_TABLE_RESOLUTION_DB, Bpsk, nullptr));
+  EXPECT_EQ(-1, ber_table_lookup(&table_, 1, &ber));
+  EXPECT_EQ(-1, ber_table_build(&table_, 0, 10, 0, Bpsk, nullptr));
+  EXPECT_EQ(-1, ber_table_lookup(&table_, 1, &ber));
+}
+
+TEST_F(BerTableTest, Range){
+  double ber = 0;
+  ASSERT_EQ(0, ber_table_build(&table_, -10, 30, BER_TABLE_RESOLUTION_DB, Bpsk, nullptr));
+
+  // the range covers [-10, 30] dB
+  EXPECT_LE(table_.min, 0.1);
+  EXPECT_GE(table_.max, 1000);
+  EXPECT_EQ(0, ber_table_lookup(&table_, 0.1, &ber));
+  EXPECT_EQ(0, ber_table_lookup(&table_, 999.99, &ber));
+  EXPECT_EQ(-1, ber_table_lookup(&table_, 1e-3, &ber));
+  EXPECT_EQ(-1, ber_table_lookup(&table_, 1e6, &ber));
+  EXPECT_EQ(-1, ber_table_lookup(&table_, DBL_MAX, &ber));
+
+  // exact on the points
+  EXPECT_EQ(0, ber_table_lookup(&table_, 1, &ber));
+  EXPECT_DOUBLE_EQ(Bpsk(nullptr, 1), ber);
+  EXPECT_EQ(0, ber_table_lookup(&table_, 2, &ber));
+  EXPECT_DOUBLE_EQ(Bpsk(nullptr, 2), ber);
+}
+
+TEST_F(BerTableTest, ErrorBound){
+  // 2^-2k / 16, k = 7 at the default resolution
+  double bound = std::ldexp(1, -14) / 16;
+
+  ASSERT_EQ(0, ber_table_build(&table_, BER_TABLE_MIN_DB, BER_TABLE_MAX_DB, BER_TABLE_RESOLUTION_DB, Bpsk, nullptr));
+  EXPECT_LT(table_.error, bound);
+  EXPECT_LT(MaxError(Bpsk, BER_TABLE_MIN_DB, BER_TABLE_MAX_DB), bound);
+  ber_table_destroy(&table_);
+
+  ASSERT_EQ(0, ber_table_build(&table_, BER_TABLE_MIN_DB, BER_TABLE_MAX_DB, BER_TABLE_RESOLUTION_DB, Oqpsk, nullptr));
+  EXPECT_LT(table_.error, bound);
+  EXPECT_LT(MaxError(Oqpsk, BER_TABLE_MIN_DB, BER_TABLE_MAX_DB), bound);
+}
+
+TEST_F(BerTableTest, Resolution){
+  // a finer resolution means a larger and more precise table
+  ASSERT_EQ(0, ber_table_build(&table_, 0, 10, 0.1, Bpsk, nullptr));
+  int size = table_.size;
+  double error = table_.error;
+  ber_table_destroy(&table_);
+
+  ASSERT_EQ(0, ber_table_build(&table_, 0, 10, 0.01, Bpsk, nullptr));
+  EXPECT_GT(table_.size, 4 * size);
+  EXPECT_LT(table_.error, error / 16);
+}
+
+TEST_F(BerTableTest, LookupBatch){
+  double snr[] = {1e-3, 0.1, 1, 2.5, 999.99, 1e6, DBL_MAX, NAN};
+  int n = sizeof(snr) / sizeof(snr[0]);
+  double ber[sizeof(snr) / sizeof(snr[0])];
+  int outside[sizeof(snr) / sizeof(snr[0])];
+
+  // an empty table covers nothing
+  EXPECT_EQ(n, ber_table_lookup_batch(&table_, snr, ber, outside, n));
+
+  // the batch gives the same ber as the lookups in the range, and lists the others
+  ASSERT_EQ(0, ber_table_build(&table_, -10, 30, BER_TABLE_RESOLUTION_DB, Bpsk, nullptr));
+  int count = ber_table_lookup_batch(&table_, snr, ber, outside, n);
+  ASSERT_EQ(4, count);
+  EXPECT_EQ(0, outside[0]);
+  EXPECT_EQ(5, outside[1]);
+  EXPECT_EQ(6, outside[2]);
+  EXPECT_EQ(7, outside[3]);
+  for (int i = 0; i < n; i++){
+    double expected;
+    EXPECT_EQ(ber_table_lookup(&table_, snr[i], &expected) == 0, ber_table_contains(&table_, snr[i]) != 0);
+    if (ber_table_contains(&table_, snr[i])){
+      EXPECT_EQ(expected, ber[i]);
+    }
+  }
+}
+
+// bpsk ber of the modulation model, the snr of the noiseless slices being DBL_MAX
+static double BpskModel(void *data, double snr){
+  return (snr == DBL_MAX) ? 0 : Bpsk(data, snr);
+}
+
+TEST_F(BerTableTest, EvaluateBatchInPlace){
+  // the snr are converted in place, as done by do_modulate_batch(), over several batches
+  std::vector<double> snr;
+  for (int i = 0; i < 3 * BER_TABLE_BATCH + 5; i++){
+    static const double values[] = {DBL_MAX, 10, 1e-3, 2.5, 1e6, 0.5, 100};
+    snr.push_back(values[i % (sizeof(values) / sizeof(values[0]))]);
+  }
+  std::vector<double> ber = snr;
+
+  ASSERT_EQ(0, ber_table_build(&table_, -10, 30, BER_TABLE_RESOLUTION_DB, Bpsk, nullptr));
+  ber_table_evaluate_batch(&table_, ber.data(), ber.data(), ber.size(), BpskModel, nullptr);
+  for (size_t i = 0; i < snr.size(); i++){
+    double expected;
+    if (ber_table_lookup(&table_, snr[i], &expected)){
+      expected = BpskModel(nullptr, snr[i]);
+    }
+    EXPECT_EQ(expected, ber[i]) << "snr " << snr[i];
+    EXPECT_NEAR(BpskModel(nullptr, snr[i]), ber[i], table_.error);
+  }
+
+  // an empty table takes the function for every snr
+  ber_table_destroy(&table_);
+  ber = snr;
+  ber_table_evaluate_batch(&table_, ber.data(), ber.data(), ber.size(), BpskModel, nullptr);
+  for (size_t i = 0; i < snr.size(); i++){
+    EXPECT_EQ(BpskModel(nullptr, snr[i]), ber[i]);
+  }
+}
+
+TEST(BerVectorTest, Accuracy){
+  double exp_error = 0, sqrt_error = 0, erfc_error = 0;
+
+  for (double x = 0; x < BER_VECTOR_EXP_MIN; x += 0.01){
+    exp_error = std::max(exp_error, std::fabs(ber_vector_exp_negative(x) / std::exp(-x) - 1));
+  }
+  for (double x = 1e-300; x < 1e300; x *= 1.01){
+    sqrt_error = std::max(sqrt_error, std::fabs(ber_vector_sqrt(x) / std::sqrt(x) - 1));
+  }
+  for (double y = 1e-12; y < BER_VECTOR_ERFC_MAX; y *= 1.0001){
+    erfc_error = std::max(erfc_error, std::fabs(ber_vector_erfc_sqrt(y) / std::erfc(std::sqrt(y)) - 1));
+  }
+  EXPECT_LT(exp_error, 1e-15);
+  EXPECT_LT(sqrt_error, 1e-15);
+  EXPECT_LT(erfc_error, 1e-12);
+}
+
+TEST(BerVectorTest, Limits){
+  EXPECT_EQ(1, ber_vector_exp_negative(0));
+  EXPECT_EQ(0, ber_vector_exp_negative(BER_VECTOR_EXP_MIN + 1));
+  EXPECT_EQ(0, ber_vector_exp_negative(INFINITY));
+  EXPECT_EQ(0, ber_vector_sqrt(0));
+  EXPECT_EQ(0, ber_vector_sqrt(-1));
+  EXPECT_EQ(1, ber_vector_erfc_sqrt(0));
+  EXPECT_EQ(1, ber_vector_erfc_sqrt(-1));
+
+  // the noiseless slices, of snr DBL_MAX, have no errors
+  EXPECT_EQ(0, ber_vector_erfc_sqrt(BER_VECTOR_ERFC_MAX + 1));
+  EXPECT_EQ(0, ber_vector_erfc_sqrt(DBL_MAX));
+  EXPECT_EQ(0, ber_vector_erfc_sqrt(INFINITY));
+}
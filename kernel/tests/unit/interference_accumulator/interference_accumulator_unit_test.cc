@@ -0,0 +1,185 @@
+/**
+ *  \file   interference_accumulator_unit_test.cc
+ *  \brief  Interference Accumulator Unit Tests
+ *  \author agent
+ *  \date   2026
+ **/
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include <kernel/include/data_structures/interference_accumulator/interference_accumulator.h>
+
+// fixture
+class InterferenceAccumulatorTest : public ::testing::Test {
+protected:
+  struct Signal {
+    uint64_t begin;
+    uint64_t end;
+    double power[INTERFERENCE_CHANNELS];
+  };
+
+  virtual void SetUp() {
+    static int initialized = interference_accumulator_init();
+    ASSERT_EQ(0, initialized);
+    interference_accumulator_setup(&accumulator_);
+  }
+
+  virtual void TearDown() {
+    interference_accumulator_clear(&accumulator_);
+    EXPECT_EQ(0, interference_accumulator_size(&accumulator_));
+  }
+
+  void Add(uint64_t begin, uint64_t end, double power){
+    Signal signal = {begin, end, {0}};
+    for (int i = 0; i < INTERFERENCE_CHANNELS; i++){
+      signal.power[i] = power * (i + 1);
+    }
+    signals_.push_back(signal);
+    interference_accumulator_add(&accumulator_, begin, end, signal.power);
+  }
+
+  // exhaustive power at a time
+  double PowerExhaustive(const std::vector<Signal> &signals, int channel, uint64_t time){
+    double power = 0;
+    for (auto &signal : signals){
+      if (signal.begin <= time && time < signal.end){
+        power += signal.power[channel];
+      }
+    }
+    return power;
+  }
+
+  // exhaustive maximum and average, from the power between the signals bounds
+  void FindExhaustive(int channel, uint64_t t0, uint64_t t1, double &max, double &average){
+    std::vector<uint64_t> bounds = {t0, t1};
+    std::vector<Signal> signals;
+    for (auto &signal : signals_){
+      if (signal.begin < t1 && signal.end > t0){
+        signals.push_back(signal);
+        bounds.push_back(std::max(signal.begin, t0));
+        bounds.push_back(std::min(signal.end, t1));
+      }
+    }
+    std::sort(bounds.begin(), bounds.end());
+    bounds.erase(std::unique(bounds.begin(), bounds.end()), bounds.end());
+
+    double energy = 0;
+    max = 0;
+    for (size_t i = 0; i + 1 < bounds.size(); i++){
+      double power = PowerExhaustive(signals, channel, bounds[i]);
+      max = std::max(max, power);
+      energy += power * (bounds[i+1] - bounds[i]);
+    }
+    average = energy / (t1 - t0);
+  }
+
+  interference_accumulator_t accumulator_;
+  std::vector<Signal> signals_;
+};
+
+TEST_F(InterferenceAccumulatorTest, Empty){
+  EXPECT_EQ(0, interference_accumulator_size(&accumulator_));
+  EXPECT_DOUBLE_EQ(0, interference_accumulator_max(&accumulator_, 0, 0, 100));
+  EXPECT_DOUBLE_EQ(0, interference_accumulator_average(&accumulator_, 0, 0, 100));
+  EXPECT_DOUBLE_EQ(0, interference_accumulator_value(&accumulator_, 0, 0));
+}
+
+TEST_F(InterferenceAccumulatorTest, Overlap){
+  Add(0, 100, 1);
+  Add(50, 150, 2);
+  Add(200, 300, 4);
+
+  // [0,50) 1, [50,100) 3, [100,150) 2, [150,200) 0, [200,300) 4
+  EXPECT_EQ(5, interference_accumulator_size(&accumulator_));
+  EXPECT_DOUBLE_EQ(1, interference_accumulator_max(&accumulator_, 0, 0, 50));
+  EXPECT_DOUBLE_EQ(3, interference_accumulator_max(&accumulator_, 0, 0, 51));
+  EXPECT_DOUBLE_EQ(3, interference_accumulator_max(&accumulator_, 0, 75, 80));
+  EXPECT_DOUBLE_EQ(2, interference_accumulator_max(&accumulator_, 0, 100, 200));
+  EXPECT_DOUBLE_EQ(0, interference_accumulator_max(&accumulator_, 0, 150, 200));
+  EXPECT_DOUBLE_EQ(4, interference_accumulator_max(&accumulator_, 1, 100, 150));
+  EXPECT_DOUBLE_EQ(2, interference_accumulator_average(&accumulator_, 0, 0, 100));
+  EXPECT_DOUBLE_EQ(2.25, interference_accumulator_average(&accumulator_, 0, 50, 250));
+  EXPECT_DOUBLE_EQ(1, interference_accumulator_average(&accumulator_, 0, 100, 200));
+
+  EXPECT_DOUBLE_EQ(1, interference_accumulator_value(&accumulator_, 0, 0));
+  EXPECT_DOUBLE_EQ(3, interference_accumulator_value(&accumulator_, 0, 50));
+  EXPECT_DOUBLE_EQ(0, interference_accumulator_value(&accumulator_, 0, 175));
+  EXPECT_DOUBLE_EQ(4, interference_accumulator_value(&accumulator_, 0, 299));
+  EXPECT_DOUBLE_EQ(0, interference_accumulator_value(&accumulator_, 0, 300));
+}
+
+TEST_F(InterferenceAccumulatorTest, Release){
+  Add(0, 100, 1);
+  Add(50, 150, 2);
+
+  // the second signal is still active after 50: only [0, 50) is freed
+  interference_accumulator_release(&accumulator_, 0, 100);
+  EXPECT_EQ(2, interference_accumulator_size(&accumulator_));
+  EXPECT_DOUBLE_EQ(3, interference_accumulator_max(&accumulator_, 0, 50, 150));
+
+  // no signal active at 150: everything is freed
+  interference_accumulator_release(&accumulator_, 50, 150);
+  EXPECT_EQ(0, interference_accumulator_size(&accumulator_));
+
+  Add(200, 300, 4);
+  EXPECT_EQ(1, interference_accumulator_size(&accumulator_));
+  EXPECT_DOUBLE_EQ(4, interference_accumulator_max(&accumulator_, 0, 200, 300));
+}
+
+TEST_F(InterferenceAccumulatorTest, RandomAgainstExhaustive){
+  std::mt19937 generator(1234);
+  std::uniform_int_distribution<uint64_t> gap(0, 300);
+  std::uniform_int_distribution<uint64_t> duration(1, 2000);
+  std::uniform_real_distribution<double> power(0, 1);
+  std::vector<Signal> pending;
+  uint64_t now = 0;
+  size_t max_size = 0;
+
+  auto release = [&](const Signal &signal){
+    int channel = signal.end % INTERFERENCE_CHANNELS;
+    double max, average;
+
+    // whole signal and a frame inside
+    FindExhaustive(channel, signal.begin, signal.end, max, average);
+    EXPECT_NEAR(max, interference_accumulator_max(&accumulator_, channel, signal.begin, signal.end), 1e-9);
+    EXPECT_NEAR(average, interference_accumulator_average(&accumulator_, channel, signal.begin, signal.end), 1e-9);
+
+    uint64_t middle = (signal.begin + signal.end) / 2;
+    FindExhaustive(channel, middle, signal.end, max, average);
+    EXPECT_NEAR(max, interference_accumulator_max(&accumulator_, channel, middle, signal.end), 1e-9);
+    EXPECT_NEAR(average, interference_accumulator_average(&accumulator_, channel, middle, signal.end), 1e-9);
+
+    interference_accumulator_release(&accumulator_, signal.begin, signal.end);
+  };
+
+  for (int i = 0; i < 5000; i++){
+    now += gap(generator);
+
+    // release the signals ending before now, by end order
+    std::sort(pending.begin(), pending.end(), [](const Signal &a, const Signal &b){ return a.end < b.end; });
+    while (!pending.empty() && pending.front().end <= now){
+      release(pending.front());
+      pending.erase(pending.begin());
+    }
+
+    Add(now, now + duration(generator), power(generator));
+    pending.push_back(signals_.back());
+    max_size = std::max(max_size, (size_t) interference_accumulator_size(&accumulator_));
+
+    EXPECT_NEAR(PowerExhaustive(signals_, i % INTERFERENCE_CHANNELS, now),
+                interference_accumulator_value(&accumulator_, i % INTERFERENCE_CHANNELS, now), 1e-9);
+  }
+
+  std::sort(pending.begin(), pending.end(), [](const Signal &a, const Signal &b){ return a.end < b.end; });
+  for (auto &signal : pending){
+    release(signal);
+  }
+
+  // expired segments are freed along the way
+  EXPECT_EQ(0, interference_accumulator_size(&accumulator_));
+  EXPECT_LT(max_size, (size_t) 100);
+}
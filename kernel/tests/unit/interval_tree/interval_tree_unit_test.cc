@@ -0,0 +1,185 @@
+/**
+ *  \file   interval_tree_unit_test.cc
+ *  \brief  IntervalTree Unit Tests
+ *  \author agent
+ *  \date   2026
+ **/
+
+#include <algorithm>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include <kernel/include/definitions/types/interval/frequency_interval.h>
+#include <kernel/include/data_structures/interval_tree/redblack_interval_tree.h>
+#include <kernel/include/data_structures/interval_tree/flat_interval_tree.h>
+#include <kernel/include/data_structures/interval_tree/typed_interval_tree.h>
+
+// Every test is run against each interval tree implementation
+static std::unique_ptr<IntervalTree> CreateIntervalTree(const std::string &type){
+  if (type == "flat") {
+    return std::make_unique<FlatIntervalTree>();
+  }
+  return std::make_unique<RedBlackIntervalTree>();
+}
+
+// fixture
+class IntervalTreeTest : public ::testing::TestWithParam<std::string> {
+protected:
+  virtual void SetUp() {
+    interval_tree_ = CreateIntervalTree(GetParam());
+    std::mt19937 generator(1234);
+    std::uniform_real_distribution<double> low(0, 1000);
+    std::uniform_real_distribution<double> width(0, 20);
+
+    for (int i = 0; i < 1000; i++){
+      double point = low(generator);
+      intervals_.push_back(std::make_shared<FrequencyInterval>(point, point + width(generator)));
+      interval_tree_->Insert(intervals_.back());
+    }
+  }
+
+  // exhaustive search, by increasing uid
+  std::vector<IntervalUid> FindAllIntersectionsExhaustive(IntervalBoundary low, IntervalBoundary high){
+    std::vector<IntervalUid> uids;
+    for (auto &interval : intervals_){
+      if ((interval->GetLowPoint() <= high) && (low <= interval->GetHighPoint())){
+        uids.push_back(interval->GetUID());
+      }
+    }
+    std::sort(uids.begin(), uids.end());
+    return uids;
+  }
+
+  static std::vector<IntervalUid> SortedUids(const std::vector<std::weak_ptr<Interval>> &intervals){
+    std::vector<IntervalUid> uids;
+    for (auto &interval : intervals){
+      uids.push_back(interval.lock()->GetUID());
+    }
+    std::sort(uids.begin(), uids.end());
+    return uids;
+  }
+
+  std::unique_ptr<IntervalTree> interval_tree_;
+  SetOfFrequencyIntervals intervals_;
+};
+
+TEST_P(IntervalTreeTest, Insert){
+  EXPECT_EQ(interval_tree_->GetSize(), 1000u);
+}
+
+TEST_P(IntervalTreeTest, FindAllIntersections){
+  for (double low = -10; low < 1010; low += 37){
+    for (double width : {0.0, 5.0, 100.0}){
+      auto query = std::make_shared<FrequencyInterval>(low, low + width);
+      auto found = interval_tree_->FindAllIntersections(query);
+      std::vector<IntervalUid> uids;
+      for (auto &interval : found){
+        uids.push_back(interval.lock()->GetUID());
+      }
+      std::sort(uids.begin(), uids.end());
+      EXPECT_EQ(uids, FindAllIntersectionsExhaustive(low, low + width));
+    }
+  }
+}
+
+TEST_P(IntervalTreeTest, FindAllIntersectionsVector){
+  std::vector<std::weak_ptr<Interval>> found;
+
+  for (double low = -10; low < 1010; low += 37){
+    found.clear();
+    interval_tree_->FindAllIntersections(low, low + 10, found);
+    EXPECT_EQ(SortedUids(found), FindAllIntersectionsExhaustive(low, low + 10));
+  }
+}
+
+TEST_P(IntervalTreeTest, ForEachIntersectionSameOrder){
+  // the visitors walk the tree in the same order as the list query
+  for (double low = -10; low < 1010; low += 37){
+    auto query = std::make_shared<FrequencyInterval>(low, low + 30);
+    auto expected = interval_tree_->FindAllIntersections(query);
+    std::vector<IntervalUid> uids;
+
+    interval_tree_->ForEachIntersection(low, low + 30, [&uids](const std::weak_ptr<Interval> &interval){
+      uids.push_back(interval.lock()->GetUID());
+    });
+
+    ASSERT_EQ(uids.size(), expected.size());
+    auto uid = uids.begin();
+    for (auto &interval : expected){
+      EXPECT_EQ(*uid++, interval.lock()->GetUID());
+    }
+  }
+}
+
+TEST_P(IntervalTreeTest, Delete){
+  for (size_t i = 0; i < intervals_.size(); i += 2){
+    interval_tree_->Delete(intervals_[i]);
+  }
+  EXPECT_EQ(interval_tree_->GetSize(), 500u);
+
+  // a deleted interval is not found anymore, even if another one has the same bounds
+  auto twin = std::make_shared<FrequencyInterval>(intervals_[1]->GetLowPoint(), intervals_[1]->GetHighPoint());
+  interval_tree_->Insert(twin);
+  interval_tree_->Delete(twin);
+
+  SetOfFrequencyIntervals remaining;
+  for (size_t i = 1; i < intervals_.size(); i += 2){
+    remaining.push_back(intervals_[i]);
+  }
+  intervals_ = remaining;
+
+  std::vector<std::weak_ptr<Interval>> found;
+  for (double low = -10; low < 1010; low += 37){
+    found.clear();
+    interval_tree_->FindAllIntersections(low, low + 10, found);
+    EXPECT_EQ(SortedUids(found), FindAllIntersectionsExhaustive(low, low + 10));
+  }
+  if (GetParam() == "redblack") {
+    static_cast<RedBlackIntervalTree*>(interval_tree_.get())->CheckRedBlackTreeProperties();
+  }
+}
+
+TEST_P(IntervalTreeTest, Empty){
+  std::unique_ptr<IntervalTree> interval_tree = CreateIntervalTree(GetParam());
+  int visited = 0;
+
+  interval_tree->ForEachIntersection(0, 1000, [&visited](const std::weak_ptr<Interval> &){ visited++; });
+  EXPECT_EQ(visited, 0);
+}
+
+TEST_P(IntervalTreeTest, DeleteAll){
+  for (auto &interval : intervals_){
+    interval_tree_->Delete(interval);
+  }
+  EXPECT_EQ(interval_tree_->GetSize(), 0u);
+
+  std::vector<std::weak_ptr<Interval>> found;
+  interval_tree_->FindAllIntersections(0, 2000, found);
+  EXPECT_TRUE(found.empty());
+}
+
+TEST_P(IntervalTreeTest, TypedForEachIntersection){
+  TypedIntervalTree<FrequencyInterval> typed_tree(CreateIntervalTree(GetParam()));
+  for (auto &interval : intervals_){
+    typed_tree.Insert(interval);
+  }
+  EXPECT_EQ(typed_tree.GetSize(), 1000u);
+
+  for (double low = -10; low < 1010; low += 37){
+    std::vector<IntervalUid> uids;
+    typed_tree.ForEachIntersection(low, low + 5, [&uids](const std::shared_ptr<FrequencyInterval> &interval){
+      uids.push_back(interval->GetUID());
+    });
+    std::sort(uids.begin(), uids.end());
+    EXPECT_EQ(uids, FindAllIntersectionsExhaustive(low, low + 5));
+  }
+
+  typed_tree.Delete(intervals_.front());
+  EXPECT_EQ(typed_tree.GetSize(), 999u);
+}
+
+INSTANTIATE_TEST_CASE_P(IntervalTreeImplementations, IntervalTreeTest, ::testing::Values("redblack", "flat"));
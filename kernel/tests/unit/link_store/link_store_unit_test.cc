@@ -0,0 +1,177 @@
+/**
+ *  \file   link_store_unit_test.cc
+ *  \brief  Link Store Unit Tests
+ *  \author agent
+ *  \date   2026
+ **/
+
+#include <cstdio>
+#include <map>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include <kernel/include/data_structures/link_store/link_store.h>
+
+#define NODE_CNT 200
+#define DEFAULT_VALUE -1000.0
+
+// fixture
+class LinkStoreTest : public ::testing::Test {
+protected:
+  virtual void SetUp() {
+    store_ = link_store_create(NODE_CNT, DEFAULT_VALUE);
+    ASSERT_NE(nullptr, store_);
+    path_ = std::string(::testing::TempDir()) + "link_store_unit_test.bin";
+  }
+
+  virtual void TearDown() {
+    link_store_destroy(store_);
+    std::remove(path_.c_str());
+  }
+
+  // random links, the same link may be set several times
+  void Fill(int links){
+    std::mt19937 generator(1234);
+    std::uniform_int_distribution<int> node(0, NODE_CNT - 1);
+    std::uniform_real_distribution<double> value(-100, 0);
+
+    for (int i = 0; i < links; i++){
+      std::pair<int, int> link(node(generator), node(generator));
+      links_[link] = value(generator);
+      ASSERT_EQ(0, link_store_set(store_, link.first, link.second, links_[link]));
+    }
+  }
+
+  void ExpectLinks(link_store_t *store){
+    EXPECT_EQ(links_.size(), link_store_size(store));
+    for (int src = 0; src < NODE_CNT; src++){
+      for (int dst = 0; dst < NODE_CNT; dst++){
+        auto link = links_.find(std::make_pair(src, dst));
+        EXPECT_DOUBLE_EQ(link == links_.end() ? DEFAULT_VALUE : link->second, link_store_get(store, src, dst));
+      }
+    }
+  }
+
+  link_store_t *store_;
+  std::string path_;
+  std::map<std::pair<int, int>, double> links_;
+};
+
+TEST_F(LinkStoreTest, Empty){
+  ASSERT_EQ(0, link_store_finalize(store_));
+  EXPECT_EQ(0u, link_store_size(store_));
+  EXPECT_DOUBLE_EQ(DEFAULT_VALUE, link_store_get(store_, 0, 0));
+  EXPECT_DOUBLE_EQ(DEFAULT_VALUE, link_store_get(store_, NODE_CNT - 1, NODE_CNT - 1));
+  EXPECT_DOUBLE_EQ(DEFAULT_VALUE, link_store_get(store_, NODE_CNT, 0));
+  EXPECT_DOUBLE_EQ(DEFAULT_VALUE, link_store_get(store_, -1, 0));
+}
+
+TEST_F(LinkStoreTest, SetGet){
+  EXPECT_EQ(-1, link_store_set(store_, NODE_CNT, 0, 1));
+  EXPECT_EQ(-1, link_store_set(store_, 0, -1, 1));
+
+  ASSERT_EQ(0, link_store_set(store_, 3, 7, 1));
+  ASSERT_EQ(0, link_store_set(store_, 7, 3, 2));
+  ASSERT_EQ(0, link_store_set(store_, 3, 7, 3));
+  ASSERT_EQ(0, link_store_finalize(store_));
+
+  // the last value is kept, links are directed
+  EXPECT_EQ(2u, link_store_size(store_));
+  EXPECT_DOUBLE_EQ(3, link_store_get(store_, 3, 7));
+  EXPECT_DOUBLE_EQ(2, link_store_get(store_, 7, 3));
+  EXPECT_DOUBLE_EQ(DEFAULT_VALUE, link_store_get(store_, 3, 3));
+
+  // no link can be set once finalized
+  EXPECT_EQ(-1, link_store_set(store_, 1, 1, 1));
+  EXPECT_EQ(-1, link_store_finalize(store_));
+}
+
+TEST_F(LinkStoreTest, RandomAgainstMap){
+  Fill(5000);
+  ASSERT_EQ(0, link_store_finalize(store_));
+  ExpectLinks(store_);
+}
+
+TEST_F(LinkStoreTest, SaveLoad){
+  EXPECT_EQ(-1, link_store_save(store_, path_.c_str()));
+  Fill(5000);
+  ASSERT_EQ(0, link_store_finalize(store_));
+  ASSERT_EQ(0, link_store_save(store_, path_.c_str()));
+  EXPECT_EQ(1, link_store_is_file(path_.c_str()));
+
+  link_store_t *loaded = link_store_load(path_.c_str());
+  ASSERT_NE(nullptr, loaded);
+  ExpectLinks(loaded);
+  EXPECT_EQ(-1, link_store_set(loaded, 0, 0, 1));
+  link_store_destroy(loaded);
+}
+
+TEST_F(LinkStoreTest, LoadInvalid){
+  EXPECT_EQ(nullptr, link_store_load(path_.c_str()));
+  EXPECT_EQ(0, link_store_is_file(path_.c_str()));
+
+  // a text file is not a store
+  FILE *file = std::fopen(path_.c_str(), "w");
+  ASSERT_NE(nullptr, file);
+  std::fprintf(file, "0 1 0.5\n1 0 0.5\n");
+  std::fclose(file);
+  EXPECT_EQ(0, link_store_is_file(path_.c_str()));
+  EXPECT_EQ(nullptr, link_store_load(path_.c_str()));
+}
+
+TEST_F(LinkStoreTest, LoadCorrupted){
+  Fill(500);
+  ASSERT_EQ(0, link_store_finalize(store_));
+  std::vector<char> block((char *) store_->block, (char *) store_->block + store_->block_size);
+  link_store_header_t *header = (link_store_header_t *) block.data();
+  uint64_t *offsets = (uint64_t *) (header + 1);
+  uint32_t *dsts = (uint32_t *) (offsets + NODE_CNT + 1);
+
+  auto load = [&](const std::vector<char> &data){
+    FILE *file = std::fopen(path_.c_str(), "wb");
+    EXPECT_NE(nullptr, file);
+    std::fwrite(data.data(), 1, data.size(), file);
+    std::fclose(file);
+    link_store_t *loaded = link_store_load(path_.c_str());
+    bool valid = (loaded != nullptr);
+    link_store_destroy(loaded);
+    return valid;
+  };
+
+  ASSERT_TRUE(load(block));
+
+  // counts that would overflow the size of the block
+  std::vector<char> corrupted(block);
+  ((link_store_header_t *) corrupted.data())->link_cnt = UINT64_MAX / 2;
+  EXPECT_FALSE(load(corrupted));
+  corrupted = block;
+  ((link_store_header_t *) corrupted.data())->node_cnt = UINT32_MAX;
+  EXPECT_FALSE(load(corrupted));
+
+  // rows out of the block or not increasing
+  uint64_t offset = offsets[1];
+  offsets[1] = header->link_cnt + 1;
+  EXPECT_FALSE(load(block));
+  offsets[1] = offsets[2] + 1;
+  EXPECT_FALSE(load(block));
+  offsets[1] = offset;
+  offsets[NODE_CNT] = header->link_cnt - 1;
+  EXPECT_FALSE(load(block));
+  offsets[NODE_CNT] = header->link_cnt;
+
+  // destinations out of the nodes or not sorted
+  uint32_t dst = dsts[0];
+  dsts[0] = NODE_CNT;
+  EXPECT_FALSE(load(block));
+  dsts[0] = dst;
+  int src = 0;
+  while (offsets[src + 1] - offsets[src] < 2){
+    src++;
+  }
+  std::swap(dsts[offsets[src]], dsts[offsets[src] + 1]);
+  EXPECT_FALSE(load(block));
+}
@@ -0,0 +1,101 @@
+/**
+ *  \file   range_tree_unit_test.cc
+ *  \brief  RangeTree Unit Tests
+ *  \author agent
+ *  \date   2026
+ **/
+
+#include <algorithm>
+#include <map>
+#include <random>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include <kernel/include/data_structures/range_tree/kd_range_tree.h>
+
+// fixture
+class RangeTreeTest : public ::testing::Test {
+protected:
+  virtual void SetUp() {
+    std::mt19937 generator(1234);
+    std::uniform_real_distribution<double> coordinate(0, 1000);
+
+    for (nodeid_t id = 0; id < 500; id++){
+      position_t position = {coordinate(generator), coordinate(generator), coordinate(generator) / 10};
+      positions_.push_back(position);
+      range_tree_.Insert(id, position);
+    }
+  }
+
+  // exhaustive search, by increasing id
+  std::vector<nodeid_t> FindInRangeExhaustive(const position_t &center, double range){
+    std::vector<nodeid_t> ids;
+    for (size_t id = 0; id < positions_.size(); id++){
+      double dx = positions_[id].x - center.x;
+      double dy = positions_[id].y - center.y;
+      double dz = positions_[id].z - center.z;
+      if ((dx * dx + dy * dy + dz * dz <= range * range) && !deleted_[id]){
+        ids.push_back(id);
+      }
+    }
+    return ids;
+  }
+
+  KdRangeTree range_tree_;
+  std::vector<position_t> positions_;
+  std::map<nodeid_t, bool> deleted_;
+};
+
+TEST_F(RangeTreeTest, Insert){
+  EXPECT_EQ(range_tree_.GetSize(), 500u);
+}
+
+TEST_F(RangeTreeTest, FindInRange){
+  std::vector<nodeid_t> ids;
+
+  for (auto range : {0.0, 50.0, 200.0, 2000.0}){
+    for (size_t i = 0; i < positions_.size(); i += 50){
+      range_tree_.FindInRange(positions_[i], range, ids);
+      EXPECT_EQ(ids, FindInRangeExhaustive(positions_[i], range));
+    }
+  }
+}
+
+TEST_F(RangeTreeTest, Delete){
+  std::vector<nodeid_t> ids;
+
+  for (nodeid_t id = 0; id < 500; id += 3){
+    range_tree_.Delete(id);
+    deleted_[id] = true;
+  }
+  // deleting twice has no effect
+  range_tree_.Delete(0);
+  EXPECT_EQ(range_tree_.GetSize(), 333u);
+
+  range_tree_.FindInRange(positions_[1], 300, ids);
+  EXPECT_EQ(ids, FindInRangeExhaustive(positions_[1], 300));
+
+  // a deleted node may be inserted again
+  range_tree_.Insert(0, positions_[0]);
+  deleted_[0] = false;
+  EXPECT_EQ(range_tree_.GetSize(), 334u);
+  range_tree_.FindInRange(positions_[0], 300, ids);
+  EXPECT_EQ(ids, FindInRangeExhaustive(positions_[0], 300));
+  EXPECT_TRUE(std::binary_search(ids.begin(), ids.end(), 0));
+}
+
+TEST_F(RangeTreeTest, Update){
+  std::vector<nodeid_t> ids;
+  position_t far = {5000, 5000, 5000};
+
+  range_tree_.Update(7, far);
+  positions_[7] = far;
+
+  range_tree_.FindInRange(far, 1, ids);
+  ASSERT_EQ(ids.size(), 1u);
+  EXPECT_EQ(ids[0], 7);
+
+  range_tree_.FindInRange(positions_[8], 400, ids);
+  EXPECT_EQ(ids, FindInRangeExhaustive(positions_[8], 400));
+}
@@ -11,6 +11,9 @@
 #include <sys/time.h>
 #include <sys/resource.h>
 #include <inttypes.h>
+#include <algorithm>
+#include <string>
+#include <vector>
 
 #include "gtest/gtest.h"
 
@@ -22,25 +25,42 @@
 #include <kernel/include/definitions/types/signal/rf_signal.h>
 
 #include <kernel/include/scheduler/scheduler.h>
+#include <kernel/include/data_structures/mem_fs/mem_fs.h>
 
 
 #include <kernel/include/scheduler/scheduler_standard_containers.h>
+#include <kernel/include/scheduler/scheduler_calendar_queue.h>
+#include <kernel/include/scheduler/scheduler_partitioned.h>
 
 /* Preparation of the scheduler
  * We need to have the scheduler initialized
+ * Every test is run against each scheduler implementation
  */
 // fixture
-class SchedulerTest : public ::testing::Test {
+class SchedulerTest : public ::testing::TestWithParam<std::string> {
 protected:
   virtual void SetUp() {
     arg_int_=1578520;
     clock_end_ = 1000000u;
+    // the fake node counter is shared by the runs of each implementation
+    DefinitionsNodeFake::number_nodes_ = 0;
     // create the scheduler
-    scheduler_ = std::make_unique<SchedulerStandardContainers>();
+    if (GetParam() == SCHEDULER_TYPE_CALENDAR) {
+      scheduler_ = std::make_unique<SchedulerCalendarQueue>();
+    } else if (GetParam() == SCHEDULER_TYPE_PARTITIONED_CHECK) {
+      scheduler_ = std::make_unique<SchedulerPartitioned>(SCHEDULER_DEFAULT_PARTITIONS, true);
+    } else {
+      scheduler_ = std::make_unique<SchedulerStandardContainers>();
+    }
     scheduler_->SimulationTimeSetEnd(clock_end_);
   }
 
   virtual void TearDown() {
+    // the logical processes of the partitioned scheduler must not depend on each other within a window
+    if (GetParam() == SCHEDULER_TYPE_PARTITIONED_CHECK) {
+      EXPECT_EQ(0u, static_cast<SchedulerPartitioned*>(scheduler_.get())->CountViolations());
+      EXPECT_EQ(0u, static_cast<SchedulerPartitioned*>(scheduler_.get())->CountStragglers());
+    }
     scheduler_clean();
   }
 
@@ -48,7 +68,7 @@ protected:
 	  return true;
   }
 
-  std::unique_ptr<SchedulerStandardContainers> scheduler_;
+  std::unique_ptr<Scheduler> scheduler_;
   int arg_int_;
   Time clock_end_;
 };
@@ -67,7 +87,20 @@ int * callback_fake (call_t *to, call_t *from, void *arg) {
 	  return NULL;
 }
 
-TEST_F(SchedulerTest, EventCreation){
+struct ExecutionOrder {
+  Scheduler *scheduler_;
+  std::vector<Time> clocks_;
+};
+
+int callback_execution_order (call_t *to, call_t *from, void *arg) {
+  ExecutionOrder *order = (ExecutionOrder *) arg;
+  (void) to;
+  (void) from;
+  order->clocks_.push_back(order->scheduler_->SimulationTimeGet());
+  return 0;
+}
+
+TEST_P(SchedulerTest, EventCreation){
   Time clock = 950u;
   auto e = std::make_unique<Event>(clock, PRIORITY_QUIT);
 
@@ -75,7 +108,7 @@ TEST_F(SchedulerTest, EventCreation){
   EXPECT_EQ(e->priority_, PRIORITY_QUIT);
 }
 
-TEST_F(SchedulerTest, EventComparison){
+TEST_P(SchedulerTest, EventComparison){
   Time clock = 950u;
   // e1 < e3 < e2
   auto e1 = Event(clock, PRIORITY_QUIT);
@@ -118,7 +151,7 @@ TEST_F(SchedulerTest, EventComparison){
 }
 
 
-TEST_F(SchedulerTest, SetEnd){
+TEST_P(SchedulerTest, SetEnd){
   uint64_t clock = 1000000u;
   scheduler_->SimulationTimeSetEnd(clock);
 
@@ -127,7 +160,7 @@ TEST_F(SchedulerTest, SetEnd){
   EXPECT_EQ(scheduler_->SimulationTimeGetEnd(), clock);
 }
 
-TEST_F(SchedulerTest, AddQuit){
+TEST_P(SchedulerTest, AddQuit){
   EXPECT_EQ(scheduler_->SimulationTimeGetEnd(), clock_end_);
 
   scheduler_->AddQuit(scheduler_->SimulationTimeGetEnd());
@@ -135,7 +168,7 @@ TEST_F(SchedulerTest, AddQuit){
   scheduler_->SimulationRun();
 }
 
-TEST_F(SchedulerTest, AdvanceClock){
+TEST_P(SchedulerTest, AdvanceClock){
   Time clock = 1500u;
   scheduler_->SimulationTimeAdvanceClock(clock);
   EXPECT_EQ(scheduler_->SimulationTimeGet(), clock);
@@ -146,7 +179,7 @@ TEST_F(SchedulerTest, AdvanceClock){
 }
 
 
-TEST_F(SchedulerTest, AddBirth){
+TEST_P(SchedulerTest, AddBirth){
   Time clock = 0u;
   int nr_nodes = 10;
 
@@ -166,7 +199,7 @@ TEST_F(SchedulerTest, AddBirth){
   EXPECT_EQ(get_node_count(), nr_nodes);
 }
 
-TEST_F(SchedulerTest, AddCallback){
+TEST_P(SchedulerTest, AddCallback){
 	call_t to = {-1,1};
 	call_t from = {0,0};
 	uint64_t clock = 1u;
@@ -183,7 +216,7 @@ TEST_F(SchedulerTest, AddCallback){
 }
 
 
-TEST_F(SchedulerTest, DeleteCallback){
+TEST_P(SchedulerTest, DeleteCallback){
   call_t to = {-1,1};
   call_t from = {0,0};
   uint64_t clock = 1u;
@@ -201,7 +234,25 @@ TEST_F(SchedulerTest, DeleteCallback){
   (void) event_info;
 }
 
-TEST_F(SchedulerTest, AddRxBegin){
+TEST_P(SchedulerTest, AddCallbackAfterMemFsClean){
+  call_t to = {-1,1};
+  call_t from = {0,0};
+  scheduler_->AddQuit(clock_end_);
+  scheduler_->AddCallback(1u, to, from, (callback_t) callback_fake, (void*) &arg_int_);
+  scheduler_->SimulationRun();
+
+  // the event slices were released, new ones must be declared
+  mem_fs_clean();
+  arg_int_ = 0;
+  scheduler_->SimulationTimeSetEnd(2 * clock_end_);
+  scheduler_->AddQuit(2 * clock_end_);
+  scheduler_->AddCallback(clock_end_ + 1, to, from, (callback_t) callback_fake, (void*) &arg_int_);
+  scheduler_->SimulationRun();
+
+  EXPECT_EQ(arg_int_, 1000);
+}
+
+TEST_P(SchedulerTest, AddRxBegin){
   packet_t packet;
   nodeid_t source = 0;
   MockSpectrumModel spectrum;
@@ -218,7 +269,36 @@ TEST_F(SchedulerTest, AddRxBegin){
 
 }
 
-TEST_F(SchedulerTest, AddRxEnd){
+TEST_P(SchedulerTest, RxBeginFanoutOrder){
+  call_t from = {0,0};
+  rx_begin_t receptions[4] = {{300, {0,1}, NULL}, {100, {0,2}, NULL}, {200, {0,3}, NULL}, {100, {0,4}, NULL}};
+  EventUid first_uid = Event::uid_counter_;
+  EventRxFanout fanout(PRIORITY_RX_BEGIN, from, receptions, 4);
+
+  // one uid per reception, in the order they are given
+  EXPECT_EQ(Event::uid_counter_, first_uid + 4);
+
+  // the event stands for the earliest reception, the next one being at the back
+  EXPECT_EQ(fanout.clock_, 100u);
+  EXPECT_EQ(fanout.uid_, first_uid + 1);
+  ASSERT_EQ(fanout.receptions_.size(), 4u);
+  EXPECT_EQ(fanout.receptions_[3].to_.object, 2);
+  EXPECT_EQ(fanout.receptions_[2].to_.object, 4);
+  EXPECT_EQ(fanout.receptions_[1].to_.object, 3);
+  EXPECT_EQ(fanout.receptions_[0].to_.object, 1);
+}
+
+TEST_P(SchedulerTest, RxBeginFanoutSingleEvent){
+  call_t from = {0,0};
+  rx_begin_t receptions[3] = {{300, {0,1}, NULL}, {100, {0,2}, NULL}, {200, {0,3}, NULL}};
+
+  scheduler_->AddRxBegin(from, receptions, 3);
+
+  // the receptions of a transmission take a single queue entry
+  EXPECT_EQ(scheduler_->CountEvents(), 1);
+}
+
+TEST_P(SchedulerTest, AddRxEnd){
   packet_t packet;
   nodeid_t source = 0;
   MockSpectrumModel spectrum;
@@ -235,7 +315,7 @@ TEST_F(SchedulerTest, AddRxEnd){
 
 }
 
-TEST_F(SchedulerTest, AddTxEnd){
+TEST_P(SchedulerTest, AddTxEnd){
   packet_t packet;
   nodeid_t source = 0;
   MockSpectrumModel spectrum;
@@ -251,3 +331,114 @@ TEST_F(SchedulerTest, AddTxEnd){
   scheduler_->SimulationRun();
 
 }
+
+TEST_P(SchedulerTest, ExecutionOrder){
+  call_t to = {-1,-1};
+  call_t from = {-1,-1};
+  ExecutionOrder order = {scheduler_.get(), std::vector<Time>()};
+  std::vector<Time> expected;
+  std::vector<event_t> deleted;
+  uint64_t seed = 12345u;
+
+  scheduler_->AddQuit(clock_end_);
+
+  // spread callbacks on the whole simulation, with some of them at the same date
+  for (auto i = 0; i < 5000; i++){
+    seed = seed * 6364136223846793005u + 1442695040888963407u;
+    Time clock = (seed >> 33) % (clock_end_ / 10);
+    if (i % 3 == 0) {
+      clock *= 10;
+    }
+    event_t event_info = scheduler_->AddCallback(clock, to, from, (callback_t) callback_execution_order, (void*) &order);
+    if (i % 7 == 0) {
+      deleted.push_back(event_info);
+    } else {
+      expected.push_back(clock);
+    }
+  }
+
+  for (auto event_info : deleted){
+    scheduler_->DeleteCallback(event_info);
+  }
+
+  // run the simulations
+  scheduler_->SimulationRun();
+
+  std::sort(expected.begin(), expected.end());
+  EXPECT_EQ(order.clocks_, expected);
+  EXPECT_EQ(scheduler_->CountEvents(), 0);
+}
+
+TEST_P(SchedulerTest, DeleteCallbackRemovesEvent){
+  call_t to = {-1,-1};
+  call_t from = {-1,-1};
+  ExecutionOrder order = {scheduler_.get(), std::vector<Time>()};
+  std::vector<event_t> events;
+
+  for (auto i = 0; i < 100; i++){
+    events.push_back(scheduler_->AddCallback(1000 + i, to, from, (callback_t) callback_execution_order, (void*) &order));
+  }
+
+  // deleted callbacks leave the queue right away
+  for (auto i = 0; i < 100; i += 2){
+    scheduler_->DeleteCallback(events[i]);
+  }
+  EXPECT_EQ(scheduler_->CountEvents(), 50);
+
+  // deleting twice has no effect
+  scheduler_->DeleteCallback(events[0]);
+  EXPECT_EQ(scheduler_->CountEvents(), 50);
+
+  scheduler_->AddQuit(clock_end_);
+  scheduler_->SimulationRun();
+
+  EXPECT_EQ(order.clocks_.size(), 50u);
+  EXPECT_EQ(order.clocks_.front(), 1001u);
+}
+
+TEST_P(SchedulerTest, DeleteExecutedCallback){
+  call_t to = {-1,-1};
+  call_t from = {-1,-1};
+  ExecutionOrder order = {scheduler_.get(), std::vector<Time>()};
+
+  event_t executed = scheduler_->AddCallback(10, to, from, (callback_t) callback_execution_order, (void*) &order);
+  scheduler_->AddQuit(20);
+  scheduler_->SimulationRun();
+
+  // the handle of the executed callback is given to a new callback
+  event_t pending = scheduler_->AddCallback(30, to, from, (callback_t) callback_execution_order, (void*) &order);
+  EXPECT_EQ(pending.handle_, executed.handle_);
+
+  // deleting the executed callback must not delete the new one
+  scheduler_->DeleteCallback(executed);
+  EXPECT_EQ(scheduler_->CountEvents(), 1);
+}
+
+TEST_P(SchedulerTest, RescheduleCallback){
+  call_t to = {-1,-1};
+  call_t from = {-1,-1};
+  ExecutionOrder order = {scheduler_.get(), std::vector<Time>()};
+
+  event_t first = scheduler_->AddCallback(100, to, from, (callback_t) callback_execution_order, (void*) &order);
+  event_t second = scheduler_->AddCallback(200, to, from, (callback_t) callback_execution_order, (void*) &order);
+  scheduler_->AddQuit(clock_end_);
+
+  first = scheduler_->RescheduleCallback(first, 300);
+  second = scheduler_->RescheduleCallback(second, 50);
+  EXPECT_EQ(first.clock_, 300u);
+  EXPECT_GE(first.handle_, 0);
+  EXPECT_EQ(scheduler_->CountEvents(), 3);
+
+  scheduler_->SimulationRun();
+
+  std::vector<Time> expected = {50, 300};
+  EXPECT_EQ(order.clocks_, expected);
+
+  // an executed callback can not be rescheduled
+  first = scheduler_->RescheduleCallback(first, 400);
+  EXPECT_EQ(first.handle_, -1);
+}
+
+INSTANTIATE_TEST_CASE_P(SchedulerImplementations, SchedulerTest,
+                        ::testing::Values(SCHEDULER_TYPE_STANDARD, SCHEDULER_TYPE_CALENDAR,
+                                          SCHEDULER_TYPE_PARTITIONED_CHECK));
@@ -0,0 +1,187 @@
+/**
+ *  \file   spatial_grid_unit_test.cc
+ *  \brief  Spatial Grid Unit Tests
+ *  \author agent
+ *  \date   2026
+ **/
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include <kernel/include/data_structures/spatial_grid/spatial_grid.h>
+
+#define ID_CNT 500
+#define CELL_SIZE 50.0
+
+struct Position {
+  double x;
+  double y;
+  double z;
+};
+
+// fixture
+class SpatialGridTest : public ::testing::Test {
+protected:
+  virtual void SetUp() {
+    grid_ = spatial_grid_create(CELL_SIZE, ID_CNT);
+    ASSERT_NE(nullptr, grid_);
+
+    generator_.seed(1234);
+    for (int id = 0; id < ID_CNT; id++){
+      positions_.push_back(Random());
+      indexed_.push_back(true);
+      spatial_grid_update(grid_, id, positions_[id].x, positions_[id].y, positions_[id].z);
+    }
+  }
+
+  virtual void TearDown() {
+    spatial_grid_destroy(grid_);
+  }
+
+  Position Random(){
+    std::uniform_real_distribution<double> coordinate(-500, 500);
+    Position position = {coordinate(generator_), coordinate(generator_), coordinate(generator_) / 10};
+    return position;
+  }
+
+  void Move(int id, const Position &position){
+    positions_[id] = position;
+    indexed_[id] = true;
+    spatial_grid_update(grid_, id, position.x, position.y, position.z);
+  }
+
+  void Remove(int id){
+    indexed_[id] = false;
+    spatial_grid_remove(grid_, id);
+  }
+
+  // exhaustive search, by increasing id
+  std::vector<int> FindInRangeExhaustive(const Position &center, double range){
+    std::vector<int> ids;
+    for (int id = 0; id < ID_CNT; id++){
+      double dx = positions_[id].x - center.x;
+      double dy = positions_[id].y - center.y;
+      double dz = positions_[id].z - center.z;
+      if (indexed_[id] && (dx * dx + dy * dy + dz * dz <= range * range)){
+        ids.push_back(id);
+      }
+    }
+    return ids;
+  }
+
+  std::vector<int> Query(const Position &center, double range){
+    int size;
+    int *ids = spatial_grid_query(grid_, center.x, center.y, center.z, range, &size);
+    return std::vector<int>(ids, ids + size);
+  }
+
+  // the candidates are sorted, unique, indexed, in a cell intersecting the query cube, and cover the exhaustive search
+  void ExpectQuery(const Position &center, double range){
+    std::vector<int> candidates = Query(center, range);
+    std::vector<int> expected = FindInRangeExhaustive(center, range);
+
+    EXPECT_TRUE(std::is_sorted(candidates.begin(), candidates.end()));
+    EXPECT_EQ(candidates.end(), std::adjacent_find(candidates.begin(), candidates.end()));
+    EXPECT_TRUE(std::includes(candidates.begin(), candidates.end(), expected.begin(), expected.end()));
+
+    for (int id : candidates){
+      EXPECT_TRUE(indexed_[id]);
+      EXPECT_LE(std::fabs(positions_[id].x - center.x), range + CELL_SIZE);
+      EXPECT_LE(std::fabs(positions_[id].y - center.y), range + CELL_SIZE);
+      EXPECT_LE(std::fabs(positions_[id].z - center.z), range + CELL_SIZE);
+    }
+  }
+
+  spatial_grid_t *grid_;
+  std::mt19937 generator_;
+  std::vector<Position> positions_;
+  std::vector<bool> indexed_;
+};
+
+
+TEST_F(SpatialGridTest, Create){
+  EXPECT_EQ(nullptr, spatial_grid_create(0, 10));
+  EXPECT_EQ(nullptr, spatial_grid_create(-1, 10));
+  EXPECT_EQ(nullptr, spatial_grid_create(1, -1));
+
+  spatial_grid_t *empty = spatial_grid_create(1, 0);
+  ASSERT_NE(nullptr, empty);
+  int size = -1;
+  spatial_grid_query(empty, 0, 0, 0, 10, &size);
+  EXPECT_EQ(0, size);
+  spatial_grid_destroy(empty);
+  spatial_grid_destroy(NULL);
+}
+
+TEST_F(SpatialGridTest, Insert){
+  for (int i = 0; i < 100; i++){
+    ExpectQuery(Random(), i);
+  }
+}
+
+TEST_F(SpatialGridTest, InsertAll){
+  // more cells than ids: the linear scan
+  Position center = {0, 0, 0};
+  std::vector<int> all = Query(center, 1000);
+  EXPECT_EQ(ID_CNT, (int) all.size());
+  ExpectQuery(center, 1000);
+  ExpectQuery(center, 300);
+}
+
+TEST_F(SpatialGridTest, Move){
+  std::uniform_int_distribution<int> id(0, ID_CNT - 1);
+  std::uniform_real_distribution<double> step(-30, 30);
+
+  for (int i = 0; i < 2000; i++){
+    int moved = id(generator_);
+    Position position = positions_[moved];
+    // small moves, mostly within the same cell, and long ones
+    if (i % 4){
+      position.x += step(generator_);
+      position.y += step(generator_);
+    } else {
+      position = Random();
+    }
+    Move(moved, position);
+
+    if (i % 20 == 0){
+      ExpectQuery(Random(), 100);
+    }
+  }
+  for (int i = 0; i < 100; i++){
+    ExpectQuery(Random(), i * 2);
+  }
+}
+
+TEST_F(SpatialGridTest, Remove){
+  for (int id = 0; id < ID_CNT; id += 3){
+    Remove(id);
+  }
+  // twice is ignored
+  Remove(0);
+  for (int i = 0; i < 100; i++){
+    ExpectQuery(Random(), i * 2);
+  }
+
+  // back in the grid
+  Move(0, Random());
+  ExpectQuery(positions_[0], 0);
+  EXPECT_EQ(ID_CNT - (ID_CNT + 2) / 3 + 1, (int) Query(Position{0, 0, 0}, 1000).size());
+}
+
+TEST_F(SpatialGridTest, OutOfRangeIds){
+  Position center = {0, 0, 0};
+  std::vector<int> before = Query(center, 1000);
+
+  spatial_grid_update(grid_, -1, 0, 0, 0);
+  spatial_grid_update(grid_, ID_CNT, 0, 0, 0);
+  spatial_grid_remove(grid_, -1);
+  spatial_grid_remove(grid_, ID_CNT);
+
+  EXPECT_EQ(before, Query(center, 1000));
+  ExpectQuery(center, 100);
+}
@@ -253,9 +253,9 @@ void tx(call_t *to, call_t *from) {
 /* ************************************************** */
 /* ************************************************** */
 void rx(call_t *to, call_t *from, packet_t *packet) {
-    struct pkt_payload *payload;
+    const struct pkt_payload *payload;
 
-    payload = (struct pkt_payload *) packet_retrieve_field_value_ptr(packet, "pkt_payload");
+    payload = (const struct pkt_payload *) packet_get_field_value_ptr(packet, "pkt_payload");
 
     PRINT_APPLICATION("[APP] Time %"PRId64" - Node %d - "
                       "msg rx (seq %d, values %d %d)\n",
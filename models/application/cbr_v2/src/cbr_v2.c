@@ -187,7 +187,7 @@ void tx(call_t *to, call_t *from) {
 /* ************************************************** */
 /* ************************************************** */
 void rx(call_t *to, call_t *from, packet_t *packet) {  
-  struct data_packet_header *header = (struct data_packet_header *) packet_retrieve_field_value_ptr(packet, "data_packet_header");
+  const struct data_packet_header *header = (const struct data_packet_header *) packet_get_field_value_ptr(packet, "data_packet_header");
 
   printf("[CBRV2] node %d (%.2lf,%.2lf) received a packet from %d (%.2lf,%.2lf): seq=%d delay=%lfs size=%d bytes real_size=%d bits rxdBm=%lf dBm\n", to->object, get_node_position(to->object)->x, get_node_position(to->object)->y, header->source, header->source_pos_x, header->source_pos_y, header->sequence, ((get_time()*0.000000001)-header->delay), packet->size, packet->real_size, packet->rxdBm);
 
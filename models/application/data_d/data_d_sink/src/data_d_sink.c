@@ -256,7 +256,7 @@ int fsm(call_t *to, call_t *from, void * arg) {
 /**************************************************************************/
 void rx_home_adv(call_t *to, packet_t *packet) {
     struct nodedata *nodedata = get_node_private_data(to);
-    struct home_adv_p *home = (struct home_adv_p *) packet_retrieve_field_value_ptr(packet, "home_adv_p");
+    const struct home_adv_p *home = (const struct home_adv_p *) packet_get_field_value_ptr(packet, "home_adv_p");
     packet_t *packet0;
     destination_t dst = {home->sensor, {-1, -1, -1}};
     call_t to0 = {get_class_bindings_down(to)->elts[0], to->object};
@@ -319,7 +319,7 @@ void rx_home_adv(call_t *to, packet_t *packet) {
 void rx_sensor_data(call_t *to, packet_t *packet) {
     struct nodedata *nodedata = get_node_private_data(to);
     struct classdata *classdata = get_class_private_data(to);
-    struct sensor_data_p *data = (struct sensor_data_p *) packet_retrieve_field_value_ptr(packet, "sensor_data_p");
+    const struct sensor_data_p *data = (const struct sensor_data_p *) packet_get_field_value_ptr(packet, "sensor_data_p");
 
     /* check meta data */
     if (data->metadata != nodedata->metadata) {
@@ -376,7 +376,7 @@ void rx_sensor_data(call_t *to, packet_t *packet) {
 /**************************************************************************/
 /**************************************************************************/
 void rx(call_t *to, call_t *from, packet_t *packet) {
-    struct data_d_header *header = (struct data_d_header *) packet_retrieve_field_value_ptr(packet, "data_d_header");
+    const struct data_d_header *header = (const struct data_d_header *) packet_get_field_value_ptr(packet, "data_d_header");
 
     switch (header->type) {
     case SOURCE_ADV_TYPE:
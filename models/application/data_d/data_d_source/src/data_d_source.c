@@ -166,8 +166,8 @@ int fsm(call_t *to, call_t *from, void * arg) {
 /**************************************************************************/
 void rx_sensor_adv(call_t *to, packet_t *packet) {
     struct nodedata *nodedata = get_node_private_data(to);
-    struct sensor_adv_p *adv =
-      (struct sensor_adv_p *) packet_retrieve_field_value_ptr(packet, "sensor_adv_p");
+    const struct sensor_adv_p *adv =
+      (const struct sensor_adv_p *) packet_get_field_value_ptr(packet, "sensor_adv_p");
     packet_t *packet0;
     destination_t dst = {adv->sensor, {-1, -1, -1}};
     call_t to0 = {get_class_bindings_down(to)->elts[0], to->object};
@@ -222,8 +222,8 @@ void rx_sensor_adv(call_t *to, packet_t *packet) {
 /**************************************************************************/
 /**************************************************************************/
 void rx(call_t *to, call_t *from, packet_t *packet) {
-    struct data_d_header *header = 
-      (struct data_d_header *) packet_retrieve_field_value_ptr(packet, "data_d_header");
+    const struct data_d_header *header = 
+      (const struct data_d_header *) packet_get_field_value_ptr(packet, "data_d_header");
 
     switch (header->type) {
     case SOURCE_ADV_TYPE:
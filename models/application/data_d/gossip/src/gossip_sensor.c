@@ -98,7 +98,7 @@ int bootstrap(call_t *to) {
 /**************************************************************************/
 void rx_source_adv(call_t *to, packet_t *packet) {
   struct nodedata *nodedata = get_node_private_data(to);
-  struct source_adv_p *source = (struct source_adv_p *) packet_retrieve_field_value_ptr(packet, "source_adv_p");
+  const struct source_adv_p *source = (const struct source_adv_p *) packet_get_field_value_ptr(packet, "source_adv_p");
   packet_t *packet0;
   destination_t dst = {BROADCAST_ADDR, {-1, -1, -1}};
   call_t to0 = {get_class_bindings_down(to)->elts[0], to->object};
@@ -136,7 +136,7 @@ void rx_source_adv(call_t *to, packet_t *packet) {
 /**************************************************************************/
 void rx_sink_adv(call_t *to, packet_t *packet) {
   struct nodedata *nodedata = get_node_private_data(to);
-  struct sink_adv_p *sink = (struct sink_adv_p *) packet_retrieve_field_value_ptr(packet, "sink_adv_p");
+  const struct sink_adv_p *sink = (const struct sink_adv_p *) packet_get_field_value_ptr(packet, "sink_adv_p");
   packet_t *packet0;
   destination_t dst = {BROADCAST_ADDR, {-1, -1, -1}};
   call_t to0 = {get_class_bindings_down(to)->elts[0], to->object};
@@ -184,7 +184,7 @@ void rx_sink_adv(call_t *to, packet_t *packet) {
 /**************************************************************************/
 void rx_source_data(call_t *to, packet_t *packet) {
   struct nodedata *nodedata = get_node_private_data(to);
-  struct source_data_p *data = (struct source_data_p *) packet_retrieve_field_value_ptr(packet, "source_data_p");
+  const struct source_data_p *data = (const struct source_data_p *) packet_get_field_value_ptr(packet, "source_data_p");
   packet_t *packet0;
   destination_t dst = {BROADCAST_ADDR, {-1, -1, -1}};
   call_t to0 = {get_class_bindings_down(to)->elts[0], to->object};
@@ -232,7 +232,7 @@ void rx_source_data(call_t *to, packet_t *packet) {
 /**************************************************************************/
 void rx_gossip_data(call_t *to, packet_t *packet) {
   struct nodedata *nodedata = get_node_private_data(to);
-  struct gossip_data_p *data = (struct gossip_data_p *) packet_retrieve_field_value_ptr(packet, "gossip_data_p");
+  const struct gossip_data_p *data = (const struct gossip_data_p *) packet_get_field_value_ptr(packet, "gossip_data_p");
   destination_t dst = {BROADCAST_ADDR, {-1, -1, -1}};
   call_t to0 = {get_class_bindings_down(to)->elts[0], to->object};
 
@@ -256,7 +256,7 @@ void rx_gossip_data(call_t *to, packet_t *packet) {
 /**************************************************************************/
 /**************************************************************************/
 void rx(call_t *to, call_t *from, packet_t *packet) {
-  struct data_d_header *header = (struct data_d_header *) packet_retrieve_field_value_ptr(packet, "data_d_header");
+  const struct data_d_header *header = (const struct data_d_header *) packet_get_field_value_ptr(packet, "data_d_header");
 
   switch (header->type) {
   case SOURCE_ADV_TYPE:
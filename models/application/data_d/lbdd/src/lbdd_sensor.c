@@ -523,7 +523,7 @@ int hello_callback(call_t *to, call_t *from, void *args) {
 /* ************************************************** */
 /* ************************************************** */
 void rx(call_t *to, call_t *from, packet_t *packet) {
-  struct data_d_header *header = (struct data_d_header *) packet_retrieve_field_value_ptr(packet, "data_d_header");
+  const struct data_d_header *header = (const struct data_d_header *) packet_get_field_value_ptr(packet, "data_d_header");
 
   switch (header->type) {
 
@@ -573,7 +573,7 @@ void rx(call_t *to, call_t *from, packet_t *packet) {
 /* ************************************************** */
 void rx_lbdd_hello(call_t *to, packet_t *packet) {
   struct nodedata *nodedata = get_node_private_data(to);
-  struct lbdd_hello_p *hello = (struct lbdd_hello_p *) packet_retrieve_field_value_ptr(packet, "lbdd_hello_p");
+  const struct lbdd_hello_p *hello = (const struct lbdd_hello_p *) packet_get_field_value_ptr(packet, "lbdd_hello_p");
   struct lbdd_neighbor *neighbor;
 
   //    PRINT_APPLICATION("[LBDD] node %d received HELLO packet from %d \n", to->object, hello->src);
@@ -609,7 +609,7 @@ void rx_lbdd_hello(call_t *to, packet_t *packet) {
 void rx_source_adv(call_t *to, packet_t *packet) {
   struct nodedata *nodedata = get_node_private_data(to);
   struct classdata *classdata = get_class_private_data(to);
-  struct source_adv_p *source = (struct source_adv_p *) packet_retrieve_field_value_ptr(packet, "source_adv_p");
+  const struct source_adv_p *source = (const struct source_adv_p *) packet_get_field_value_ptr(packet, "source_adv_p");
   packet_t *packet0;
   destination_t dst = {BROADCAST_ADDR, {-1, -1, -1}};
   array_t *down = get_class_bindings_down(to);
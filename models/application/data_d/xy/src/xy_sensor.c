@@ -421,7 +421,7 @@ int hello_callback(call_t *to, call_t *from, void *args) {
 /* ************************************************** */
 /* ************************************************** */
 void rx(call_t *to, call_t *from, packet_t *packet) {
-  struct data_d_header *header = (struct data_d_header *) packet_retrieve_field_value_ptr(packet, "data_d_header");
+  const struct data_d_header *header = (const struct data_d_header *) packet_get_field_value_ptr(packet, "data_d_header");
 
   switch (header->type) {       
 
@@ -470,7 +470,7 @@ void rx(call_t *to, call_t *from, packet_t *packet) {
 /* ************************************************** */
 void rx_xy_hello(call_t *to, packet_t *packet) {
   struct nodedata *nodedata = get_node_private_data(to);
-  struct xy_hello_p *hello = (struct xy_hello_p *) packet_retrieve_field_value_ptr(packet, "xy_hello_p");
+  const struct xy_hello_p *hello = (const struct xy_hello_p *) packet_get_field_value_ptr(packet, "xy_hello_p");
   struct xy_neighbor *neighbor;
 
   /* check for existing neighbors */
@@ -504,7 +504,7 @@ void rx_xy_hello(call_t *to, packet_t *packet) {
 void rx_source_adv(call_t *to, packet_t *packet) {
   struct nodedata *nodedata = get_node_private_data(to);
   struct classdata *classdata = get_class_private_data(to);
-  struct source_adv_p *source = (struct source_adv_p *) packet_retrieve_field_value_ptr(packet, "source_adv_p");
+  const struct source_adv_p *source = (const struct source_adv_p *) packet_get_field_value_ptr(packet, "source_adv_p");
   packet_t *packet0;
   destination_t dst = {BROADCAST_ADDR, {-1, -1, -1}};
   array_t *down = get_class_bindings_down(to);
@@ -548,7 +548,7 @@ void rx_source_adv(call_t *to, packet_t *packet) {
 void rx_source_data(call_t *to, packet_t *packet) {
   struct nodedata *nodedata = get_node_private_data(to);
   struct classdata *classdata = get_class_private_data(to);
-  struct source_data_p *data = (struct source_data_p *) packet_retrieve_field_value_ptr(packet, "source_data_p");
+  const struct source_data_p *data = (const struct source_data_p *) packet_get_field_value_ptr(packet, "source_data_p");
   position_t rdv_position;
   struct xy_neighbor *n_hop;
 
@@ -225,7 +225,7 @@ void fw(call_t *to, call_t *from, packet_t *packet) {
 /* ************************************************** */
 /* ************************************************** */
 void rx(call_t *to, call_t *from, packet_t *packet) {
-  int *demo_tx_id = (int *) packet_retrieve_field_value_ptr(packet, "_demo_header_tx_id");
+  const int *demo_tx_id = (const int *) packet_get_field_value_ptr(packet, "_demo_header_tx_id");
   struct _demo_node_private  *nodedata  = get_node_private_data(to);
 
   if (nodedata->log_status){
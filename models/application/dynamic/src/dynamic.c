@@ -478,7 +478,7 @@ void tx_query(call_t *to, nodeid_t dst) {
 /* ************************************************** */
 void rx(call_t *to, call_t *from, packet_t *packet) {
   struct _app_data *nodedata = get_node_private_data(to);
-  struct pkt_payload *payload = (struct pkt_payload *) packet_retrieve_field_value_ptr(packet, "pkt_payload");
+  const struct pkt_payload *payload = (const struct pkt_payload *) packet_get_field_value_ptr(packet, "pkt_payload");
     
   if (payload->seq == 0) {
     DBG("Time %"PRId64" - Node %d received a QUERY...\n",
@@ -253,7 +253,7 @@ void fwd(call_t *to, call_t *from, packet_t *packet) {
 // Funtion to receive packets from lower-layers
 void rx(call_t *to, call_t *from, packet_t *packet) {
 
-  struct _epidemic_packet_header *packet_header = (struct _epidemic_packet_header *) packet_retrieve_field_value_ptr(packet, "_epidemic_header");
+  const struct _epidemic_packet_header *packet_header = (const struct _epidemic_packet_header *) packet_get_field_value_ptr(packet, "_epidemic_header");
   struct _epidemic_node_private *nodedata = get_node_private_data(to);
   struct _epidemic_class_private *classdata = get_class_private_data(to);
 
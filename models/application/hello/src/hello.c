@@ -286,7 +286,7 @@ int tx(call_t *to, call_t *from, void *args) {
 /* ************************************************** */
 void rx(call_t *to, call_t *from, packet_t *packet) {
   struct _hello_class_private *classdata = get_class_private_data(to);
-  int *hello_id = (int *) packet_retrieve_field_value_ptr(packet, "_hello_header");
+  const int *hello_id = (const int *) packet_get_field_value_ptr(packet, "_hello_header");
 
   if (classdata->adj[to->object][*hello_id] == 0) {
     classdata->adj[to->object][*hello_id] = 1;
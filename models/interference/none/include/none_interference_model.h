@@ -24,7 +24,7 @@ public:
 	NoneInterferenceModel();
 	~NoneInterferenceModel();
 private:
-	void ApplyInterferenceImpl(std::shared_ptr<Signal> , MapOfSignals);
+	void ApplyInterferenceImpl(std::shared_ptr<Signal> , const MapOfSignals &);
 	void PrintImpl() const;
 };
 
@@ -51,7 +51,7 @@ NoneInterferenceModel::~NoneInterferenceModel(){
 
 }
 
-void NoneInterferenceModel::ApplyInterferenceImpl(std::shared_ptr<Signal> , MapOfSignals){
+void NoneInterferenceModel::ApplyInterferenceImpl(std::shared_ptr<Signal> , const MapOfSignals &){
 	return;
 }
 
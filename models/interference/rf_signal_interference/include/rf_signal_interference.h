@@ -9,13 +9,21 @@
 #ifndef WSNET_EXTERNAL_MODELS_LORA_INTERFERENCE_MODEL_H_
 #define WSNET_EXTERNAL_MODELS_LORA_INTERFERENCE_MODEL_H_
 
+#include <vector>
 #include <kernel/include/definitions/types.h>
 #include <kernel/include/definitions/models/interference/interference_model.h>
 #include <kernel/include/definitions/types/signal/signal.h>
+#include <kernel/include/definitions/types/signal/rf_signal.h>
+
+// the SINR of a signal from each time on, until the next time or the end of the signal
+using SINRProfile = std::vector<std::pair<Time, double>>;
 
 /** \brief The Concrete Derived Class : RFSignalInterferenceModel Class
  *		   This model introduces interference to the rf signal
+ *		   The bands of the interferers are swept once against the bands of the tracked signal,
+ *		   giving the power of each interferer within them, then the interferers are swept in time.
  *
+ * \fn GetSINRProfile() return the SINR of the tracked signal along its reception
  * \fn ApplyInterferenceImpl() implements the application of interferences on the tracked signal
  * \fn PrintImpl() implemetns the Print function
  **/
@@ -23,9 +31,19 @@ class RFSignalInterferenceModel : public InterferenceModel {
 public:
 	RFSignalInterferenceModel();
 	~RFSignalInterferenceModel();
+	SINRProfile GetSINRProfile(std::shared_ptr<Signal> signal, const MapOfSignals &Map_Of_Signals);
 private:
-	void ApplyInterferenceImpl(std::shared_ptr<Signal> signal, MapOfSignals Map_Of_Signals);
+	// an interferer, during its intersection with the tracked signal
+	struct Interferer {
+		Time begin;
+		Time end;
+		double power_mW; // within the bands of the tracked signal
+	};
+	void ApplyInterferenceImpl(std::shared_ptr<Signal> signal, const MapOfSignals &Map_Of_Signals);
 	void PrintImpl() const;
+	std::vector<Interferer> GetInterferers(const std::shared_ptr<RFSignal> &desired_signal, const MapOfSignals &Map_Of_Signals);
+	double GetSignalPower(const std::shared_ptr<RFSignal> &desired_signal);
+	double GetNoise(const std::shared_ptr<RFSignal> &desired_signal);
 
 };
 
@@ -8,6 +8,8 @@
 
 #include <iostream>
 #include <limits>
+#include <algorithm>
+#include <vector>
 #include <kernel/include/modelutils.h>
 #include <kernel/include/definitions/types.h>
 #include <kernel/include/definitions/models.h>
@@ -51,71 +53,161 @@ RFSignalInterferenceModel::RFSignalInterferenceModel(){
 RFSignalInterferenceModel::~RFSignalInterferenceModel(){
 }
 
-// probably put these functions on the core
-inline double get_intersection_duration(const std::shared_ptr<Signal> &A, const std::shared_ptr<Signal> &B){
-  return (double) std::min(A->GetEnd(),B->GetEnd()) - (double) std::max(A->GetBegin(),B->GetBegin());
+/* ************************************************** */
+/* ************************************************** */
+// the frequencies covered by the bands of the desired signal, as a piecewise constant function:
+// count[j] bands cover [points[j], points[j+1]], integral[j] is the integral of the count up to points[j]
+struct RFSignalBandCoverage {
+  std::vector<double> points;
+  std::vector<double> integral;
+  std::vector<int> count;
+};
+
+static RFSignalBandCoverage create_band_coverage(const SetOfFrequencyIntervalWaveform &bands){
+  RFSignalBandCoverage coverage;
+  std::vector<std::pair<double, int>> edges;
+
+  edges.reserve(2 * bands.size());
+  for (auto const &band : bands){
+    edges.emplace_back(band->GetLowPoint(), 1);
+    edges.emplace_back(band->GetHighPoint(), -1);
+  }
+  std::sort(edges.begin(), edges.end());
+
+  auto count = 0;
+  for (auto const &edge : edges){
+    if (coverage.points.empty() || (edge.first != coverage.points.back())){
+      auto integral = coverage.points.empty() ? 0.0 : coverage.integral.back() + count * (edge.first - coverage.points.back());
+      coverage.points.push_back(edge.first);
+      coverage.integral.push_back(integral);
+      coverage.count.push_back(count);
+    }
+    count += edge.second;
+    coverage.count.back() = count;
+  }
+  return coverage;
 }
-inline double get_intersection_bandwidth(const std::shared_ptr<FrequencyIntervalWaveform> &A, const std::shared_ptr<FrequencyIntervalWaveform> &B){
-  return (double) std::min(A->GetHighPoint(),B->GetHighPoint()) - (double) std::max(A->GetLowPoint(),B->GetLowPoint());
+
+// integral of the coverage up to the frequency
+static double get_band_coverage(const RFSignalBandCoverage &coverage, double frequency){
+  auto j = std::upper_bound(coverage.points.begin(), coverage.points.end(), frequency) - coverage.points.begin() - 1;
+  if (j < 0){
+    return 0.0;
+  }
+  return coverage.integral[j] + coverage.count[j] * (frequency - coverage.points[j]);
 }
 
-void RFSignalInterferenceModel::ApplyInterferenceImpl(std::shared_ptr<Signal> signal, MapOfSignals interferences){
+/* ************************************************** */
+/* ************************************************** */
+void RFSignalInterferenceModel::ApplyInterferenceImpl(std::shared_ptr<Signal> signal, const MapOfSignals &interferences){
   // if signal is not a RF Signal, we are not able to decode the signal,
   // thus, nothing to be done
-  auto desired_signal = std::dynamic_pointer_cast<RFSignal>(signal);
+  auto desired_signal = signal_cast<RFSignal>(signal);
   if (!desired_signal){
     return;
   }
+  auto signal_duration = (double) (desired_signal->GetEnd() - desired_signal->GetBegin());
   auto interference_mW = 0.0;
-  auto signal_duration = desired_signal->GetEnd() - desired_signal->GetBegin();
-  auto signal_bandwidth_Hz = desired_signal->GetBandwidth();
-  auto signal_power_mW = 0.0;
-
-  // for each freq interval of the desired signal
-  for (auto selected_signal_freq_interval : desired_signal->GetWaveform().lock()->GetAllFrequencyInterval()){
-    signal_power_mW += selected_signal_freq_interval->GetPSDValue() * (selected_signal_freq_interval->GetHighPoint() - selected_signal_freq_interval->GetLowPoint());
-
-    // for each interferer
-    for(auto interference : interferences){
-
-      // do nothing if interferer is the same signal as the selected desired_signal
-      if (interference.second == signal){
-        continue;
-      }
-
-      // do nothing if it is not a RF signal
-      auto interferer_rf_signal = std::dynamic_pointer_cast<RFSignal>(interference.second);
-      if (!interferer_rf_signal){
-        continue;
-      }
-
-      // do nothing if there is no time intersection
-      auto intersection_duration = get_intersection_duration(interference.second, signal);
-      if (intersection_duration <=0){
-        continue;
-      }
-
-      // for each freq interval of the interferer
-      for (auto interf_freq_interval : interferer_rf_signal->GetWaveform().lock()->GetAllFrequencyInterval()){
-        auto intersection_bandwidth = get_intersection_bandwidth(interf_freq_interval, selected_signal_freq_interval);
-        // interference contribution on this portion of the signal
-        // No need to divide this by total BW, because PSD is mW/HZ
-        interference_mW += intersection_bandwidth * selected_signal_freq_interval->GetPSDValue() * (intersection_duration / signal_duration);
-      }
-    }
-  }
-  call_t to_interface = {desired_signal->GetTo_Deprecated().classid, desired_signal->GetTo_Deprecated().object};
-  auto noise_mW = noise_get_noise(&to_interface, signal_bandwidth_Hz);
 
   // the SINR will be an average of all (sum) noise uniformly distributed
   // throughout the signal (whole time duration and frequency length)
-  // thus, we need to first get the signal power of the whole signal
-  // and then, we calculate the SINR
-  desired_signal->SetSINR(signal_power_mW/(interference_mW+noise_mW));
+  for (auto const &interferer : GetInterferers(desired_signal, interferences)){
+    interference_mW += interferer.power_mW * (double) (interferer.end - interferer.begin) / signal_duration;
+  }
 
+  desired_signal->SetSINR(GetSignalPower(desired_signal) / (interference_mW + GetNoise(desired_signal)));
   return;
 }
 
+SINRProfile RFSignalInterferenceModel::GetSINRProfile(std::shared_ptr<Signal> signal, const MapOfSignals &interferences){
+  SINRProfile profile;
+  auto desired_signal = signal_cast<RFSignal>(signal);
+  if (!desired_signal){
+    return profile;
+  }
+  auto signal_power_mW = GetSignalPower(desired_signal);
+  auto noise_mW = GetNoise(desired_signal);
+
+  // the interference changes when an interferer begins or ends
+  std::vector<std::pair<Time, double>> changes;
+  for (auto const &interferer : GetInterferers(desired_signal, interferences)){
+    changes.emplace_back(interferer.begin, interferer.power_mW);
+    changes.emplace_back(interferer.end, -interferer.power_mW);
+  }
+  std::sort(changes.begin(), changes.end());
+
+  auto interference_mW = 0.0;
+  profile.emplace_back(desired_signal->GetBegin(), signal_power_mW / noise_mW);
+  for (auto const &change : changes){
+    interference_mW += change.second;
+    if (change.first >= desired_signal->GetEnd()){
+      break;
+    }
+    auto sinr = signal_power_mW / (std::max(interference_mW, 0.0) + noise_mW);
+    if (profile.back().first == change.first){
+      profile.back().second = sinr;
+    } else {
+      profile.emplace_back(change.first, sinr);
+    }
+  }
+  return profile;
+}
+
+// the received signals overlapping the desired one in time, with their power within its bands
+std::vector<RFSignalInterferenceModel::Interferer> RFSignalInterferenceModel::GetInterferers(const std::shared_ptr<RFSignal> &desired_signal, const MapOfSignals &interferences){
+  std::vector<Interferer> interferers;
+  auto coverage = create_band_coverage(desired_signal->GetWaveform().lock()->GetAllFrequencyInterval());
+
+  for (auto const &interference : interferences){
+
+    // do nothing if interferer is the same signal as the selected desired_signal
+    if (interference.second == desired_signal){
+      continue;
+    }
+
+    // do nothing if there is no time intersection
+    auto begin = std::max(interference.second->GetBegin(), desired_signal->GetBegin());
+    auto end = std::min(interference.second->GetEnd(), desired_signal->GetEnd());
+    if (end <= begin){
+      continue;
+    }
+
+    // do nothing if it is not a RF signal
+    auto interferer_rf_signal = signal_cast<RFSignal>(interference.second);
+    if (!interferer_rf_signal){
+      continue;
+    }
+
+    // power of the interferer within the bands of the desired signal
+    // No need to divide this by total BW, because PSD is mW/HZ
+    auto power_mW = 0.0;
+    for (auto const &interf_freq_interval : interferer_rf_signal->GetWaveform().lock()->GetAllFrequencyInterval()){
+      auto intersection_bandwidth = get_band_coverage(coverage, interf_freq_interval->GetHighPoint()) - get_band_coverage(coverage, interf_freq_interval->GetLowPoint());
+      power_mW += intersection_bandwidth * interf_freq_interval->GetPSDValue();
+    }
+    power_mW *= interferer_rf_signal->GetPSDScale();
+
+    if (power_mW > 0){
+      interferers.push_back({begin, end, power_mW});
+    }
+  }
+  return interferers;
+}
+
+double RFSignalInterferenceModel::GetSignalPower(const std::shared_ptr<RFSignal> &desired_signal){
+  // the waveform is the transmitted one
+  auto signal_power_mW = 0.0;
+  for (auto const &freq_interval : desired_signal->GetWaveform().lock()->GetAllFrequencyInterval()){
+    signal_power_mW += freq_interval->GetPSDValue() * (freq_interval->GetHighPoint() - freq_interval->GetLowPoint());
+  }
+  return signal_power_mW * desired_signal->GetPSDScale();
+}
+
+double RFSignalInterferenceModel::GetNoise(const std::shared_ptr<RFSignal> &desired_signal){
+  call_t to_interface = {desired_signal->GetTo_Deprecated().classid, desired_signal->GetTo_Deprecated().object};
+  return noise_get_noise(&to_interface, desired_signal->GetBandwidth());
+}
+
 void RFSignalInterferenceModel::PrintImpl() const{
   std::cout << "The RFSignal Interference Model" << std::endl;
   return;
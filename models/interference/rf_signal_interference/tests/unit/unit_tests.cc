@@ -139,3 +139,73 @@ TEST_F(RFSignalInterferenceModelUnitTest, SameBandwidthHalfDuration){
   destroy_object(interf);
 }
 
+
+TEST_F(RFSignalInterferenceModelUnitTest, DisjointBandwidthSameDuration){
+  RFSignalInterferenceModel * interf = (RFSignalInterferenceModel *) create_object(&to_, (void*) params_);
+  auto bandwidth = 125000;
+  auto power_dBm = 14.0;
+  auto freq_center = 868062500;
+  auto desired_signal = create_simple_rf_signal_tests(bandwidth, power_dBm, freq_center, packet_);
+  desired_signal->SetEnd(1*SECONDS);
+  auto interferer_signal = create_simple_rf_signal_tests(bandwidth, power_dBm, freq_center + 2*bandwidth, packet_);
+  interferer_signal->SetEnd(1*SECONDS);
+  MapOfSignals interferers;
+  interferers.insert(std::make_pair(desired_signal->GetUID(),desired_signal));
+  interf->ApplyInterference(desired_signal, interferers);
+  auto sinr_alone = desired_signal->GetSINR();
+
+  interferers.insert(std::make_pair(interferer_signal->GetUID(),interferer_signal));
+  interf->ApplyInterference(desired_signal, interferers);
+
+  // an interferer out of the band of the signal does not interfere
+  EXPECT_DOUBLE_EQ(desired_signal->GetSINR(), sinr_alone);
+
+  destroy_object(interf);
+}
+
+TEST_F(RFSignalInterferenceModelUnitTest, WeakerInterfererSameDuration){
+  RFSignalInterferenceModel * interf = (RFSignalInterferenceModel *) create_object(&to_, (void*) params_);
+  auto bandwidth = 125000;
+  auto power_dBm = 14.0;
+  auto freq_center = 868062500;
+  auto desired_signal = create_simple_rf_signal_tests(bandwidth, power_dBm, freq_center, packet_);
+  desired_signal->SetEnd(1*SECONDS);
+  auto interferer_signal = create_simple_rf_signal_tests(bandwidth, power_dBm, freq_center, packet_);
+  interferer_signal->SetEnd(1*SECONDS);
+  // the interferer is received with half the power of the signal
+  interferer_signal->SetPSDScale(0.5);
+  MapOfSignals interferers;
+  interferers.insert(std::make_pair(desired_signal->GetUID(),desired_signal));
+  interferers.insert(std::make_pair(interferer_signal->GetUID(),interferer_signal));
+  interf->ApplyInterference(desired_signal, interferers);
+
+  EXPECT_FLOAT_EQ(desired_signal->GetSINR(), 2.0);
+
+  destroy_object(interf);
+}
+
+TEST_F(RFSignalInterferenceModelUnitTest, SINRProfileHalfDuration){
+  RFSignalInterferenceModel * interf = (RFSignalInterferenceModel *) create_object(&to_, (void*) params_);
+  auto bandwidth = 125000;
+  auto power_dBm = 14.0;
+  auto freq_center = 868062500;
+  auto desired_signal = create_simple_rf_signal_tests(bandwidth, power_dBm, freq_center, packet_);
+  desired_signal->SetEnd(1*SECONDS);
+  auto interferer_signal = create_simple_rf_signal_tests(bandwidth, power_dBm, freq_center, packet_);
+  interferer_signal->SetEnd(SECONDS/2);
+  MapOfSignals interferers;
+  interferers.insert(std::make_pair(desired_signal->GetUID(),desired_signal));
+  auto profile_alone = interf->GetSINRProfile(desired_signal, interferers);
+
+  interferers.insert(std::make_pair(interferer_signal->GetUID(),interferer_signal));
+  auto profile = interf->GetSINRProfile(desired_signal, interferers);
+
+  ASSERT_EQ(profile_alone.size(), 1u);
+  ASSERT_EQ(profile.size(), 2u);
+  EXPECT_EQ(profile[0].first, (Time) 0);
+  EXPECT_FLOAT_EQ(profile[0].second, 1.0);
+  EXPECT_EQ(profile[1].first, (Time) SECONDS/2);
+  EXPECT_DOUBLE_EQ(profile[1].second, profile_alone[0].second);
+
+  destroy_object(interf);
+}
@@ -384,7 +384,7 @@ int state_machine(call_t *to, call_t *from, void *args) {
     
 //packet size = NTW+MAC headers. Need to add PHY header size duration in timeout
 // TODO is it necessary to update for several PHY layers?
- field_t *PHY_field_header = packet_retrieve_field(packet,"PHY_header");
+ const field_t *PHY_field_header = packet_get_field(packet,"PHY_header");
  if (PHY_field_header == NULL) {
     call_t to0 = {get_class_bindings_down(to)->elts[0], to->object};
     timeout = (packet->size + GET_HEADER_SIZE(&to0,to)) * 8 * transceiver_get_Tb(&to0, &from0); 
@@ -423,9 +423,9 @@ int state_machine(call_t *to, call_t *from, void *args) {
 
     if (nodedata->ack_activate)
 	{
-   field_t *field_header = packet_retrieve_field(nodedata->txbuf,"_802_15_4_header");
-   struct _802_15_4_header *header;
-   header = (struct _802_15_4_header *) field_getValue(field_header);
+   const field_t *field_header = packet_get_field(nodedata->txbuf,"_802_15_4_header");
+   const struct _802_15_4_header *header;
+   header = (const struct _802_15_4_header *) field_header->value;
 	if (header->FC_ack)
 	{
 	
@@ -758,9 +758,9 @@ void rx(call_t *to, call_t *from, packet_t *packet) {
   return;
   }
   
-  field_t *field_txbuf_header = packet_retrieve_field(nodedata->txbuf,"_802_15_4_header");
-  struct _802_15_4_header *txbuf_header;
-  txbuf_header = (struct _802_15_4_header *) field_getValue(field_txbuf_header);
+  const field_t *field_txbuf_header = packet_get_field(nodedata->txbuf,"_802_15_4_header");
+  const struct _802_15_4_header *txbuf_header;
+  txbuf_header = (const struct _802_15_4_header *) field_txbuf_header->value;
   
   	PRINT_MAC("[154_UCSMA/CA] node %d RX ACK \n", to->object);
   
@@ -118,6 +118,13 @@ int _dcf_802_11_cts_header_size = 0;
 int _dcf_802_11_data_header_size = 22;
 int _dcf_802_11_ack_header_size = 0;
 
+/* keys of the header fields, interned at init */
+static field_key_t header_key;
+static field_key_t rts_header_key;
+static field_key_t cts_header_key;
+static field_key_t data_header_key;
+static field_key_t ack_header_key;
+
 /* ************************************************** */
 /* ************************************************** */
 struct nodedata {
@@ -168,12 +175,12 @@ int set_header(call_t *to, call_t *from, packet_t *packet, destination_t *dst) {
   /**********************/
   /* _dcf_802_11_header */
   /**********************/
-  field_t *field_header = packet_retrieve_field(packet,"_dcf_802_11_header");
+  field_t *field_header = packet_retrieve_field_by_key(packet, header_key);
   struct _dcf_802_11_header *header;
   if (field_header == NULL) {
    header = malloc(sizeof(struct _dcf_802_11_header));
    field_t *field_dcf_802_11_header = field_create(INT, sizeof(struct _dcf_802_11_header), header);
-   packet_add_field(packet, "_dcf_802_11_header", field_dcf_802_11_header);
+   packet_add_field_by_key(packet, header_key, field_dcf_802_11_header);
    packet->size += _dcf_802_11_header_size ;
    packet->real_size += 8*_dcf_802_11_header_size ;
   }
@@ -185,12 +192,12 @@ int set_header(call_t *to, call_t *from, packet_t *packet, destination_t *dst) {
   /***************************/
   /* _dcf_802_11_data_header */
   /***************************/
-  field_t *field_data_header = packet_retrieve_field(packet,"_dcf_802_11_data_header");
+  field_t *field_data_header = packet_retrieve_field_by_key(packet, data_header_key);
   struct _dcf_802_11_data_header *data_header;
   if (field_data_header == NULL) {
    data_header = malloc(sizeof(struct _dcf_802_11_data_header));
    field_t *field_dcf_802_11_data_header = field_create(INT, sizeof(struct _dcf_802_11_data_header), data_header);
-   packet_add_field(packet, "_dcf_802_11_data_header", field_dcf_802_11_data_header);
+   packet_add_field_by_key(packet, data_header_key, field_dcf_802_11_data_header);
    packet->size += _dcf_802_11_data_header_size ;
    packet->real_size += 8*_dcf_802_11_data_header_size ;
   }
@@ -244,6 +251,13 @@ int init(call_t *to, void *params) {
   /* default values */
   classdata->maxCSMARetries = macMaxCSMARetries;
 
+  /* field keys */
+  header_key = packet_field_key("_dcf_802_11_header");
+  rts_header_key = packet_field_key("_dcf_802_11_rts_header");
+  cts_header_key = packet_field_key("_dcf_802_11_cts_header");
+  data_header_key = packet_field_key("_dcf_802_11_data_header");
+  ack_header_key = packet_field_key("_dcf_802_11_ack_header");
+
   /* get parameters */
   list_init_traverse(params);
   while ((param = (param_t *) list_traverse(params)) != NULL) {
@@ -464,7 +478,7 @@ int dcf_802_11_state_machine(call_t *to, call_t *from, void *args) {
 
 
     /* Broadcast or unicast */
-    field_t *field_header = packet_retrieve_field(nodedata->txbuf,"_dcf_802_11_header");
+    field_t *field_header = packet_retrieve_field_by_key(nodedata->txbuf, header_key);
 
     header = (struct _dcf_802_11_header *) field_getValue(field_header);
 
@@ -499,7 +513,7 @@ int dcf_802_11_state_machine(call_t *to, call_t *from, void *args) {
        struct _dcf_802_11_header *header;
        header = malloc(sizeof(struct _dcf_802_11_header));
        field_t *field_dcf_802_11_header = field_create(INT, sizeof(struct _dcf_802_11_header), header);
-       packet_add_field(packet, "_dcf_802_11_header", field_dcf_802_11_header);
+       packet_add_field_by_key(packet, header_key, field_dcf_802_11_header);
 
        header->dst = nodedata->dst;
        header->src = to->object;
@@ -508,7 +522,7 @@ int dcf_802_11_state_machine(call_t *to, call_t *from, void *args) {
        struct _dcf_802_11_rts_header *rts_header;
        rts_header = malloc(sizeof(struct _dcf_802_11_rts_header));
        field_t *field_dcf_802_11_rts_header = field_create(INT, sizeof(struct _dcf_802_11_rts_header), rts_header);
-       packet_add_field(packet, "_dcf_802_11_rts_header", field_dcf_802_11_rts_header);
+       packet_add_field_by_key(packet, rts_header_key, field_dcf_802_11_rts_header);
 
 	rts_header->size = nodedata->txbuf->size;
 
@@ -586,7 +600,7 @@ PRINT_MAC("[DCF] node %d Timeout \n", to->object);
        struct _dcf_802_11_header *header2;
        header2 = malloc(sizeof(struct _dcf_802_11_header));
        field_t *field_dcf_802_11_header2 = field_create(INT, sizeof(struct _dcf_802_11_header), header2);
-       packet_add_field(packet, "_dcf_802_11_header", field_dcf_802_11_header2);
+       packet_add_field_by_key(packet, header_key, field_dcf_802_11_header2);
 
        header2->dst = nodedata->dst;
        header2->src = to->object;
@@ -595,7 +609,7 @@ PRINT_MAC("[DCF] node %d Timeout \n", to->object);
        struct _dcf_802_11_cts_header *cts_header;
        cts_header = malloc(sizeof(struct _dcf_802_11_cts_header));
        field_t *field_dcf_802_11_cts_header = field_create(INT, sizeof(struct _dcf_802_11_cts_header), cts_header);
-       packet_add_field(packet, "_dcf_802_11_cts_header", field_dcf_802_11_cts_header);
+       packet_add_field_by_key(packet, cts_header_key, field_dcf_802_11_cts_header);
 
 
         cts_header->nav = macMinSIFSPeriod 
@@ -632,9 +646,8 @@ PRINT_MAC("[DCF] node %d send a CTS packet %d: packet_size=%d   \n", to->object,
     nodedata->state = nodedata->state_pending;
     if (nodedata->state != STATE_IDLE)
       {
-	field_t *field_header = packet_retrieve_field(nodedata->txbuf,"_dcf_802_11_header");
-	header = (struct _dcf_802_11_header *) field_getValue(field_header);
- 	nodedata->dst = header->dst;
+	const field_t *field_header = packet_get_field_by_key(nodedata->txbuf, header_key);
+	nodedata->dst = ((const struct _dcf_802_11_header *) field_header->value)->dst;
       }
     nodedata->clock = get_time();
     dcf_802_11_state_machine(to, from, NULL);
@@ -645,7 +658,7 @@ PRINT_MAC("[DCF] node %d send a CTS packet %d: packet_size=%d   \n", to->object,
     /* Build data packet */	
     packet = packet_clone(nodedata->txbuf);
     
-    field_t *field_data_header = packet_retrieve_field(packet,"_dcf_802_11_data_header");
+    field_t *field_data_header = packet_retrieve_field_by_key(packet, data_header_key);
     data_header = (struct _dcf_802_11_data_header *) field_getValue(field_data_header);
     
     data_header->nav = macMinSIFSPeriod 
@@ -706,7 +719,7 @@ PRINT_MAC("[DCF] node %d send a BROADCAST packet %d: packet_size=%d   \n", to->o
        struct _dcf_802_11_header *header4;
        header4 = malloc(sizeof(struct _dcf_802_11_header));
        field_t *field_dcf_802_11_header4 = field_create(INT, sizeof(struct _dcf_802_11_header), header4);
-       packet_add_field(packet, "_dcf_802_11_header", field_dcf_802_11_header4);
+       packet_add_field_by_key(packet, header_key, field_dcf_802_11_header4);
        header4->type = ACK_TYPE; 
        header4->src = to->object;
        header4->dst = nodedata->dst;
@@ -714,7 +727,7 @@ PRINT_MAC("[DCF] node %d send a BROADCAST packet %d: packet_size=%d   \n", to->o
        struct _dcf_802_11_ack_header *ack_header;
        ack_header = malloc(sizeof(struct _dcf_802_11_ack_header));
        field_t *field_dcf_802_11_ack_header = field_create(INT, sizeof(struct _dcf_802_11_ack_header), ack_header);
-       packet_add_field(packet, "_dcf_802_11_ack_header", field_dcf_802_11_ack_header);
+       packet_add_field_by_key(packet, ack_header_key, field_dcf_802_11_ack_header);
 
 
     timeout =  (packet->size + phy_header_size) * 8 * transceiver_get_Tb(&to0, &from0) 
@@ -744,9 +757,8 @@ PRINT_MAC("[DCF] node %d send an ACK packet %d: packet_size=%d   \n", to->object
     if (nodedata->state != STATE_IDLE)
       {	  
 	
-	field_t *field_header = packet_retrieve_field(nodedata->txbuf,"_dcf_802_11_header");
-	header = (struct _dcf_802_11_header *) field_getValue(field_header);
-	nodedata->dst =header->dst;
+	const field_t *field_header = packet_get_field_by_key(nodedata->txbuf, header_key);
+	nodedata->dst = ((const struct _dcf_802_11_header *) field_header->value)->dst;
       }
     nodedata->clock = get_time();
     dcf_802_11_state_machine(to, from,NULL);
@@ -806,18 +818,32 @@ void rx(call_t *to, call_t *from, packet_t *packet) {
   //switch back in RX MODE
   transceiver_switch_rx(&to0, &from0);
 
-  struct _dcf_802_11_header *header = (struct _dcf_802_11_header *) packet_retrieve_field_value_ptr(packet, "_dcf_802_11_header");
+  /* headers are only read: the fields shared with the other receivers are not copied */
+  const field_t *field_header = packet_get_field_by_key(packet, header_key);
+  const field_t *field_type_header;
 
-  struct _dcf_802_11_data_header *data_header;
-  struct _dcf_802_11_rts_header *rts_header;
-  struct _dcf_802_11_cts_header *cts_header;
+  const struct _dcf_802_11_header *header;
+  const struct _dcf_802_11_data_header *data_header;
+  const struct _dcf_802_11_rts_header *rts_header;
+  const struct _dcf_802_11_cts_header *cts_header;
+
+  if (field_header == NULL) {
+    /* not a dcf 802.11 frame */
+    packet_dealloc(packet);
+    return;
+  }
+  header = (const struct _dcf_802_11_header *) field_header->value;
 
   switch (header->type)
     {	
     case RTS_TYPE:
 
  /* Receive RTS*/
-    rts_header = (struct _dcf_802_11_rts_header *) packet_retrieve_field_value_ptr(packet, "_dcf_802_11_rts_header");
+    if ((field_type_header = packet_get_field_by_key(packet, rts_header_key)) == NULL) {
+      packet_dealloc(packet);
+      return;
+    }
+    rts_header = (const struct _dcf_802_11_rts_header *) field_type_header->value;
 
       if (header->dst != to->object)
 	{
@@ -858,7 +884,11 @@ void rx(call_t *to, call_t *from, packet_t *packet) {
     case CTS_TYPE:
 
       /* Receive CTS */
-     cts_header = (struct _dcf_802_11_cts_header *) packet_retrieve_field_value_ptr(packet, "_dcf_802_11_cts_header");
+     if ((field_type_header = packet_get_field_by_key(packet, cts_header_key)) == NULL) {
+       packet_dealloc(packet);
+       return;
+     }
+     cts_header = (const struct _dcf_802_11_cts_header *) field_type_header->value;
       if (header->dst != to->object)
 	{
 	  /* Packet not for us */
@@ -894,7 +924,11 @@ void rx(call_t *to, call_t *from, packet_t *packet) {
 	
     case DATA_TYPE:
  
-       data_header = (struct _dcf_802_11_data_header *) packet_retrieve_field_value_ptr(packet, "_dcf_802_11_data_header");
+       if ((field_type_header = packet_get_field_by_key(packet, data_header_key)) == NULL) {
+         packet_dealloc(packet);
+         return;
+       }
+       data_header = (const struct _dcf_802_11_data_header *) field_type_header->value;
 
      /* Received DATA */	
       if (header->dst != to->object) {
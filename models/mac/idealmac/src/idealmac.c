@@ -152,19 +152,19 @@ int tx_delay(call_t *to, call_t *from, void *args) {
   struct nodedata *nodedata = get_node_private_data(to);
   position_t *local = get_node_position(to->object);
   int i = 0;
-  field_t *field_header;
-  struct _mac_header *header;
+  const field_t *field_header;
+  const struct _mac_header *header;
     
   packet_t *packet;
   if ((packet = (packet_t *) list_pop_FIFO(nodedata->buffer)) == NULL)
     return 0;
    
-  field_header = packet_retrieve_field(packet, "_mac_header");
+  field_header = packet_get_field(packet, "_mac_header");
   if (field_header == NULL) {
     fprintf(stderr, "error in idealmac tx_delay(), field _mac_header not found\n");
     return -1;
   }
-  header = (struct _mac_header *) field_getValue(field_header);
+  header = (const struct _mac_header *) field_header->value;
 
   /* Broadcast packet */
   if (header->type == BROADCAST_TYPE) {
@@ -274,15 +274,16 @@ PRINT_MAC("[IDEALMAC] node %d transmits an DATA packet %d: packet_size=%d   \n",
 void rx(call_t *to, call_t *from, packet_t *packet) {
   array_t *up = get_class_bindings_up(to);
   int i = up->size;
-  field_t *field_header;
-  struct _mac_header *header;
+  const field_t *field_header;
+  const struct _mac_header *header;
 
-  field_header = packet_retrieve_field(packet, "_mac_header");
+  /* the header is only read: the fields shared with the other receivers are not copied */
+  field_header = packet_get_field(packet, "_mac_header");
   if (field_header == NULL) {
     fprintf(stderr, "error in idealmac rx(), field _mac_header not found\n");
     return;
   }
-  header = (struct _mac_header *) field_getValue(field_header);
+  header = (const struct _mac_header *) field_header->value;
 
   if (header->type == UNICAST_TYPE && header->dst != to->object) {
     /* Packet not for us */
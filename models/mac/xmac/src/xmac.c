@@ -58,7 +58,7 @@ struct xmac_nodedata {
     int prio_queue;
     int pulse_count;
     int ack_wait_count;
-    event_t *last_scheduled_event;
+    event_t last_scheduled_event;
     nodeid_t dst_data;
     nodeid_t dst_ack;
     nodeid_t src_preamble;
@@ -228,7 +228,7 @@ int bind(call_t *to, void *params) {
   nodedata->dst_ack = 0;
   nodedata->src_preamble = -1;
   nodedata->pulse_count = 1;
-  nodedata->last_scheduled_event = NULL;
+  nodedata->last_scheduled_event.handle_ = -1;
   nodedata->preamble_count = 0;
   nodedata->ack_wait_count = 1;
   nodedata->transceiver_state = TRANSCEIVER_OFF;
@@ -412,14 +412,14 @@ void xmac_add_callback(uint64_t clock, call_t *to, call_t*from,
    * state machine, so we remove the last scheduled 
    * event if it exists and has not been executed yet 
    */
-  if (nodedata->last_scheduled_event != NULL
-      && nodedata->last_scheduled_event->clock_ > get_time()) {
-    scheduler_delete_callback(nodedata->last_scheduled_event);
+  if (nodedata->last_scheduled_event.handle_ >= 0
+      && nodedata->last_scheduled_event.clock_ > get_time()) {
+    scheduler_cancel_callback(&nodedata->last_scheduled_event);
   }
 
   /* Schedule the new event */
-  nodedata->last_scheduled_event = 
-      scheduler_add_callback(clock, to, from, callback, NULL);
+  scheduler_add_callback_event(&nodedata->last_scheduled_event,
+      clock, to, from, callback, NULL);
   return;
 }
 
@@ -508,8 +508,8 @@ int state_machine(call_t *to, call_t *from, void *args) {
 
   int phy_header_size=GET_HEADER_SIZE(&to0,to);
 
-  /* current event is going to be deleted, so stop to point at it */
-  nodedata->last_scheduled_event = NULL;
+  /* current event has been executed, so stop to point at it */
+  nodedata->last_scheduled_event.handle_ = -1;
 
   /* Drop unscheduled events */
   if (nodedata->clock != get_time()) {
@@ -716,7 +716,7 @@ int state_machine(call_t *to, call_t *from, void *args) {
         nodedata->state = STATE_TX_PREAMBLE_END;
 
         /* Adjust clock to the end of transmission */
-        field_t *PHY_field_header = packet_retrieve_field(packet,"PHY_header");
+        const field_t *PHY_field_header = packet_get_field(packet,"PHY_header");
         if (PHY_field_header == NULL) {
           timeout = ((packet->size + phy_header_size)* 8 * transceiver_get_Tb(&to0, &from0));
         }
@@ -782,7 +782,7 @@ int state_machine(call_t *to, call_t *from, void *args) {
       header = (struct _xmac_header *) field_getValue(field_header);
       header->type = DATA;
 
-      field_t *PHY_field_header = packet_retrieve_field(packet,"PHY_header");
+      const field_t *PHY_field_header = packet_get_field(packet,"PHY_header");
       if (PHY_field_header == NULL) {
         timeout = ((packet->size + phy_header_size)* 8 * transceiver_get_Tb(&to0, &from0));
       }
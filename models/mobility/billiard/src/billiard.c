@@ -27,6 +27,9 @@ struct nodedata {
   uint64_t lupdate;
   double speed;
   angle_t angle;
+  position_t origin;    /* position and angle at bootstrap, for position_at() */
+  angle_t origin_angle;
+  uint64_t origin_time;
 };
 
 
@@ -136,6 +139,9 @@ int bootstrap(call_t *to) {
                get_node_position(to->object)->x, get_node_position(to->object)->y, 
                get_node_position(to->object)->z);
   nodedata->lupdate = get_time();
+  nodedata->origin = *get_node_position(to->object);
+  nodedata->origin_angle = nodedata->angle;
+  nodedata->origin_time = get_time();
 
   return 0;
 }
@@ -243,6 +249,54 @@ void update_position(call_t *to, call_t *from) {
 }
 
 
+/* the node bounces on the area borders: the unfolded coordinate is folded
+ * back into the area, each bounce reversing the direction on the axis */
+static double billiard_fold(double coordinate, double size, int *reversed) {
+  double period = 2 * size;
+
+  *reversed = 0;
+  if (size <= 0) {
+    return 0;
+  }
+  coordinate = fmod(coordinate, period);
+  if (coordinate < 0) {
+    coordinate += period;
+  }
+  if (coordinate > size) {
+    *reversed = 1;
+    return period - coordinate;
+  }
+  return coordinate;
+}
+
+void position_at(call_t *to, uint64_t time, position_t *position) {
+  struct nodedata *nodedata = get_node_private_data(to);
+  position_t *area = get_topology_area();
+  angle_t *angle = &(nodedata->origin_angle);
+  double elapsed = (double) (time - nodedata->origin_time) / 1000000000;
+  double vx = nodedata->speed * cos(angle->xy) * cos(angle->z);
+  double vy = nodedata->speed * sin(angle->xy) * cos(angle->z);
+  double vz = nodedata->speed * sin(angle->z);
+  int rx, ry, rz;
+
+  position->x = billiard_fold(nodedata->origin.x + vx * elapsed, area->x, &rx);
+  position->y = billiard_fold(nodedata->origin.y + vy * elapsed, area->y, &ry);
+  position->z = billiard_fold(nodedata->origin.z + vz * elapsed, area->z, &rz);
+
+  /* the current direction, for get_angle() */
+  nodedata->angle.z = rz ? -angle->z : angle->z;
+  nodedata->angle.xy = atan2(ry ? -sin(angle->xy) : sin(angle->xy), rx ? -cos(angle->xy) : cos(angle->xy));
+  if (nodedata->angle.xy < 0) {
+    nodedata->angle.xy += 2*M_PI;
+  }
+}
+
+double get_max_speed(call_t *to) {
+  struct nodedata *nodedata = get_node_private_data(to);
+
+  return nodedata->speed;
+}
+
 double get_speed(call_t *to) {
 
 struct nodedata *nodedata = get_node_private_data(to);
@@ -263,5 +317,8 @@ return nodedata->angle;
 /* ************************************************** */
 mobility_methods_t methods = {update_position,
 							  get_speed,
-							  get_angle};
+							  get_angle,
+							  NULL,
+							  position_at,
+							  get_max_speed};
 
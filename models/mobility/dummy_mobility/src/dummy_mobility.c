@@ -94,9 +94,9 @@ void update_position(call_t *to, call_t *from) {
   DBG_MOBILITY("model dummy_mobility.c: updating node %d position\n", to->object);
 
   /* move */
-  get_node_by_id(to->object)->position.x = get_node_by_id(to->object)->position.x + 1;
-  get_node_by_id(to->object)->position.y = get_node_by_id(to->object)->position.y + 1;
-  get_node_by_id(to->object)->position.z = get_node_by_id(to->object)->position.z + 1;
+  get_node_position(to->object)->x = get_node_position(to->object)->x + 1;
+  get_node_position(to->object)->y = get_node_position(to->object)->y + 1;
+  get_node_position(to->object)->z = get_node_position(to->object)->z + 1;
 
 }
 
@@ -139,8 +139,13 @@ return angle;
 
 }
 
+int is_static(call_t *to) {
+  return 1;
+}
+
 /* ************************************************** */
 /* ************************************************** */
 mobility_methods_t methods = {update_position,
 							  get_speed,
-							  get_angle};
+							  get_angle,
+							  is_static};
@@ -232,8 +232,13 @@ angle_t get_angle(call_t *to) {
 }
 
 
+int is_static(call_t *to) {
+  return 1;
+}
+
 /* ************************************************** */
 /* ************************************************** */
 mobility_methods_t methods = {update_position,
     get_speed,
-    get_angle};
+    get_angle,
+    is_static};
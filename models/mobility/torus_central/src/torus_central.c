@@ -240,6 +240,12 @@ void update_position(call_t *to, call_t *from) {
   return;
 }
 
+double get_max_speed(call_t *to) {
+  struct nodedata *nodedata = get_node_private_data(to);
+
+  return nodedata->speed;
+}
+
 double get_speed(call_t *to) {
 
 struct nodedata *nodedata = get_node_private_data(to);
@@ -260,5 +266,8 @@ return nodedata->angle;
 /* ************************************************** */
 mobility_methods_t methods = {update_position,
 							  get_speed,
-							  get_angle};
+							  get_angle,
+							  NULL,
+							  NULL,
+							  get_max_speed};
 
@@ -27,6 +27,8 @@ struct nodedata {
     uint64_t lupdate;
     double speed;
     angle_t angle;
+    position_t origin;    /* position at bootstrap, for position_at() */
+    uint64_t origin_time;
 };
 
 /* ************************************************** */
@@ -135,6 +137,8 @@ int bootstrap(call_t *to) {
            get_node_position(to->object)->x, get_node_position(to->object)->y, 
            get_node_position(to->object)->z);
     nodedata->lupdate = get_time();
+    nodedata->origin = *get_node_position(to->object);
+    nodedata->origin_time = get_time();
 
     return 0;
 }
@@ -248,6 +252,31 @@ void update_position(call_t *to, call_t *from) {
     return;
 }
 
+/* the node leaving the area enters it again on the opposite side */
+static double torus_plane_wrap(double coordinate, double size) {
+    if (size <= 0) {
+        return 0;
+    }
+    coordinate = fmod(coordinate, size);
+    return (coordinate < 0) ? coordinate + size : coordinate;
+}
+
+void position_at(call_t *to, uint64_t time, position_t *position) {
+    struct nodedata *nodedata = get_node_private_data(to);
+    position_t *area = get_topology_area();
+    double elapsed = (double) (time - nodedata->origin_time) / 1000000000;
+
+    position->x = torus_plane_wrap(nodedata->origin.x + nodedata->speed * cos(nodedata->angle.xy) * cos(nodedata->angle.z) * elapsed, area->x);
+    position->y = torus_plane_wrap(nodedata->origin.y + nodedata->speed * sin(nodedata->angle.xy) * cos(nodedata->angle.z) * elapsed, area->y);
+    position->z = torus_plane_wrap(nodedata->origin.z + nodedata->speed * sin(nodedata->angle.z) * elapsed, area->z);
+}
+
+double get_max_speed(call_t *to) {
+    struct nodedata *nodedata = get_node_private_data(to);
+
+    return nodedata->speed;
+}
+
 double get_speed(call_t *to) {
 
 struct nodedata *nodedata = get_node_private_data(to);
@@ -268,5 +297,8 @@ return nodedata->angle;
 /* ************************************************** */
 mobility_methods_t methods = {update_position,
 							  get_speed,
-							  get_angle};
+							  get_angle,
+							  NULL,
+							  position_at,
+							  get_max_speed};
 
@@ -21,12 +21,32 @@ model_t model =  {
 
 /* ************************************************** */
 /* ************************************************** */
+struct classdata {
+  ber_table_t table; /* empty in exact mode */
+};
+
+/* the MAX_SNR of the noiseless slices gives 0 */
+static double bpsk_exact(void *data, double snr) {
+  return 0.5 * ber_vector_erfc_sqrt(snr);
+}
+
 int init(call_t *to, void *params) {
-    return 0;
+  struct classdata *classdata = malloc(sizeof(struct classdata));
+
+  if (ber_table_from_params(&(classdata->table), params, "bpsk", bpsk_exact, NULL)) {
+    free(classdata);
+    return -1;
+  }
+
+  set_class_private_data(to, classdata);
+  return 0;
 }
 
 int destroy(call_t *to) {
-    return 0;
+  struct classdata *classdata = get_class_private_data(to);
+  ber_table_destroy(&(classdata->table));
+  free(classdata);
+  return 0;
 }
 
 
@@ -53,11 +73,28 @@ int unbind(call_t *to) {
 /* ************************************************** */
 /* ************************************************** */
 double modulate(call_t *to, call_t *from, double snr) {
-    if (snr == MAX_SNR) {
-      return 0;
-    } else {
-      return 0.5 * erfc(sqrt(snr));
+    struct classdata *classdata = get_class_private_data(to);
+    double ber;
+    if (ber_table_lookup(&(classdata->table), snr, &ber)) {
+      return bpsk_exact(NULL, snr);
+    }
+    return ber;
+}
+
+void modulate_batch(call_t *to, call_t *from, const double *snr, double *ber, int n) {
+    struct classdata *classdata = get_class_private_data(to);
+    int i;
+
+    /* exact mode, the loop is vectorized */
+    if (classdata->table.ber == NULL) {
+      for (i = 0; i < n; i++) {
+        ber[i] = bpsk_exact(NULL, snr[i]);
+      }
+      return;
     }
+
+    /* the snr out of the table range, if any, take the formula */
+    ber_table_evaluate_batch(&(classdata->table), snr, ber, n, bpsk_exact, NULL);
 }
 
 int bit_per_symbol(call_t *to, call_t *from){
@@ -76,4 +113,4 @@ void set_modulation_type(call_t *to, call_t *from, int modulation_type)
 
 /* ************************************************** */
 /* ************************************************** */
-modulation_methods_t methods = {modulate, bit_per_symbol, get_modulation_type,set_modulation_type};
+modulation_methods_t methods = {modulate, bit_per_symbol, get_modulation_type,set_modulation_type, modulate_batch};
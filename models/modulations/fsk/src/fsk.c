@@ -32,11 +32,31 @@ int unbind(call_t *to) {
 
 /* ************************************************** */
 /* ************************************************** */
+struct classdata {
+  ber_table_t table; /* empty in exact mode */
+};
+
+/* the MAX_SNR of the noiseless slices gives 0 */
+static double fsk_exact(void *data, double snr) {
+  return 0.5 * ber_vector_erfc_sqrt(snr/2);
+}
+
 int init(call_t *to, void *params) {
+  struct classdata *classdata = malloc(sizeof(struct classdata));
+
+  if (ber_table_from_params(&(classdata->table), params, "fsk", fsk_exact, NULL)) {
+    free(classdata);
+    return -1;
+  }
+
+  set_class_private_data(to, classdata);
   return 0;
 }
 
 int destroy(call_t *to) {
+  struct classdata *classdata = get_class_private_data(to);
+  ber_table_destroy(&(classdata->table));
+  free(classdata);
   return 0;
 }
 
@@ -44,11 +64,28 @@ int destroy(call_t *to) {
 /* ************************************************** */
 /* ************************************************** */
 double modulate(call_t *to, call_t *from, double snr) {
-  if (snr == MAX_SNR) {
-    return 0;
-  } else {
-    return 0.5 * erfc(sqrt(snr/2));
+  struct classdata *classdata = get_class_private_data(to);
+  double ber;
+  if (ber_table_lookup(&(classdata->table), snr, &ber)) {
+    return fsk_exact(NULL, snr);
+  }
+  return ber;
+}
+
+void modulate_batch(call_t *to, call_t *from, const double *snr, double *ber, int n) {
+  struct classdata *classdata = get_class_private_data(to);
+  int i;
+
+  /* exact mode, the loop is vectorized */
+  if (classdata->table.ber == NULL) {
+    for (i = 0; i < n; i++) {
+      ber[i] = fsk_exact(NULL, snr[i]);
+    }
+    return;
   }
+
+  /* the snr out of the table range, if any, take the formula */
+  ber_table_evaluate_batch(&(classdata->table), snr, ber, n, fsk_exact, NULL);
 }
 
 int bit_per_symbol(call_t *to, call_t *from){
@@ -66,4 +103,4 @@ void set_modulation_type(call_t *to, call_t *from, int modulation_type)
 }
 /* ************************************************** */
 /* ************************************************** */
-modulation_methods_t methods = {modulate, bit_per_symbol, get_modulation_type,set_modulation_type};
+modulation_methods_t methods = {modulate, bit_per_symbol, get_modulation_type,set_modulation_type, modulate_batch};
@@ -20,8 +20,17 @@ model_t model =  {
 
 struct classdata {
   int m_qam; /* order of modulation */
+  double factor; /* ber = factor * erfc(sqrt(scale * snr)) */
+  double scale;
+  ber_table_t table; /* empty in exact mode */
 };
 
+/* the MAX_SNR of the noiseless slices gives 0 */
+static double mqam_exact(void *data, double snr) {
+  struct classdata *classdata = (struct classdata *) data;
+  return classdata->factor * ber_vector_erfc_sqrt(classdata->scale * snr);
+}
+
 /* ************************************************** */
 /* ************************************************** */
 int init(call_t *to, void *params) {
@@ -67,6 +76,13 @@ int init(call_t *to, void *params) {
         
   }
     
+  classdata->factor = 2*(sqrt(classdata->m_qam)-1)/sqrt(classdata->m_qam)/(log(classdata->m_qam)/log(2));
+  classdata->scale = 3/2*(log(classdata->m_qam)/log(2))/(classdata->m_qam-1);
+
+  if (ber_table_from_params(&(classdata->table), params, "MQAM_modulation", mqam_exact, classdata)) {
+    goto error;
+  }
+
   set_class_private_data(to, classdata);
   return 0;
 
@@ -78,8 +94,9 @@ int init(call_t *to, void *params) {
 
 
 int destroy(call_t *to) {
-
-  free(get_class_private_data(to));
+  struct classdata *classdata = get_class_private_data(to);
+  ber_table_destroy(&(classdata->table));
+  free(classdata);
   return 0;
 }
 
@@ -99,13 +116,29 @@ int unbind(call_t *to) {
 /* ************************************************** */
 double modulate(call_t *to, call_t *from, double snr) {
   struct classdata *classdata = get_class_private_data(to);
-
-  if (snr == MAX_SNR) {
-    return 0;
+  double ber;
+  if (ber_table_lookup(&(classdata->table), snr, &ber)) {
+    return mqam_exact(classdata, snr);
   }
-  else {
-    return 2*(sqrt(classdata->m_qam)-1)/sqrt(classdata->m_qam)/(log(classdata->m_qam)/log(2)) * erfc(sqrt(3/2*(log(classdata->m_qam)/log(2))/(classdata->m_qam-1)*snr));
+  return ber;
+}
+
+void modulate_batch(call_t *to, call_t *from, const double *snr, double *ber, int n) {
+  struct classdata *classdata = get_class_private_data(to);
+  double factor = classdata->factor;
+  double scale = classdata->scale;
+  int i;
+
+  /* exact mode, the loop is vectorized */
+  if (classdata->table.ber == NULL) {
+    for (i = 0; i < n; i++) {
+      ber[i] = factor * ber_vector_erfc_sqrt(scale * snr[i]);
+    }
+    return;
   }
+
+  /* the snr out of the table range, if any, take the formula */
+  ber_table_evaluate_batch(&(classdata->table), snr, ber, n, mqam_exact, classdata);
 }
 
 int bit_per_symbol(call_t *to, call_t *from){
@@ -124,7 +157,7 @@ void set_modulation_type(call_t *to, call_t *from, int modulation_type)
 }
 /* ************************************************** */
 /* ************************************************** */
-modulation_methods_t methods = {modulate, bit_per_symbol, get_modulation_type,set_modulation_type};
+modulation_methods_t methods = {modulate, bit_per_symbol, get_modulation_type,set_modulation_type, modulate_batch};
 
 
 
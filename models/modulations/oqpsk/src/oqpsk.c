@@ -21,11 +21,28 @@ model_t model =  {
 
 /* ************************************************** */
 /* ************************************************** */
+struct classdata {
+  ber_table_t table; /* empty in exact mode */
+};
+
+static double oqpsk_exact(void *data, double snr);
+
 int init(call_t *c, void *params) {
+  struct classdata *classdata = malloc(sizeof(struct classdata));
+
+  if (ber_table_from_params(&(classdata->table), params, "oqpsk", oqpsk_exact, NULL)) {
+    free(classdata);
+    return -1;
+  }
+
+  set_class_private_data(c, classdata);
   return 0;
 }
 
 int destroy(call_t *c) {
+  struct classdata *classdata = get_class_private_data(c);
+  ber_table_destroy(&(classdata->table));
+  free(classdata);
   return 0;
 }
 
@@ -44,20 +61,61 @@ int unbind(call_t *to) {
 /*Modified by Luiz Henrique Suraty Filho*/
 /* ************************************************** */
 /* ************************************************** */
-double modulate(call_t *to, call_t *from, double snr) {
+/* the binomial coefficients of the terms k = 2..16 of the sum */
+static const double oqpsk_coefficients[15] = {120, -560, 1820, -4368, 8008, -11440, 12870, -11440, 8008, -4368, 1820, -560, 120, -16, 1};
+
+/* the MAX_SNR of the noiseless slices gives 0, 20 * MAX_SNR being infinite */
+static double oqpsk_exact(void *data, double snr) {
 	double ber154 = 0.0;
+	int k;
 
 	/*Calculation is based on the calculations provided in P802.15.4REVb/D5, April, 2006 (Revision of IEEE Std 802.15.4-2003) page 266*/
 	/* We don't use a binomial coeficient function, once it is faster and costs less to pre-calculate all using the preprocessor or calculating it before-hand, as we do*/
-	if (snr != MAX_SNR) {
-		ber154+=(120.0* exp(20.0 * snr * ((double) 1/2 - 1)) -560.0 * exp(20.0 * snr * ((double) 1/3 - 1)) + 1820.0 * exp(20.0 * snr * ((double) 1/4 - 1)) - 4368.0 * exp(20.0 * snr * ((double) 1/5 - 1)));
-		ber154+=(8008.0 * exp(20.0 * snr * ((double) 1/6 - 1)) -11440.0 * exp(20.0 * snr * ((double) 1/7 - 1)) + 12870.0 * exp(20.0 * snr * ((double) 1/8 - 1)) - 11440.0 * exp(20.0 * snr * ((double) 1/9 - 1)));
-		ber154+=(8008.0 * exp(20.0 * snr * ((double) 1/10 - 1)) -4368.0 * exp(20.0 * snr * ((double) 1/11 - 1)) + 1820.0 * exp(20.0 * snr * ((double) 1/12 - 1))- 560.0 * exp(20.0 * snr * ((double) 1/13 - 1)));
-		ber154+=(120.0 * exp(20.0 * snr * ((double) 1/14 - 1)) -16.0 * exp(20.0 * snr * ((double) 1/15 - 1)) + 1 * exp(20.0 * snr * ((double) 1/16 - 1)));
-		ber154 = (double) 8/15 * (double) 1/16 * ber154;
+	for (k = 2; k <= 16; k++) {
+		ber154 += oqpsk_coefficients[k - 2] * ber_vector_exp_negative(snr * (20.0 * (1 - (double) 1/k)));
+	}
+
+	return (double) 8/15 * (double) 1/16 * ber154;
+}
+
+double modulate(call_t *to, call_t *from, double snr) {
+	struct classdata *classdata = get_class_private_data(to);
+	double ber;
+	if (ber_table_lookup(&(classdata->table), snr, &ber)) {
+		return oqpsk_exact(NULL, snr);
+	}
+	return ber;
+}
+
+void modulate_batch(call_t *to, call_t *from, const double *snr, double *ber, int n) {
+	struct classdata *classdata = get_class_private_data(to);
+	double sum[BER_TABLE_BATCH];
+	int i, j, k;
+
+	/* exact mode, the terms are added in the same order as oqpsk_exact(),
+	 * one at a time over a chunk of slices, so that the loops are vectorized */
+	if (classdata->table.ber == NULL) {
+		for (i = 0; i < n; i += BER_TABLE_BATCH) {
+			int size = (n - i < BER_TABLE_BATCH) ? (n - i) : BER_TABLE_BATCH;
+			for (j = 0; j < size; j++) {
+				sum[j] = 0.0;
+			}
+			for (k = 2; k <= 16; k++) {
+				double coefficient = oqpsk_coefficients[k - 2];
+				double weight = 20.0 * (1 - (double) 1/k);
+				for (j = 0; j < size; j++) {
+					sum[j] += coefficient * ber_vector_exp_negative(snr[i + j] * weight);
+				}
+			}
+			for (j = 0; j < size; j++) {
+				ber[i + j] = (double) 8/15 * (double) 1/16 * sum[j];
+			}
+		}
+		return;
 	}
 
-	return ber154;
+	/* the snr out of the table range, if any, take the formula */
+	ber_table_evaluate_batch(&(classdata->table), snr, ber, n, oqpsk_exact, NULL);
 }
 /*End of modification by Luiz Henrique Suraty Filho*/
 
@@ -76,4 +134,4 @@ void set_modulation_type(call_t *to, call_t *from, int modulation_type)
 
 /* ************************************************** */
 /* ************************************************** */
-modulation_methods_t methods = {modulate, bit_per_symbol,get_modulation_type,set_modulation_type};
+modulation_methods_t methods = {modulate, bit_per_symbol,get_modulation_type,set_modulation_type, modulate_batch};
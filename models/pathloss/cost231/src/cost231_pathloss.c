@@ -196,7 +196,13 @@ double pathloss(call_t *to_pathloss, call_t *to_interface ,call_t *from_interfac
 }
 
 
+/* the pathloss only depends on the nodes positions and the map walls */
+int cacheable(call_t *to_pathloss) {
+  return 1;
+}
+
+
 /* ************************************************** */
 /* ************************************************** */
-pathloss_methods_t methods = {pathloss};
+pathloss_methods_t methods = {pathloss, cacheable};
 
@@ -21,8 +21,7 @@ model_t model =  {
 /* ************************************************** */
 /* ************************************************** */
 struct classdata {
-    double *success;
-    int node_cnt;
+    link_store_t *success;
 };
 
 
@@ -32,6 +31,7 @@ int init(call_t *to, void *params) {
     struct classdata *classdata = malloc(sizeof(struct classdata));
     param_t *param;
     char *filepath = NULL;
+    char *savepath = NULL;
     int src, dst;
     double proba;
     FILE *file;
@@ -39,6 +39,7 @@ int init(call_t *to, void *params) {
 
     /* default values */
     filepath = "propagation.data";
+    classdata->success = NULL;
 
     /* get parameters */
     list_init_traverse(params);
@@ -46,6 +47,24 @@ int init(call_t *to, void *params) {
         if (!strcmp(param->key, "file")) {
             filepath = param->value;
         }
+        if (!strcmp(param->key, "save")) {
+            savepath = param->value;
+        }
+    }
+
+    /* binary file, mapped as is */
+    if (link_store_is_file(filepath)) {
+        if ((classdata->success = link_store_load(filepath)) == NULL) {
+            fprintf(stderr, "filestatic: can not load links file %s in init()\n", filepath);
+            goto error;
+        }
+        if (classdata->success->node_cnt != get_node_count()) {
+            fprintf(stderr, "filestatic: links file %s is for %d nodes, not %d, in init()\n",
+                    filepath, classdata->success->node_cnt, get_node_count());
+            goto error;
+        }
+        set_class_private_data(to, classdata);
+        return 0;
     }
 
     /* open file */
@@ -54,33 +73,45 @@ int init(call_t *to, void *params) {
         goto error;
     }
 
-    /* extract link success probability */
-    classdata->node_cnt = get_node_count();
-    classdata->success = malloc(sizeof(double) * classdata->node_cnt *classdata->node_cnt);
-    for (src = 0; src < classdata->node_cnt; src++) {
-        for (dst = 0; dst < classdata->node_cnt; dst++) {
-            
-            *(classdata->success + (src * classdata->node_cnt) + dst) = MIN_DBM;
-        }
+    /* extract link success probability, the links not in the file are never successful */
+    if ((classdata->success = link_store_create(get_node_count(), MIN_DBM)) == NULL) {
+        fclose(file);
+        goto error;
     }
-    fseek(file, 0L, SEEK_SET);
     while (fgets(str, 128, file) != NULL) {
-        sscanf(str, "%d %d %lf\n",  &src, &dst, &proba);
-        *(classdata->success + (src * classdata->node_cnt) + dst) = proba;
+        if (sscanf(str, "%d %d %lf\n",  &src, &dst, &proba) != 3) {
+            continue;
+        }
+        if (link_store_set(classdata->success, src, dst, proba)) {
+            fprintf(stderr, "filestatic: invalid link %d -> %d in file %s\n", src, dst, filepath);
+            fclose(file);
+            goto error;
+        }
     }
-
     fclose(file);
+
+    if (link_store_finalize(classdata->success)) {
+        goto error;
+    }
+
+    /* binary copy, to be mapped by the next simulations */
+    if (savepath && link_store_save(classdata->success, savepath)) {
+        fprintf(stderr, "filestatic: can not save links file %s in init()\n", savepath);
+        goto error;
+    }
+
     set_class_private_data(to, classdata);
     return 0;
 
  error:
+    link_store_destroy(classdata->success);
     free(classdata);
     return -1;
 }
 
 int destroy(call_t *to) {
     struct classdata *classdata = get_class_private_data(to);
-    free(classdata->success);
+    link_store_destroy(classdata->success);
     free(classdata);
     return 0;
 }
@@ -110,7 +141,7 @@ int unbind(call_t *to) {
 /* ************************************************** */
 double pathloss(call_t *to_pathloss, call_t *to_interface ,call_t *from_interface, packet_t *packet, double rxdBm){
     struct classdata *classdata = get_class_private_data(to_pathloss);
-    double success = *(classdata->success + (packet->node * classdata->node_cnt) + to_interface->object);
+    double success = link_store_get(classdata->success, packet->node, to_interface->object);
 
     if (success == 1) {
         return rxdBm;
@@ -136,7 +136,13 @@ double pathloss(call_t *to_pathloss, call_t *to_interface ,call_t *from_interfac
      return (rxdBm - L_dB);
 }
 
+/* the pathloss only depends on the nodes positions */
+int cacheable(call_t *to_pathloss) {
+  return 1;
+}
+
+
 /* ************************************************** */
 /* ************************************************** */
-pathloss_methods_t methods = {pathloss};
+pathloss_methods_t methods = {pathloss, cacheable};
 
@@ -23,7 +23,7 @@ model_t model =  {
 struct classdata {
   FILE *file;
   xmlNodeSetPtr nodeset;
-  double *wiplan_rxdBm;
+  link_store_t *wiplan_rxdBm; /* rx power of each (rx node, tx node) */
 };
 
 
@@ -38,6 +38,7 @@ int init(call_t *to, void *params) {
   struct classdata *classdata = malloc(sizeof(struct classdata));
   param_t *param;
   char *filepath = NULL;
+  char *savepath = NULL;
   int file_param_found = 0;
 
   DBG_PATHLOSS("model pathloss_wiplan.c: initializing class %s\n",
@@ -45,6 +46,7 @@ int init(call_t *to, void *params) {
 
   /* default value */
   filepath = "wiplanout.xml";
+  classdata->wiplan_rxdBm = NULL;
 
   /* get parameters */
   list_init_traverse(params);
@@ -53,6 +55,9 @@ int init(call_t *to, void *params) {
       filepath = param->value;
       file_param_found = 1;
     }
+    if (!strcmp(param->key, "save")) {
+      savepath = param->value;
+    }
   }
 
   if (!file_param_found) {
@@ -60,6 +65,21 @@ int init(call_t *to, void *params) {
     goto error;
   }
 
+  /* binary file, mapped as is */
+  if (link_store_is_file(filepath)) {
+    if ((classdata->wiplan_rxdBm = link_store_load(filepath)) == NULL)
+      goto error;
+
+    if (classdata->wiplan_rxdBm->node_cnt != get_node_count()) {
+      fprintf(stderr, "pathloss_wiplan.c: %s is for %d nodes, not %d\n",
+              filepath, classdata->wiplan_rxdBm->node_cnt, get_node_count());
+      goto error;
+    }
+
+    set_class_private_data(to, classdata);
+    return 0;
+  }
+
   /* open file */
   classdata->nodeset = wiplan_parser_start(filepath);
 
@@ -70,17 +90,25 @@ int init(call_t *to, void *params) {
   if (wiplan_parse(classdata))
     goto error;
 
+  /* binary copy, to be mapped by the next simulations */
+  if (savepath && link_store_save(classdata->wiplan_rxdBm, savepath)) {
+    fprintf(stderr, "pathloss_wiplan.c: can not save %s\n", savepath);
+    goto error;
+  }
+
   set_class_private_data(to, classdata);
   return 0;
 
  error:
   fprintf(stderr, "pathloss_wiplan.c: error when parsing %s\n", filepath);
+  link_store_destroy(classdata->wiplan_rxdBm);
   free(classdata);
   return -1;
 }
 
 int destroy(call_t *to) {
-  struct classdata *classdata = malloc(sizeof(struct classdata));
+  struct classdata *classdata = get_class_private_data(to);
+  link_store_destroy(classdata->wiplan_rxdBm);
   free(classdata);
 
   return 0;
@@ -109,9 +137,10 @@ int unbind(call_t *to) {
 double pathloss(call_t *to_pathloss, call_t *to_interface ,call_t *from_interface, packet_t *packet, double rxdBm)
 {
   struct classdata *classdata = get_class_private_data(to_pathloss);
+  double wiplan_rxdBm = link_store_get(classdata->wiplan_rxdBm, to_interface->object, from_interface->object);
   DBG_PATHLOSS("model pathloss_wiplan.c: dst %d rx %gdBm from %d\n",
-	  dst, *(classdata->wiplan_rxdBm + to_interface->object * nodes.size + from_interface->object), from_interface->object);
-  return *(classdata->wiplan_rxdBm + to_interface->object * nodes.size + from_interface->object);
+	  to_interface->object, wiplan_rxdBm, from_interface->object);
+  return wiplan_rxdBm;
 }
 
 
@@ -122,10 +151,9 @@ int wiplan_parse(struct classdata *classdata)
   int i = 0;
   int check_nodes_ids = 0;
 
-  /* allocate memory to save Wiplan rxdBm values */
-  classdata->wiplan_rxdBm = malloc(sizeof(double) * nodes.size * nodes.size);
-  /* memory management:
-     |0 from 0|0 from 1|...|0 from x||1 from 0|1 from 1|..|1 from x|...|x from 0||x from 1|...|x from x| */
+  /* Wiplan rxdBm values by (rx node, tx node), the links not in the file are not received */
+  if ((classdata->wiplan_rxdBm = link_store_create(nodes.size, MIN_DBM)) == NULL)
+    return -1;
 
   /* Parse Wiplan config file */
   for (i = 0 ; i < classdata->nodeset->nodeNr ; i++)
@@ -158,7 +186,12 @@ int wiplan_parse(struct classdata *classdata)
 			{
 			  double rxdBm;
 			  get_param_double(content, &rxdBm);
-			  *(classdata->wiplan_rxdBm + id * nodes.size + rxid)= rxdBm;
+			  if (link_store_set(classdata->wiplan_rxdBm, id, rxid, rxdBm))
+			    {
+			      fprintf(stderr, "pathloss_wiplan_wiplan.c: node %d rx from node %d, invalid node\n",
+				      id, rxid);
+			      return -1;
+			    }
 			  DBG_PATHLOSS("model pathloss_wiplan_wiplan.c: node %d rx from node %d set to %gdBm\n",
 				       id, rxid, rxdBm);
 			}
@@ -190,7 +223,7 @@ int wiplan_parse(struct classdata *classdata)
       return -1;
     }
 
-  return 0;
+  return link_store_finalize(classdata->wiplan_rxdBm);
 }
 
 /* ************************************************** */
@@ -11,6 +11,8 @@
 
 #include <iostream>
 #include <set>
+#include <map>
+#include <deque>
 #include <kernel/include/modelutils.h>
 #include <kernel/include/definitions/types/signal/rf_signal.h>
 #include <kernel/include/definitions/types/interval/registered_rx_node_factory.h>
@@ -21,6 +23,8 @@
 
 double relative_sum_of_factors(double initial_factor, int number_bands);
 
+double get_reception_mW(const std::shared_ptr<RFSignal> &rf_signal);
+
 bool primitive_is_set(char* primitive, packet_t *packet);
 
 SetOfFrequencyIntervals create_setfrequencyintervals(const Frequency freq_center, const Frequency bandwidth,
@@ -53,7 +57,7 @@ class RFSignalAdjacentBandPhyModel : public PhyModel{
   RFSignalAdjacentBandPhyModel(Frequency freq_center, double factor_adjacent, uint number_adjacent_bands,
                            Frequency delta_adjacent_bands, Frequency bandwidth, int log_status, nodeid_t nodeid) ;
   ~RFSignalAdjacentBandPhyModel();
-  SetOfFrequencyIntervals GetOperatingFrequencyIntervalsTx();
+  const SetOfFrequencyIntervals &GetOperatingFrequencyIntervalsTx() const;
   void UpdateFrequencyIntervalsTx (SetOfFrequencyIntervals freq_intervals);
   void UpdateFrequencyIntervalsRx (SetOfFrequencyIntervals freq_intervals);
   int  GetLogStatus();
@@ -73,8 +77,8 @@ class RFSignalAdjacentBandPhyModel : public PhyModel{
   uint number_adjacent_bands_ = 0;
   Frequency delta_adjacent_bands_ = 1000;
   Frequency bandwidth_ = 100000;
-  std::multimap<Time, SignallUid> signals_already_treated_;
-  Time evaluation_window_ = 0;
+  std::multimap<Time, SignallUid> signals_pending_; // the signals being received, by begin time
+  std::deque<std::pair<Time, SignallUid>> signals_already_treated_; // the signals received, by end time
   int log_status_;
   nodeid_t nodeid_;
 };
@@ -24,49 +24,42 @@ RFSignalAdjacentBandPhyModel::RFSignalAdjacentBandPhyModel(Frequency freq_center
 
 }
 
-SetOfFrequencyIntervals RFSignalAdjacentBandPhyModel::GetOperatingFrequencyIntervalsTx(){
+const SetOfFrequencyIntervals &RFSignalAdjacentBandPhyModel::GetOperatingFrequencyIntervalsTx() const{
   return frequency_intervals_tx_;
 }
 
 void RFSignalAdjacentBandPhyModel::ReceiveSignalFromSpectrumImpl(std::shared_ptr<Signal> signal) {
 
-  //all received signals interfere
+  //all received signals interfere, until they can no longer overlap a signal being received
   received_signals_.insert(std::make_pair(signal->GetUID(),signal));
+  signals_pending_.insert(std::make_pair(signal->GetBegin(),signal->GetUID()));
 
-  // update the evaluation_window size
-  evaluation_window_ = std::max(evaluation_window_,signal->GetEnd()-signal->GetBegin());
-
-  auto rf_signal = std::dynamic_pointer_cast<RFSignal>(signal);
+  auto rf_signal = signal_cast<RFSignal>(signal);
 
   if (rf_signal){
     call_t to = {rf_signal->GetTo_Deprecated().classid, rf_signal->GetTo_Deprecated().object};
     call_t from = {rf_signal->GetFrom_Deprecated().classid, rf_signal->GetFrom_Deprecated().object};
+    packet_t *packet = rf_signal->GetPacket_Deprecated();
     // update pathloss, shadowing and fading of the signal
     // we use the OLD compute rxdBm from WSNETv3
     // WSNETv4 will not use the same functions
-    medium_compute_rxdBm(rf_signal->GetPacket_Deprecated(), &to, &from);
-
-    // convert the value of rxdBm into values of mW/Hz
-    rf_signal->GetPacket_Deprecated()->rxmW = dBm2mW(rf_signal->GetPacket_Deprecated()->rxdBm);
-
-    // update the signal
-    auto factor=1.0-relative_sum_of_factors(factor_adjacent_, number_adjacent_bands_);
-    auto current_adj_nbr=0;
-    for (auto freq_interval : rf_signal->GetWaveform().lock()->GetAllFrequencyInterval()){
-      auto psd = rf_signal->GetPacket_Deprecated()->rxmW*factor / (freq_interval->GetHighPoint() - freq_interval->GetLowPoint());
-      freq_interval->SetPSDValue(psd);
-      if (!current_adj_nbr){
-        factor = factor_adjacent_/2;
-      } else if (current_adj_nbr%2==0) {
-        factor = factor/2;
-      }
-      ++current_adj_nbr;
-    }
+    // the packet is shared by all the receivers of the signal, the power is kept local
+    double rxdBm = medium_get_rxdBm(packet, &to, &from);
+
+    // the waveform is shared by all the receivers of the signal,
+    // only the ratio between the received and the transmitted PSD is kept for this one
+    rf_signal->SetPSDScale(dBm2mW(rxdBm - packet->txdBm));
 
     //call signal_tracker to verify if it will take this signal or not
     //if the signal_tracker chose this signal, we start the interface_cs
+    //on a clone of this receiver, which carries its own received power
     if (signal_tracker_model_->ReceiveSignal(rf_signal)){
-      interface_cs(&to, &from, rf_signal->GetPacket_Deprecated());
+      packet_t *packet_cs = packet_rxclone(packet);
+      packet_cs->rxdBm = rxdBm;
+      packet_cs->rxmW  = dBm2mW(rxdBm);
+      packet_cs->RSSI  = rxdBm;
+      interface_cs(&to, &from, packet_cs);
+      packet_dealloc(packet_cs);
     }
   }
 }
@@ -89,6 +82,7 @@ void RFSignalAdjacentBandPhyModel::UnregisterRxNodeRxNodeImpl() {
   if (registered_rx_node_!=nullptr){
     spectrum_->UnregisterRXNode(registered_rx_node_);
     received_signals_.clear();
+    signals_pending_.clear();
     signals_already_treated_.clear();
     registered_rx_node_.reset();
   }
@@ -97,46 +91,40 @@ void RFSignalAdjacentBandPhyModel::UnregisterRxNodeRxNodeImpl() {
 void RFSignalAdjacentBandPhyModel::ReceivedSignalFromSpectrumRxEndImpl(std::shared_ptr<Signal> signal) {
 
   // insert the signal as already treated
-  signals_already_treated_.insert(std::make_pair(signal->GetEnd(), signal->GetUID()));
+  auto pending = signals_pending_.equal_range(signal->GetBegin());
+  for (auto elem = pending.first; elem != pending.second; ++elem){
+    if (elem->second == signal->GetUID()){
+      signals_pending_.erase(elem);
+      signals_already_treated_.push_back(std::make_pair(signal->GetEnd(), signal->GetUID()));
+      break;
+    }
+  }
 
   // check if it is the selected signal
   if (signal_tracker_model_->VerifySignalIsSelected(signal)){
     call_t to_interface = {signal->GetTo_Deprecated().classid, signal->GetTo_Deprecated().object};
     // if signal is selected, it is a RF Signal, so no need to check
-    auto desired_rf_signal = std::dynamic_pointer_cast<RFSignal>(signal);
-    packet_t *packet = desired_rf_signal->GetPacket_Deprecated();
+    auto desired_rf_signal = std::static_pointer_cast<RFSignal>(signal);
+    auto rxmW = get_reception_mW(desired_rf_signal);
     auto noise_mW = noise_get_noise(&to_interface, desired_rf_signal->GetBandwidth());
-    desired_rf_signal->SetSNR(packet->rxmW/noise_mW);
-    desired_rf_signal->SetSINR(packet->rxmW/noise_mW);
+    desired_rf_signal->SetSNR(rxmW/noise_mW);
+    desired_rf_signal->SetSINR(rxmW/noise_mW);
 
     interference_model_->ApplyInterference(signal, received_signals_);
     signal_tracker_model_->ResetSelectedSignal();
 
-    // calculate BER and PER
-    double ber = do_modulate_snr(&to_interface,packet->modulation, desired_rf_signal->GetSINR());
-    packet->PER = 1 - pow((1-ber),packet->size*8);
-
     SendPacketToUp_Deprecated(signal);
   }
 
-  // clear the received signals if no more signals to be interfered
-  if (signals_already_treated_.size()==received_signals_.size()){
-    evaluation_window_=0;
-    received_signals_.clear();
-    signals_already_treated_.clear();
+  // remove the signals treated which no longer overlap a signal being received,
+  // i.e. that ended before the first one began, the signals to come begin from now on
+  Time limit = get_time();
+  if (!signals_pending_.empty()){
+    limit = std::min(limit, signals_pending_.begin()->first);
   }
-  else {
-    // for all elements that their END is lower than
-    // the current time minus the evaluation_window
-    // i.e. they are no longer inside the evaluation window
-    Time delta = 0;
-    if (get_time()>evaluation_window_){
-      delta = get_time() - evaluation_window_;
-    }
-    for (auto elem=signals_already_treated_.begin(); elem!=signals_already_treated_.upper_bound(delta); ++elem){
-      signals_already_treated_.erase(elem);
-      received_signals_.erase(elem->second);
-    }
+  while (!signals_already_treated_.empty() && (signals_already_treated_.front().first <= limit)){
+    received_signals_.erase(signals_already_treated_.front().second);
+    signals_already_treated_.pop_front();
   }
   return;
 
@@ -146,7 +134,18 @@ void RFSignalAdjacentBandPhyModel::SendPacketToUp_DeprecatedImpl(std::shared_ptr
   auto rf_signal = std::static_pointer_cast<RFSignal>(signal);
   call_t to = {signal->GetTo_Deprecated().classid, signal->GetTo_Deprecated().object};
   call_t from = {signal->GetFrom_Deprecated().classid, signal->GetFrom_Deprecated().object};
-  RX(&to,&from,rf_signal->GetPacket_Deprecated());
+
+  // the packet of the signal is the transmitted one, the upper layers get their own
+  packet_t *packet = packet_rxclone(rf_signal->GetPacket_Deprecated());
+  packet->rxmW  = get_reception_mW(rf_signal);
+  packet->rxdBm = mW2dBm(packet->rxmW);
+  packet->RSSI  = packet->rxdBm;
+
+  // calculate BER and PER
+  double ber = do_modulate_snr(&to,packet->modulation, rf_signal->GetSINR());
+  packet->PER = 1 - pow((1-ber),packet->size*8);
+
+  RX(&to,&from,packet);
 }
 
 void RFSignalAdjacentBandPhyModel::PrintImpl() const {
@@ -203,6 +202,10 @@ void RFSignalAdjacentBandPhyModel::ReceivePacketFromUp_DeprecatedImpl(call_t *to
   SendSignalToSpectrum(rf_signal);
 }
 
+double get_reception_mW(const std::shared_ptr<RFSignal> &rf_signal) {
+  return dBm2mW(rf_signal->GetPacket_Deprecated()->txdBm) * rf_signal->GetPSDScale();
+}
+
 double relative_sum_of_factors(double initial_factor, int number_bands) {
   if (number_bands == 0){
     return 0.0;
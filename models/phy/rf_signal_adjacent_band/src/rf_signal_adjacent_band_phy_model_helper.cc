@@ -2,7 +2,7 @@
 
 bool primitive_is_set(char* primitive, packet_t *packet){
 
-  uint * primitive_header = (uint *) packet_retrieve_field_value_ptr(packet, primitive);
+  const uint * primitive_header = (const uint *) packet_get_field_value_ptr(packet, primitive);
 
   if (primitive_header!=nullptr){
     return true;
@@ -39,12 +39,17 @@ protected:
 	  params_ = list_create();
 	  to_ = {1,1};
 	  from_ = {0,0};
-	  packet_ = (packet_t *) malloc(sizeof(packet_t));
+	  hashtable_init();
+	  packet_init();
+	  packet_ = packet_create(&to_, 10, -1);
+	  packet_->txdBm = 14.0;
+	  packet_->rxdBm = 14.0;
   }
 
   virtual void TearDown() {
 	  list_destroy(params_);
-	  free(packet_);
+	  packet_dealloc(packet_);
+	  packet_clean();
   }
 public:
   list_t	*params_;
@@ -384,11 +389,8 @@ TEST_F(RFSignalAdjacentBandPhyModelUnitTest, RxEndMultipleRFSignalFourthIntersec
 
   rf_phy->ReceivedSignalFromSpectrumRxEnd(rf_signal_three);
 
-  // 4 because of the evaluation window
-  // This does not cause any problem because there is also calculation of
-  // intersection time in interference, but it does not have good performance
-  // and it is not the best solution
-  EXPECT_CALL(interf, ApplyInterferenceImpl(testing::_, testing::SizeIs(4))).Times(1);
+  // the first and second signals ended before the fourth one began
+  EXPECT_CALL(interf, ApplyInterferenceImpl(testing::_, testing::SizeIs(2))).Times(1);
 
   scheduler->SimulationTimeAdvanceClock((Time)7*SECONDS);
 
@@ -396,3 +398,35 @@ TEST_F(RFSignalAdjacentBandPhyModelUnitTest, RxEndMultipleRFSignalFourthIntersec
 
   destroy_object(rf_phy);
 }
+
+TEST_F(RFSignalAdjacentBandPhyModelUnitTest, RxEndSaturatedChannelBounded){
+  RFSignalAdjacentBandPhyModel * rf_phy = (RFSignalAdjacentBandPhyModel *) create_object(&to_, (void*) params_);
+  MockSignalTrackerModel sig_track;
+  MockInterferenceModel interf;
+  rf_phy->SetInterferenceModel(&interf);
+  rf_phy->SetSignalTrackerModel(&sig_track);
+  auto bandwidth = 125000;
+  auto power_dBm = 14.0;
+  auto freq_center = 868062500;
+  std::vector<std::shared_ptr<RFSignal>> rf_signals;
+
+  ON_CALL(sig_track, VerifySignalIsSelectedImpl(testing::_)).WillByDefault(testing::Return(true));
+
+  // the channel is never free: a signal begins each second and lasts two seconds,
+  // only the signals overlapping the ones being received are kept
+  EXPECT_CALL(interf, ApplyInterferenceImpl(testing::_, testing::SizeIs(testing::Le(4)))).Times(8);
+
+  for (auto i = 0; i < 10; ++i){
+    scheduler->SimulationTimeAdvanceClock((Time)i*SECONDS);
+    auto rf_signal = create_rf_simple_signal_tests(bandwidth, power_dBm, freq_center, packet_);
+    rf_signal->SetBegin((Time)i*SECONDS);
+    rf_signal->SetEnd((Time)(i+2)*SECONDS);
+    rf_phy->ReceiveSignalFromSpectrum(rf_signal);
+    rf_signals.push_back(rf_signal);
+    if (i >= 2){
+      rf_phy->ReceivedSignalFromSpectrumRxEnd(rf_signals[i-2]);
+    }
+  }
+
+  destroy_object(rf_phy);
+}
@@ -260,8 +260,8 @@ void rx(call_t *to, call_t *from, packet_t *packet) {
     struct _aodv_routing_class_private *classdata = get_class_private_data(to);
     
     /* extract the aodv header*/
-    struct _aodv_routing_packet_header *header = (struct _aodv_routing_packet_header *) packet_retrieve_field_value_ptr(packet, "_aodv_routing_packet_header");
-    struct _aodv_routing_packet_fixed_header *fixed_header = (struct _aodv_routing_packet_fixed_header *) packet_retrieve_field_value_ptr(packet, "_aodv_routing_packet_fixed_header");
+    const struct _aodv_routing_packet_header *header = (const struct _aodv_routing_packet_header *) packet_get_field_value_ptr(packet, "_aodv_routing_packet_header");
+    const struct _aodv_routing_packet_fixed_header *fixed_header = (const struct _aodv_routing_packet_fixed_header *) packet_get_field_value_ptr(packet, "_aodv_routing_packet_fixed_header");
 
     /* update local stats */
     nodedata->rx_nbr[fixed_header->packet_type]++;
@@ -166,7 +166,7 @@ void process_rreq_packet(call_t *to, call_t *from, packet_t *packet){
 	   
     /* extract packet header */
     //struct _aodv_routing_packet_header *header = (struct _aodv_routing_packet_header *) packet_retrieve_field_value_ptr(packet, "_aodv_routing_packet_header");
-    struct _aodv_routing_packet_fixed_header *fixed_header = (struct _aodv_routing_packet_fixed_header *) packet_retrieve_field_value_ptr(packet, "_aodv_routing_packet_fixed_header");
+    const struct _aodv_routing_packet_fixed_header *fixed_header = (const struct _aodv_routing_packet_fixed_header *) packet_get_field_value_ptr(packet, "_aodv_routing_packet_fixed_header");
     
     /* check if packet have been already treated, i.e., there is an entry in the packet table*/
     if ((packet_table_lookup(to, from, fixed_header->origin, fixed_header->final_dst, fixed_header->packet_type, fixed_header->origin_seq)) == SUCCESSFUL 
@@ -249,7 +249,7 @@ void process_rrep_packet(call_t *to, call_t *from, packet_t *packet){
     
     /* extract packet header */
     //struct _aodv_routing_packet_header *header = (struct _aodv_routing_packet_header *) packet_retrieve_field_value_ptr(packet, "_aodv_routing_packet_header");
-    struct _aodv_routing_packet_fixed_header *fixed_header = (struct _aodv_routing_packet_fixed_header *) packet_retrieve_field_value_ptr(packet, "_aodv_routing_packet_fixed_header");
+    const struct _aodv_routing_packet_fixed_header *fixed_header = (const struct _aodv_routing_packet_fixed_header *) packet_get_field_value_ptr(packet, "_aodv_routing_packet_fixed_header");
     
 
 
@@ -337,7 +337,7 @@ void process_data_packet(call_t *to, call_t *from, packet_t *packet){
     /* extract packet header */
     //struct _aodv_routing_packet_header *header = (struct _aodv_routing_packet_header *) packet_retrieve_field_value_ptr(packet, "_aodv_routing_packet_header");
     
-     struct _aodv_routing_packet_fixed_header *fixed_header = (struct _aodv_routing_packet_fixed_header *) packet_retrieve_field_value_ptr(packet, "_aodv_routing_packet_fixed_header");
+     const struct _aodv_routing_packet_fixed_header *fixed_header = (const struct _aodv_routing_packet_fixed_header *) packet_get_field_value_ptr(packet, "_aodv_routing_packet_fixed_header");
 
     /* check if packet have been already treated, i.e., there is an entry in packet table*/
     if (packet_table_lookup(to, from, fixed_header->origin, fixed_header->final_dst, fixed_header->packet_type, fixed_header->origin_seq) == SUCCESSFUL){
@@ -394,7 +394,7 @@ void process_data_packet(call_t *to, call_t *from, packet_t *packet){
 int set_aodv_routing_packet_header(call_t *to, call_t *from, packet_t *packet, int packet_type) {
     struct _aodv_routing_node_private *nodedata = get_node_private_data(to);
 
-    field_t *field = packet_retrieve_field(packet, "_aodv_routing_packet_header");
+    const field_t *field = packet_get_field(packet, "_aodv_routing_packet_header");
 
     /* check if packet header does not exists yet*/
     if ( field == NULL ){
@@ -419,7 +419,7 @@ int set_aodv_routing_packet_header(call_t *to, call_t *from, packet_t *packet, i
     }
 
     struct _aodv_routing_packet_header *header = (struct _aodv_routing_packet_header *) packet_retrieve_field_value_ptr(packet, "_aodv_routing_packet_header");
-    struct _aodv_routing_packet_fixed_header *fixed_header = (struct _aodv_routing_packet_fixed_header *) packet_retrieve_field_value_ptr(packet, "_aodv_routing_packet_fixed_header");
+    const struct _aodv_routing_packet_fixed_header *fixed_header = (const struct _aodv_routing_packet_fixed_header *) packet_get_field_value_ptr(packet, "_aodv_routing_packet_fixed_header");
 
     /* check for a route to the destination */
     struct _aodv_routing_route *route = NULL;
@@ -34,9 +34,9 @@ void print_log_tx(call_t *to, int packet_type, packet_t *packet){
   char *message2[] = {"", "DST", "DST", "SRC"};
   
   /* extract packet header */
-  struct _aodv_routing_packet_header *header = (struct _aodv_routing_packet_header *) packet_retrieve_field_value_ptr(packet, "_aodv_routing_packet_header");
+  const struct _aodv_routing_packet_header *header = (const struct _aodv_routing_packet_header *) packet_get_field_value_ptr(packet, "_aodv_routing_packet_header");
 
-  struct _aodv_routing_packet_fixed_header *fixed_header = (struct _aodv_routing_packet_fixed_header *) packet_retrieve_field_value_ptr(packet, "_aodv_routing_packet_fixed_header");
+  const struct _aodv_routing_packet_fixed_header *fixed_header = (const struct _aodv_routing_packet_fixed_header *) packet_get_field_value_ptr(packet, "_aodv_routing_packet_fixed_header");
 
   fprintf(stderr,"%s[AODV_%s_TX] Time=%lfs Node %d has sent a %s originated in %s %d (seq = %d) towards %s %d (seq = %d)  via nexthop %d (type = %s, ttl=%d, seq = %d) %s\n", color[packet_type],packet_types[packet_type], get_time()*0.000000001, to->object, packet_types[packet_type],message1[packet_type],fixed_header->origin, fixed_header->origin_seq, message2[packet_type], fixed_header->final_dst, fixed_header->final_dst_seq, header->dst, packet_types[packet_type], header->ttl, header->seq, KNRM);
    
@@ -66,8 +66,8 @@ void print_log_rx(call_t *to, int packet_type, packet_t *packet){
   char *message2[] = {"", "from SRC", "from SRC", "to reach DST"};
 
   /* extract packet header */
-  struct _aodv_routing_packet_header *header = (struct _aodv_routing_packet_header *) packet_retrieve_field_value_ptr(packet, "_aodv_routing_packet_header");
-  struct _aodv_routing_packet_fixed_header *fixed_header = (struct _aodv_routing_packet_fixed_header *) packet_retrieve_field_value_ptr(packet, "_aodv_routing_packet_fixed_header");
+  const struct _aodv_routing_packet_header *header = (const struct _aodv_routing_packet_header *) packet_get_field_value_ptr(packet, "_aodv_routing_packet_header");
+  const struct _aodv_routing_packet_fixed_header *fixed_header = (const struct _aodv_routing_packet_fixed_header *) packet_get_field_value_ptr(packet, "_aodv_routing_packet_fixed_header");
   
   int hops = header->ttl_max - header->ttl + fixed_header->hop_to_dst;
   
@@ -93,8 +93,8 @@ void print_log_fwd(call_t *to, int packet_type, packet_t *packet){
   char *color[] = {KNRM, KNRM, KNRM, KNRM};
     
   /* extract packet header */
-  struct _aodv_routing_packet_header *header = (struct _aodv_routing_packet_header *) packet_retrieve_field_value_ptr(packet, "_aodv_routing_packet_header");
-  struct _aodv_routing_packet_fixed_header *fixed_header = (struct _aodv_routing_packet_fixed_header *) packet_retrieve_field_value_ptr(packet, "_aodv_routing_packet_fixed_header");
+  const struct _aodv_routing_packet_header *header = (const struct _aodv_routing_packet_header *) packet_get_field_value_ptr(packet, "_aodv_routing_packet_header");
+  const struct _aodv_routing_packet_fixed_header *fixed_header = (const struct _aodv_routing_packet_fixed_header *) packet_get_field_value_ptr(packet, "_aodv_routing_packet_fixed_header");
 
   fprintf(stderr,"%s[AODV_%s_FWD] Time=%lfs Node %d has received a %s from SRC %d towards DST %d (via node %d, ttl=%d, seq = %d) => forwarding to next hop %s\n", color[packet_type],packet_types[packet_type], get_time()*0.000000001, to->object, packet_types[packet_type], fixed_header->origin, fixed_header->final_dst,  header->src, header->ttl,  header->seq, KNRM);
 }
@@ -118,7 +118,7 @@ void print_log_known(call_t *to, int packet_type, packet_t *packet){
   char *color[] = {KNRM, KBLU, KCYN, KYEL};
     
   /* extract packet header */
-  struct _aodv_routing_packet_header *header = (struct _aodv_routing_packet_header *) packet_retrieve_field_value_ptr(packet, "_aodv_routing_packet_header");  struct _aodv_routing_packet_fixed_header *fixed_header = (struct _aodv_routing_packet_fixed_header *) packet_retrieve_field_value_ptr(packet, "_aodv_routing_packet_fixed_header");
+  const struct _aodv_routing_packet_header *header = (const struct _aodv_routing_packet_header *) packet_get_field_value_ptr(packet, "_aodv_routing_packet_header");  const struct _aodv_routing_packet_fixed_header *fixed_header = (const struct _aodv_routing_packet_fixed_header *) packet_get_field_value_ptr(packet, "_aodv_routing_packet_fixed_header");
   
   fprintf(stderr,"%s[AODV_%s_RX] Time=%lfs Node %d has received a %s from SRC %d towards DST %d (via node %d, ttl=%d, seq = %d) => path already known, send a RREP_PACKET %s\n", color[packet_type],packet_types[packet_type], get_time()*0.000000001, to->object, packet_types[packet_type], fixed_header->origin, fixed_header->final_dst,  header->src, header->ttl,  header->seq, KNRM);
 
@@ -26,7 +26,7 @@ void route_forward_packet_to_destination(call_t *to, call_t *from, packet_t *pac
     /* extract the network and rrep headers */
     //struct _aodv_routing_packet_header *header = (struct _aodv_routing_packet_header *) packet_retrieve_field_value_ptr(packet, "_aodv_routing_packet_header");
     
-     struct _aodv_routing_packet_fixed_header *fixed_header = (struct _aodv_routing_packet_fixed_header *) packet_retrieve_field_value_ptr(packet, "_aodv_routing_packet_fixed_header");
+     const struct _aodv_routing_packet_fixed_header *fixed_header = (const struct _aodv_routing_packet_fixed_header *) packet_get_field_value_ptr(packet, "_aodv_routing_packet_fixed_header");
 
     /* set destination of packet to the final destination*/
     packet->destination.id = fixed_header->final_dst;
@@ -61,9 +61,9 @@ int route_update_from_packet(call_t *to, call_t *from, packet_t *packet) {
     struct _aodv_routing_node_private *nodedata = get_node_private_data(to);
 
     /* extract the network and rrep headers */
-    struct _aodv_routing_packet_header *header = (struct _aodv_routing_packet_header *) packet_retrieve_field_value_ptr(packet, "_aodv_routing_packet_header");
+    const struct _aodv_routing_packet_header *header = (const struct _aodv_routing_packet_header *) packet_get_field_value_ptr(packet, "_aodv_routing_packet_header");
     
-    struct _aodv_routing_packet_fixed_header *fixed_header = (struct _aodv_routing_packet_fixed_header *) packet_retrieve_field_value_ptr(packet, "_aodv_routing_packet_fixed_header");
+    const struct _aodv_routing_packet_fixed_header *fixed_header = (const struct _aodv_routing_packet_fixed_header *) packet_get_field_value_ptr(packet, "_aodv_routing_packet_fixed_header");
 
     /* Current object is the src, therefore, nothing to update*/
     if (to->object == fixed_header->origin){
@@ -155,7 +155,7 @@ int rrep_transmission(call_t *to, call_t *from, packet_t *rreq_packet) {
     //struct _aodv_routing_packet_header *received_header = (struct _aodv_routing_packet_header *) packet_retrieve_field_value_ptr(rreq_packet, "_aodv_routing_packet_header");
 
     /* extract packet fixed header */
-    struct _aodv_routing_packet_fixed_header *received_fixed_header = (struct _aodv_routing_packet_fixed_header *) packet_retrieve_field_value_ptr(rreq_packet, "_aodv_routing_packet_fixed_header");
+    const struct _aodv_routing_packet_fixed_header *received_fixed_header = (const struct _aodv_routing_packet_fixed_header *) packet_get_field_value_ptr(rreq_packet, "_aodv_routing_packet_fixed_header");
 
     /* create the RREP packet ( size is still 0 at this point ) */
     packet_t *packet = packet_create(to, 0, 0);
@@ -209,7 +209,7 @@ int rrep_transmission_from_relay(call_t *to, call_t *from, packet_t *rreq_packet
     //struct _aodv_routing_packet_header *received_header = (struct _aodv_routing_packet_header *) packet_retrieve_field_value_ptr(rreq_packet, "_aodv_routing_packet_header");
 
     /* extract packet fixed header */
-    struct _aodv_routing_packet_fixed_header *received_fixed_header = (struct _aodv_routing_packet_fixed_header *) packet_retrieve_field_value_ptr(rreq_packet, "_aodv_routing_packet_fixed_header");
+    const struct _aodv_routing_packet_fixed_header *received_fixed_header = (const struct _aodv_routing_packet_fixed_header *) packet_get_field_value_ptr(rreq_packet, "_aodv_routing_packet_fixed_header");
     
     /*to verify how many hops from relay to destination*/
     struct _aodv_routing_route *route = route_get_nexthop_to_destination(to, from, received_fixed_header->final_dst);
@@ -225,7 +225,7 @@ void rx(call_t *to, call_t *from, packet_t *packet) {
   struct _direct_diffusion_routing_class_private *classdata = get_class_private_data(to);
 
   /* extract the aodv header*/
-  struct _direct_diffusion_routing_packet_header *header = (struct _direct_diffusion_routing_packet_header *) packet_retrieve_field_value_ptr(packet, "_direct_diffusion_routing_packet_header");
+  const struct _direct_diffusion_routing_packet_header *header = (const struct _direct_diffusion_routing_packet_header *) packet_get_field_value_ptr(packet, "_direct_diffusion_routing_packet_header");
 
   /* update local stats */
   nodedata->rx_nbr[header->packet_type]++;
@@ -163,7 +163,7 @@ void process_hello_packet(call_t *to, call_t *from, packet_t *packet){
 void process_data_packet(call_t *to, call_t *from, packet_t *packet){
 
   /* extract packet header */
-  struct _direct_diffusion_routing_packet_header *header = (struct _direct_diffusion_routing_packet_header *) packet_retrieve_field_value_ptr(packet, "_direct_diffusion_routing_packet_header");
+  const struct _direct_diffusion_routing_packet_header *header = (const struct _direct_diffusion_routing_packet_header *) packet_get_field_value_ptr(packet, "_direct_diffusion_routing_packet_header");
 
   /* check if packet have been already treated, i.e., there is an entry in packet table*/
   if (packet_table_lookup(to, from, header->origin, header->final_dst, header->packet_type, header->seq) == SUCCESSFUL){
@@ -215,7 +215,7 @@ void process_interest_packet(call_t *to, call_t *from, packet_t *packet){
 
   struct _direct_diffusion_routing_node_private *nodedata = get_node_private_data(to);
   /* extract packet header */
-  struct _direct_diffusion_routing_packet_header *header = (struct _direct_diffusion_routing_packet_header *) packet_retrieve_field_value_ptr(packet, "_direct_diffusion_routing_packet_header");
+  const struct _direct_diffusion_routing_packet_header *header = (const struct _direct_diffusion_routing_packet_header *) packet_get_field_value_ptr(packet, "_direct_diffusion_routing_packet_header");
 
   /* check if packet have been already treated, i.e., there is an entry in packet table*/
   /* sink and anchor will destroy received packet */
@@ -316,7 +316,7 @@ int forward_to_lower_layers(call_t *to, call_t *from, packet_t *packet, int pack
 int set_direct_diffusion_routing_packet_header(call_t *to, call_t *from, packet_t *packet, int packet_type) {
   struct _direct_diffusion_routing_node_private *nodedata = get_node_private_data(to);
 
-  field_t *field = packet_retrieve_field(packet, "_direct_diffusion_routing_packet_header");
+  const field_t *field = packet_get_field(packet, "_direct_diffusion_routing_packet_header");
 
   /* check if packet header does not exists yet*/
   if ( field == NULL ){
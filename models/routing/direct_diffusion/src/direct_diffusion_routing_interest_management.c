@@ -103,7 +103,7 @@ int interest_propagation(call_t *to, call_t *from, void *args) {
   packet_t *packet = (packet_t *) args;
 
   /* extract aodv packet header from the interest packet*/
-  struct _direct_diffusion_routing_packet_header *header = (struct _direct_diffusion_routing_packet_header *) packet_retrieve_field_value_ptr(packet, "_direct_diffusion_routing_packet_header");
+  const struct _direct_diffusion_routing_packet_header *header = (const struct _direct_diffusion_routing_packet_header *) packet_get_field_value_ptr(packet, "_direct_diffusion_routing_packet_header");
 
   /* extract RREQ packet header */
   //struct _direct_diffusion_routing_interest_packet_header *interest_header = (struct _direct_diffusion_routing_interest_packet_header *) packet_retrieve_field_value_ptr(packet, "_direct_diffusion_routing_interest_header");
@@ -36,7 +36,7 @@ void print_log_tx(call_t *to, int packet_type, packet_t *packet){
   char *message2[] = {"", "DST", "SRC"};
 
   /* extract packet header */
-  struct _direct_diffusion_routing_packet_header *header = (struct _direct_diffusion_routing_packet_header *) packet_retrieve_field_value_ptr(packet, "_direct_diffusion_routing_packet_header");
+  const struct _direct_diffusion_routing_packet_header *header = (const struct _direct_diffusion_routing_packet_header *) packet_get_field_value_ptr(packet, "_direct_diffusion_routing_packet_header");
 
   fprintf(stderr,"%s[DD_%s_TX] Time=%lfs Node %d has sent a %s originated in %s %d towards %s %d via nexthop %d (type = %s, ttl=%d, seq = %d) %s\n", color[packet_type],packet_types[packet_type], get_time()*0.000000001, to->object, packet_types[packet_type],message1[packet_type],header->origin, message2[packet_type], header->final_dst, header->dst, packet_types[packet_type], header->ttl, header->seq, KNRM);
 
@@ -66,7 +66,7 @@ void print_log_rx(call_t *to, int packet_type, packet_t *packet){
   char *message2[] = {"", "from SRC", "to reach DST"};
 
   /* extract packet header */
-  struct _direct_diffusion_routing_packet_header *header = (struct _direct_diffusion_routing_packet_header *) packet_retrieve_field_value_ptr(packet, "_direct_diffusion_routing_packet_header");
+  const struct _direct_diffusion_routing_packet_header *header = (const struct _direct_diffusion_routing_packet_header *) packet_get_field_value_ptr(packet, "_direct_diffusion_routing_packet_header");
 
   int hops = header->ttl_max - header->ttl;
 
@@ -92,7 +92,7 @@ void print_log_fwd(call_t *to, int packet_type, packet_t *packet){
   char *color[] = {KYEL, KYEL, KYEL};
 
   /* extract packet header */
-  struct _direct_diffusion_routing_packet_header *header = (struct _direct_diffusion_routing_packet_header *) packet_retrieve_field_value_ptr(packet, "_direct_diffusion_routing_packet_header");
+  const struct _direct_diffusion_routing_packet_header *header = (const struct _direct_diffusion_routing_packet_header *) packet_get_field_value_ptr(packet, "_direct_diffusion_routing_packet_header");
 
   fprintf(stderr,"%s[DD_%s_FWD] Time=%lfs Node %d has received a %s from SRC %d towards DST %d (via node %d, ttl=%d, seq = %d) => forwarding to next hop %s\n", color[packet_type],packet_types[packet_type], get_time()*0.000000001, to->object, packet_types[packet_type], header->origin, header->final_dst,  header->src, header->ttl,  header->seq, KNRM);
 }
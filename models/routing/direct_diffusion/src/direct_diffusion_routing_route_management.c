@@ -49,7 +49,7 @@ int route_update_from_packet(call_t *to, call_t *from, packet_t *packet) {
   struct _direct_diffusion_routing_node_private *nodedata = get_node_private_data(to);
 
   /* extract the network and rrep headers */
-  struct _direct_diffusion_routing_packet_header *header = (struct _direct_diffusion_routing_packet_header *) packet_retrieve_field_value_ptr(packet, "_direct_diffusion_routing_packet_header");
+  const struct _direct_diffusion_routing_packet_header *header = (const struct _direct_diffusion_routing_packet_header *) packet_get_field_value_ptr(packet, "_direct_diffusion_routing_packet_header");
 
   /* Current object is the src, therefore, nothing to update*/
   if (to->object == header->origin){
@@ -252,7 +252,7 @@ void forward(call_t *to, call_t *from, packet_t *packet) {
   call_t to0 = {get_class_bindings_down(to)->elts[0], to->object};
   destination_t destination;
 
-  struct routing_header *routing_header = (struct routing_header *) packet_retrieve_field_value_ptr(packet, "routing_header");
+  const struct routing_header *routing_header = (const struct routing_header *) packet_get_field_value_ptr(packet, "routing_header");
 struct route *route = hashtable_retrieve(nodedata->routes, (void *) ((unsigned long) (routing_header->dst)));
 
   if (route == NULL) {
@@ -209,7 +209,7 @@ void add_neighbor(call_t *to, packet_t *packet) {
   /* check wether neighbor already exists */
   list_init_traverse(nodedata->neighbors);
 
-  struct routing_header *routing_header = (struct routing_header *) packet_retrieve_field_value_ptr(packet, "routing_header");
+  const struct routing_header *routing_header = (const struct routing_header *) packet_get_field_value_ptr(packet, "routing_header");
  
   while ((neighbor = (struct neighbor *) list_traverse(nodedata->neighbors)) != NULL) {      
     if (neighbor->id == routing_header->src) {
@@ -82,7 +82,7 @@ bool PickFirstSignalTrackerModel::ReceiveSignalImpl(std::shared_ptr<Signal> new_
   if (current_signal_.lock() != nullptr){
     return false;
   }
-  auto rf_signal = std::dynamic_pointer_cast<RFSignal>(new_signal);
+  auto rf_signal = signal_cast<RFSignal>(new_signal);
   // if it is a RFSignal
   // there is no need to filter for the bandwidth as this is done by the phy Rx registration
   if (rf_signal){
@@ -14,6 +14,10 @@
 #include <kernel/include/definitions/types.h>
 #include <kernel/include/definitions/models/spectrum/spectrum_model.h>
 #include <kernel/include/definitions/types/signal/rf_signal.h>
+#include <kernel/include/definitions/types/interval/frequency_interval_waveform.h>
+#include <kernel/include/definitions/types/interval/frequency_interval_registered_rx_node.h>
+#include <kernel/include/data_structures/interval_tree/typed_interval_tree.h>
+#include <kernel/include/data_structures/range_tree/kd_range_tree.h>
 
 class MultiBandRFSpectrumModel : public SpectrumModel{
 public:
@@ -32,11 +36,14 @@ private:
 	void SearchRxNodesForSignalImpl(std::weak_ptr<Signal>);
 	std::vector<std::shared_ptr<Signal>> SearchSignalsForRxNodeImpl(std::weak_ptr<RegisteredRxNode>);
 	void SignalRxEndImpl(std::shared_ptr<Signal>);
+	void UpdateRangeTree();
 	std::map<nodeid_t, std::weak_ptr<RegisteredRxNode>> rx_nodes_registered_;
 	std::map<SignallUid, std::weak_ptr<RFSignal>> txing_signals_;
-  std::unique_ptr<IntervalTree> rx_nodes_search_tree_;
-  std::unique_ptr<IntervalTree> txing_signals_search_tree_;
-  std::unique_ptr<RangeTree> range_tree_;
+  TypedIntervalTree<FrequencyIntervalRegisteredRxNode> rx_nodes_search_tree_;
+  TypedIntervalTree<FrequencyIntervalWaveform> txing_signals_search_tree_;
+  std::unique_ptr<RangeTree> range_tree_; // positions of the registered rx nodes
+  uint64_t positions_stamp_;              // nodes positions the range tree is up to date with
+  std::vector<nodeid_t> nodes_in_range_;
   RegisterMode register_mode_;
 };
 
@@ -24,6 +24,7 @@
 #include <kernel/include/definitions/types/signal/signal_factory.h>
 #include <kernel/include/data_structures/interval_tree/interval_tree.h>
 #include <kernel/include/data_structures/interval_tree/redblack_interval_tree.h>
+#include <kernel/include/data_structures/range_tree/kd_range_tree.h>
 #include <kernel/include/modelutils.h>
 #include "multiband_rf_spectrum_model.h"
 
@@ -31,28 +32,35 @@ uint64_t get_travel_time(auto rf_signal, auto registered_rx_node);
 
 void set_transceiver_to_tx_end(auto rf_signal);
 
+double get_propagation_range(auto rf_signal);
 
-MultiBandRFSpectrumModel::MultiBandRFSpectrumModel(){
-  rx_nodes_search_tree_ = std::make_unique<RedBlackIntervalTree>();
-  txing_signals_search_tree_ = std::make_unique<RedBlackIntervalTree>();
-  range_tree_ = std::make_unique<RangeTree>();
+bool frequency_bands_overlap(const SetOfFrequencyIntervalWaveform &tx_bands, std::shared_ptr<RegisteredRxNode> rx_node);
+
+
+MultiBandRFSpectrumModel::MultiBandRFSpectrumModel() :
+    rx_nodes_search_tree_(std::make_unique<RedBlackIntervalTree>()),
+    txing_signals_search_tree_(std::make_unique<RedBlackIntervalTree>()){
+  range_tree_ = std::make_unique<KdRangeTree>();
+  positions_stamp_ = (uint64_t) -1;
   register_mode_ = 0;
 }
 
 MultiBandRFSpectrumModel::MultiBandRFSpectrumModel(std::unique_ptr<IntervalTree> rx_nodes_search_tree,
 		std::unique_ptr<IntervalTree> txing_signals_search_tree,
 		std::unique_ptr<RangeTree> range_tree,
-		RegisterMode register_mode){
-	rx_nodes_search_tree_ = std::move(rx_nodes_search_tree);
-	txing_signals_search_tree_ = std::move(txing_signals_search_tree);
+		RegisterMode register_mode) :
+		rx_nodes_search_tree_(std::move(rx_nodes_search_tree)),
+		txing_signals_search_tree_(std::move(txing_signals_search_tree)){
 	range_tree_ = std::move(range_tree);
+	positions_stamp_ = (uint64_t) -1;
 	register_mode_ = register_mode;
 }
 
 std::vector<std::shared_ptr<Signal>> MultiBandRFSpectrumModel::RegisterRxNodeImpl(std::weak_ptr<RegisteredRxNode> rx_node){
 	rx_nodes_registered_.insert(std::make_pair (rx_node.lock()->GetNodeID(),rx_node));
-	for (auto freq : rx_node.lock()->GetAllFrequencyInterval()){
-		rx_nodes_search_tree_->Insert(freq);
+	range_tree_->Insert(rx_node.lock()->GetNodeID(), *get_node_position(rx_node.lock()->GetNodeID()));
+	for (auto const &freq : rx_node.lock()->GetAllFrequencyInterval()){
+		rx_nodes_search_tree_.Insert(freq);
 	}
 	return SearchSignalsForRxNode(rx_node);
 }
@@ -61,8 +69,9 @@ void MultiBandRFSpectrumModel::UnregisterRxNodeImpl(std::weak_ptr<RegisteredRxNo
 
 	if (rx_nodes_registered_.count(rx_node.lock()->GetNodeID())){
 		rx_nodes_registered_.erase(rx_node.lock()->GetNodeID());
-		for (auto freq : rx_node.lock()->GetAllFrequencyInterval()){
-			rx_nodes_search_tree_->Delete(freq);
+		range_tree_->Delete(rx_node.lock()->GetNodeID());
+		for (auto const &freq : rx_node.lock()->GetAllFrequencyInterval()){
+			rx_nodes_search_tree_.Delete(freq);
 		}
 	}
 }
@@ -71,23 +80,30 @@ std::vector<std::shared_ptr<Signal>> MultiBandRFSpectrumModel::SearchSignalsForR
 
 	std::vector<std::shared_ptr<Signal>> signals;
 	std::map<WaveformUid, std::weak_ptr<Signal>> signals_map;
-	std::list<std::weak_ptr<Interval>> query_results;
-
-	for (auto freq : rx_node.lock()->GetAllFrequencyInterval()){
-	  auto frequency_intervals = txing_signals_search_tree_->FindAllIntersections(freq);
-	  query_results.insert(query_results.end(), frequency_intervals.begin(),frequency_intervals.end());
-	}
 
 	// take only one interval_rx_node (even if there are more than one intersections)
-	for (auto result : query_results){
-	  std::weak_ptr<FrequencyIntervalWaveform> interval_waveform = std::dynamic_pointer_cast<FrequencyIntervalWaveform>(std::shared_ptr<Interval>(result));
-	  signals_map.insert(std::make_pair(interval_waveform.lock()->GetWaveform().lock()->GetUID(), interval_waveform.lock()->GetWaveform().lock()->GetSignal()));
+	auto insert_signal = [&signals_map](const std::shared_ptr<FrequencyIntervalWaveform> &interval_waveform){
+	  auto waveform = interval_waveform->GetWaveform().lock();
+	  signals_map.insert(std::make_pair(waveform->GetUID(), waveform->GetSignal()));
+	};
+
+	for (auto const &freq : rx_node.lock()->GetAllFrequencyInterval()){
+	  txing_signals_search_tree_.ForEachIntersection(freq->GetLowPoint(), freq->GetHighPoint(), insert_signal);
 	}
 
-	// copy all signals before sending it to the node
+	// one reception of each signal for the node
 	for (auto const &signal : signals_map){
-	  // static cast as the filtering for RFSignal was done before
-	  auto rf_signal = std::static_pointer_cast<RFSignal>(signal.second.lock()->Clone());
+	  // static cast as only RFSignals are inserted by SignalAddTx
+	  auto tx_signal = std::static_pointer_cast<RFSignal>(signal.second.lock());
+	  double range = get_propagation_range(tx_signal);
+
+	  // drop signals whose source is out of the propagation range of the medium
+	  if ((range > 0) && (distance(get_node_position(tx_signal->GetPacket_Deprecated()->node),
+	                               get_node_position(rx_node.lock()->GetNodeID())) > range)){
+	    continue;
+	  }
+
+	  auto rf_signal = std::static_pointer_cast<RFSignal>(tx_signal->CreateReception());
 	  auto travel_time = get_travel_time(rf_signal, rx_node.lock());
     rf_signal->SetBegin((Time) rf_signal->GetPacket_Deprecated()->clock0+travel_time);
     rf_signal->SetEnd((Time) rf_signal->GetPacket_Deprecated()->clock1+travel_time);
@@ -110,28 +126,59 @@ void MultiBandRFSpectrumModel::SignalRxBeginImpl(std::shared_ptr<Signal> signal)
   signal->GetDestination()->GetPhyModel()->ReceiveSignalFromSpectrum(signal);
 }
 
-void MultiBandRFSpectrumModel::SearchRxNodesForSignalImpl(std::weak_ptr<Signal> signal){
-	std::list<std::weak_ptr<Interval>> query_results;
-	std::map<nodeid_t, std::weak_ptr<RegisteredRxNode>> rx_nodes;
-	std::weak_ptr<Waveform> waveform = (std::dynamic_pointer_cast<RFSignal>(std::shared_ptr<Signal>(signal))->GetWaveform());
+void MultiBandRFSpectrumModel::UpdateRangeTree(){
+	nodes_refresh_mobility();
+	uint64_t positions_stamp = get_nodes_positions_stamp();
 
-	for (auto freq : waveform.lock()->GetAllFrequencyInterval()){
-		auto frequency_intervals = rx_nodes_search_tree_->FindAllIntersections(freq);
-		query_results.insert(query_results.end(), frequency_intervals.begin(),frequency_intervals.end());
+	if (positions_stamp == positions_stamp_){
+		return;
 	}
 
-	// take only one interval_rx_node (even if there are more than one intersections)
-	for (auto result : query_results){
-		std::weak_ptr<FrequencyIntervalRegisteredRxNode> interval_rx_node = std::dynamic_pointer_cast<FrequencyIntervalRegisteredRxNode>(std::shared_ptr<Interval>(result));
-		rx_nodes.insert(std::make_pair(interval_rx_node.lock()->GetRxNode().lock()->GetNodeID(), interval_rx_node.lock()->GetRxNode()));
+	// the nodes moved since the last query
+	for (auto const &rx_node : rx_nodes_registered_){
+		range_tree_->Update(rx_node.first, *get_node_position(rx_node.first));
+	}
+	positions_stamp_ = positions_stamp;
+}
+
+void MultiBandRFSpectrumModel::SearchRxNodesForSignalImpl(std::weak_ptr<Signal> signal){
+	std::map<nodeid_t, std::weak_ptr<RegisteredRxNode>> rx_nodes;
+	std::shared_ptr<RFSignal> tx_signal = signal_cast<RFSignal>(signal.lock());
+	if (!tx_signal){
+		return;
+	}
+	std::weak_ptr<Waveform> waveform = tx_signal->GetWaveform();
+	double range = get_propagation_range(tx_signal);
+
+	if (range > 0){
+		// spatial query first, only the receivers within range are checked against the waveform bands
+		auto const &tx_bands = waveform.lock()->GetAllFrequencyInterval();
+		UpdateRangeTree();
+		range_tree_->FindInRange(*get_node_position(tx_signal->GetPacket_Deprecated()->node), range, nodes_in_range_);
+		for (auto id : nodes_in_range_){
+			auto rx_node = rx_nodes_registered_.find(id);
+			if ((rx_node != rx_nodes_registered_.end()) && frequency_bands_overlap(tx_bands, rx_node->second.lock())){
+				rx_nodes.insert(*rx_node);
+			}
+		}
+	} else {
+		// take only one interval_rx_node (even if there are more than one intersections)
+		auto insert_rx_node = [&rx_nodes](const std::shared_ptr<FrequencyIntervalRegisteredRxNode> &interval_rx_node){
+			auto rx_node = interval_rx_node->GetRxNode();
+			rx_nodes.insert(std::make_pair(rx_node.lock()->GetNodeID(), rx_node));
+		};
+
+		for (auto const &freq : waveform.lock()->GetAllFrequencyInterval()){
+			rx_nodes_search_tree_.ForEachIntersection(freq->GetLowPoint(), freq->GetHighPoint(), insert_rx_node);
+		}
 	}
 
-	// send copies to receiving nodes
+	// send a reception to each receiving node, the waveform and the packet are shared
 	for(auto const &rx_node : rx_nodes){
 
 	  std::shared_ptr<RegisteredRxNode> registered_rx_node(rx_node.second);
 
-		auto rf_signal = std::static_pointer_cast<RFSignal>(signal.lock()->Clone());
+		auto rf_signal = std::static_pointer_cast<RFSignal>(tx_signal->CreateReception());
 
 		rf_signal->SetDestination(registered_rx_node);
 
@@ -152,14 +199,14 @@ void MultiBandRFSpectrumModel::SearchRxNodesForSignalImpl(std::weak_ptr<Signal>
 // maybe using templates this could be better implemented
 // this is to be called when the signal is supposed to be sent to nodes (TXBegin)
 void MultiBandRFSpectrumModel::SignalAddTxImpl(std::shared_ptr<Signal> signal){
-	auto rf_signal = std::dynamic_pointer_cast<RFSignal>(signal);
+	auto rf_signal = signal_cast<RFSignal>(signal);
 	if (rf_signal){
 		txing_signals_.insert(std::make_pair (rf_signal->GetUID(),rf_signal));
 
 		scheduler_add_tx_signal_end(rf_signal->GetPacket_Deprecated()->clock1, this, rf_signal);
 
-		for (auto freq : rf_signal->GetWaveform().lock()->GetAllFrequencyInterval()){
-			txing_signals_search_tree_->Insert(freq);
+		for (auto const &freq : rf_signal->GetWaveform().lock()->GetAllFrequencyInterval()){
+			txing_signals_search_tree_.Insert(freq);
 		}
 
 		SearchRxNodesForSignal(rf_signal);
@@ -179,8 +226,8 @@ void MultiBandRFSpectrumModel::SignalTxEndImpl(std::weak_ptr<Signal> signal){
 	if (txing_signals_.count(signal_id)){
 		std::shared_ptr<RFSignal> rf_signal = std::static_pointer_cast<RFSignal>(std::shared_ptr<Signal>(signal));
 		set_transceiver_to_tx_end(rf_signal);
-		for (auto freq : rf_signal->GetWaveform().lock()->GetAllFrequencyInterval()){
-			txing_signals_search_tree_->Delete(freq);
+		for (auto const &freq : rf_signal->GetWaveform().lock()->GetAllFrequencyInterval()){
+			txing_signals_search_tree_.Delete(freq);
 		}
 		txing_signals_.erase(signal_id);
 	}
@@ -195,10 +242,30 @@ void set_transceiver_to_tx_end(auto rf_signal){
   from_transceiver_class->methods->transceiver.tx_end(&from_transceiver, NULL, packet);
 }
 
+double get_propagation_range(auto rf_signal){
+  packet_t *packet = rf_signal->GetPacket_Deprecated();
+  call_t     from0  = {-1, packet->node};
+  array_t *interfaces_from = get_interface_classesid(&from0);
+  call_t from_interface = {interfaces_from->elts[0], packet->node};
+  medium_t    *medium = get_medium_by_id(interface_get_medium(&from_interface, &from0));
+
+  return medium->propagation_range;
+}
+
+// closed intervals, as in the interval trees
+bool frequency_bands_overlap(const SetOfFrequencyIntervalWaveform &tx_bands, std::shared_ptr<RegisteredRxNode> rx_node){
+  for (auto const &rx_band : rx_node->GetAllFrequencyInterval()){
+    for (auto const &tx_band : tx_bands){
+      if ((rx_band->GetLowPoint() <= tx_band->GetHighPoint()) && (tx_band->GetLowPoint() <= rx_band->GetHighPoint())){
+        return true;
+      }
+    }
+  }
+  return false;
+}
+
 uint64_t get_travel_time(auto rf_signal, auto registered_rx_node){
   packet_t *packet = rf_signal->GetPacket_Deprecated();
-  node_t      *node_rx  = get_node_by_id(registered_rx_node->GetNodeID());
-  node_t      *node_tx   = get_node_by_id(packet->node);
   call_t     from0  = {-1, packet->node};
   array_t *interfaces_from = get_interface_classesid(&from0);
   call_t from_interface = {interfaces_from->elts[0], packet->node};
@@ -206,7 +273,7 @@ uint64_t get_travel_time(auto rf_signal, auto registered_rx_node){
   array_t *interfaces_to = get_interface_classesid(&from0);
   call_t to_interface = {interfaces_to->elts[0], registered_rx_node->GetNodeID()};
   medium_t    *medium = get_medium_by_id(interface_get_medium(&from_interface, &from0));
-  double      dist     = distance(&(node_tx->position), &(node_rx->position));
+  double      dist     = distance(get_node_position(packet->node), get_node_position(registered_rx_node->GetNodeID()));
   double      travel_time   = dist / medium->speed_of_light;
 
   // set the to_interface to be used in the continuation
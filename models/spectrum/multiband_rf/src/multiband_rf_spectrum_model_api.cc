@@ -10,7 +10,11 @@
  *  \version 1.0
  **/
 
+#include <iostream>
+#include <string>
 #include <kernel/include/modelutils.h>
+#include <kernel/include/data_structures/interval_tree/flat_interval_tree.h>
+#include <kernel/include/data_structures/interval_tree/redblack_interval_tree.h>
 #include "multiband_rf_spectrum_model.h"
 
 /** \brief A structure to define the simulation module information
@@ -24,10 +28,39 @@ model_t model =  {
 };
 
 void *create_object(call_t *to, void *params) {
+  std::string interval_tree = INTERVAL_TREE_TYPE_REDBLACK;
+
   if (!params){
     std::cout<<"NULL params for "<<to->classid<<std::endl;
   }
-  void *p = TO_C(new MultiBandRFSpectrumModel);
+
+  param_t *param;
+  std::string key_str;
+
+  // Get module parameters from the XML configuration file
+  if (params) {
+    list_init_traverse((list_t*) params);
+    while ((param = (param_t *) list_traverse((list_t*) params)) != NULL) {
+      key_str = param->key;
+      if (key_str=="interval_tree") {
+        interval_tree = param->value;
+        if ((interval_tree != INTERVAL_TREE_TYPE_REDBLACK) && (interval_tree != INTERVAL_TREE_TYPE_FLAT)) {
+          std::cerr<<"multiband_rf: unknown interval_tree '"<<interval_tree<<"'"<<std::endl;
+          return NULL;
+        }
+      }
+    }
+  }
+
+  // only the rx nodes intervals may be flat: they are registered once and
+  // mostly searched, whereas the signals intervals change at each transmission
+  void *p;
+  if (interval_tree == INTERVAL_TREE_TYPE_FLAT) {
+    p = TO_C(new MultiBandRFSpectrumModel(std::make_unique<FlatIntervalTree>(), std::make_unique<RedBlackIntervalTree>(),
+                                          std::make_unique<KdRangeTree>(), 0));
+  } else {
+    p = TO_C(new MultiBandRFSpectrumModel);
+  }
   return p;
 }
 
@@ -65,6 +65,14 @@ void __wrap_nodes_update_mobility(void){
   return;
 }
 
+void __wrap_nodes_refresh_mobility(void){
+  return;
+}
+
+void __wrap_nodes_set_mobility_lazy(void){
+  return;
+}
+
 int __wrap_get_node_count(void){
   return DefinitionsNodeFake::number_nodes_;
 }
@@ -80,6 +88,11 @@ int __wrap_is_node_alive(nodeid_t id){
   return 1;
 }
 
+int __wrap_get_node_state(nodeid_t id){
+  (void) id;
+  return NODE_ACTIVE;
+}
+
 void __wrap_node_kill(nodeid_t id){
   (void) id;
   //DefinitionsNodeFake::node_info_->state = NODE_DEAD;
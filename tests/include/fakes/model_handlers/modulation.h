@@ -55,6 +55,17 @@ double do_modulate_snr(call_t *from, classid_t modulation, double snr){
   return 0.0;
 }
 
+void do_modulate_batch(call_t *from, classid_t modulation, double rxmW, const double *noise, double *ber, int n){
+  (void) from;
+  (void) modulation;
+  (void) rxmW;
+  (void) noise;
+  int i;
+  for (i = 0; i < n; i++){
+    ber[i] = 0.0;
+  }
+}
+
 void __wrap_modulation_errors(packet_t *packet){
   (void) packet;
   return;
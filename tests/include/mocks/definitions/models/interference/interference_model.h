@@ -16,10 +16,10 @@
 class MockInterferenceModel: public InterferenceModel {
 public:
   MOCK_CONST_METHOD0(GetUID, InterferenceModelUid());
-  MOCK_METHOD2(ApplyInterference, void(std::shared_ptr<Signal> signal, MapOfSignals));
+  MOCK_METHOD2(ApplyInterference, void(std::shared_ptr<Signal> signal, const MapOfSignals &));
   MOCK_CONST_METHOD0(Print, void());
 
-  MOCK_METHOD2(ApplyInterferenceImpl, void(std::shared_ptr<Signal> signal, MapOfSignals));
+  MOCK_METHOD2(ApplyInterferenceImpl, void(std::shared_ptr<Signal> signal, const MapOfSignals &));
   MOCK_CONST_METHOD0(PrintImpl, void());
 };
 